@@ -28,7 +28,7 @@ Logger::~Logger() {
 }
 
 void Logger::HandlePacket(mc::protocol::packets::in::ChatPacket* packet) {
-    std::string message = mc::util::ParseChatNode(packet->GetChatData());
+    std::string message = packet->GetText();
 
     if (!message.empty())
         std::cout << message << std::endl;
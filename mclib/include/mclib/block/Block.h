@@ -5,6 +5,7 @@
 #include <mclib/common/Types.h>
 #include <mclib/protocol/ProtocolState.h>
 
+#include <deque>
 #include <unordered_map>
 #include <string>
 #include <vector>
@@ -89,25 +90,33 @@ typedef Block* BlockPtr;
 
 class BlockRegistry {
 private:
-    std::unordered_map<u32, BlockPtr> m_Blocks;
+    // Indexed by block data. Metas without a block of their own point to meta 0 of the type.
+    std::vector<BlockPtr> m_States;
     std::unordered_map<std::string, BlockPtr> m_BlockNames;
+    // Blocks passed to RegisterBlock, deleted by ClearRegistry
+    std::vector<BlockPtr> m_Owned;
+    // Vanilla blocks are built in place from static tables instead of being allocated one by one.
+    std::deque<Block> m_Vanilla;
+    bool m_VanillaFlattened;
+
+    BlockRegistry() : m_VanillaFlattened(false) { }
+
+    void Insert(BlockPtr block);
 
-    BlockRegistry() { }
 public:
+    // The process-wide registry that blocks are registered to by hand.
     static MCLIB_API BlockRegistry* GetInstance();
+    /**
+     * Shared read-only registry with the vanilla blocks of the version, built on first use.
+     * Versions with the same block data share an instance. Safe to call from any thread.
+     */
+    static MCLIB_API const BlockRegistry* GetInstance(protocol::Version version);
 
     MCLIB_API ~BlockRegistry();
 
+    // Returns nullptr if neither the data or the basic version of its type is registered.
     BlockPtr GetBlock(u32 data) const {
-        auto iter = m_Blocks.find(data);
-
-        if (iter == m_Blocks.end()) {
-            data &= ~15; // Return basic version if the meta type can't be found
-            iter = m_Blocks.find(data);
-            if (iter == m_Blocks.end())
-                return nullptr;
-        }
-        return iter->second;
+        return data < m_States.size() ? m_States[data] : nullptr;
     }
 
     BlockPtr GetBlock(u16 type, u16 meta) const {
@@ -117,11 +126,13 @@ public:
 
     BlockPtr MCLIB_API GetBlock(const std::string& name) const;
 
-    void RegisterBlock(BlockPtr block) {
-        m_Blocks[block->GetType()] = block;
-        m_BlockNames[block->GetName()] = block;
-    }
+    // One past the highest block data that can be looked up.
+    std::size_t GetStateCount() const noexcept { return m_States.size(); }
+
+    // Takes ownership of the block.
+    void MCLIB_API RegisterBlock(BlockPtr block);
 
+    // Does nothing if the blocks for this version are already registered.
     void MCLIB_API RegisterVanillaBlocks(protocol::Version protocolVersion);
     void MCLIB_API ClearRegistry();
 };
@@ -8,17 +8,22 @@
 #include <mclib/core/ClientSettings.h>
 #include <mclib/core/Compression.h>
 #include <mclib/core/Encryption.h>
+#include <mclib/core/PacketPipeline.h>
 #include <mclib/network/Socket.h>
 #include <mclib/protocol/Protocol.h>
 #include <mclib/protocol/packets/Packet.h>
 #include <mclib/protocol/packets/PacketHandler.h>
+#include <mclib/util/LatencyTracker.h>
 #include <mclib/util/ObserverSubject.h>
 #include <mclib/util/Yggdrasil.h>
 
+#include <atomic>
 #include <string>
 #include <queue>
 #include <future>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 namespace mc {
 namespace core {
@@ -49,11 +54,33 @@ private:
     protocol::State m_ProtocolState;
     u16 m_Port;
     bool m_SentSettings;
-    s32 m_Dimension;
+    // Written by the pipeline's decode thread instead while the pipeline runs, see PacketPipeline::DecodeThread.
+    std::atomic<s32> m_Dimension;
+    bool m_PipelineEnabled;
+    bool m_PriorityLaneEnabled;
+    bool m_Compressed;
+    // When the data currently being handled was received, for keepalive latency
+    s64 m_ReceiveTime;
+    // Serializes encryption and sending, since the priority lane can answer from the pipeline's receive thread.
+    std::mutex m_SendMutex;
+    // Responses the priority lane already sent, so the handlers don't send them again when the packets are dispatched in order.
+    std::mutex m_PriorityMutex;
+    std::vector<s64> m_AnsweredKeepAlives;
+    std::vector<s32> m_ConfirmedTeleports;
+    util::LatencyTracker m_KeepAliveLatency;
+    // Declared after the socket and strategies so it's destroyed before them.
+    std::unique_ptr<PacketPipeline> m_Pipeline;
 
     void AuthenticateClient(const std::wstring& serverId, const std::string& sharedSecret, const std::string& pubkey);
     protocol::packets::Packet* CreatePacket(DataBuffer& buffer);
     void SendSettingsPacket();
+    void StartPipeline();
+    void StopPipeline();
+    void DispatchPipeline();
+    protocol::packets::Packet* HandlePriorityFrame(DataBuffer& data, std::size_t length, s64 receivedAt);
+    bool HandlePriorityFrames();
+
+    friend class PacketPipeline;
 
 public:
     MCLIB_API Connection(protocol::packets::PacketDispatcher* dispatcher, protocol::Version version = protocol::Version::Minecraft_1_11_2);
@@ -72,6 +99,28 @@ public:
 
     void SendSettings() noexcept { m_SentSettings = false; }
 
+    /**
+     * Decode packets on background threads once the connection reaches the play state.
+     * CreatePacket then only dispatches packets that are already decoded.
+     * Takes effect on the next login.
+     */
+    void SetPipelineEnabled(bool enabled) noexcept { m_PipelineEnabled = enabled; }
+    bool IsPipelineEnabled() const noexcept { return m_PipelineEnabled; }
+    // nullptr until the pipeline is started.
+    const PacketPipeline* GetPipeline() const noexcept { return m_Pipeline.get(); }
+
+    /**
+     * The priority lane looks at every frame as soon as it's received. KeepAlive is answered and
+     * teleports are confirmed right away, and Disconnect is dispatched ahead of anything still queued.
+     * The packets are still dispatched in order afterwards, without the responses being sent twice.
+     * Enabled by default.
+     */
+    void SetPriorityLaneEnabled(bool enabled) noexcept { m_PriorityLaneEnabled = enabled; }
+    bool IsPriorityLaneEnabled() const noexcept { return m_PriorityLaneEnabled; }
+
+    // Time from receiving a keepalive to sending the response, over the most recent keepalives.
+    util::LatencyPercentiles GetKeepAliveLatency() const { return m_KeepAliveLatency.GetPercentiles(); }
+
     void MCLIB_API HandlePacket(protocol::packets::in::KeepAlivePacket* packet);
     void MCLIB_API HandlePacket(protocol::packets::in::PlayerPositionAndLookPacket* packet);
     void MCLIB_API HandlePacket(protocol::packets::in::DisconnectPacket* packet);
@@ -98,6 +147,8 @@ public:
         packet.SetProtocolVersion(m_Protocol.GetVersion());
         DataBuffer packetBuffer = packet.Serialize();
         DataBuffer compressed = m_Compressor->Compress(packetBuffer);
+
+        std::lock_guard<std::mutex> lock(m_SendMutex);
         DataBuffer encrypted = m_Encrypter->Encrypt(compressed);
 
         m_Socket->Send(encrypted);
@@ -0,0 +1,140 @@
+#ifndef MCLIB_CORE_PACKET_PIPELINE_H_
+#define MCLIB_CORE_PACKET_PIPELINE_H_
+
+#include <mclib/mclib.h>
+#include <mclib/common/DataBuffer.h>
+#include <mclib/common/Types.h>
+#include <mclib/protocol/Protocol.h>
+#include <mclib/util/SPSCQueue.h>
+
+#include <atomic>
+#include <thread>
+
+namespace mc {
+
+namespace network {
+    class Socket;
+} // ns network
+
+namespace core {
+
+class Connection;
+class CompressionStrategy;
+struct EncryptionStrategy;
+
+struct PipelineStageStats {
+    // Items waiting in front of the stage
+    std::size_t depth;
+    std::size_t maxDepth;
+    u64 processed;
+    // Time items spent waiting in the queue, in microseconds
+    u64 totalLatency;
+    u64 maxLatency;
+
+    double GetAverageLatency() const noexcept {
+        return processed > 0 ? (double)totalLatency / processed : 0.0;
+    }
+};
+
+struct PipelineStats {
+    // Framed packets waiting to be decompressed and deserialized
+    PipelineStageStats decode;
+    // Decoded packets waiting for the owner thread to dispatch them
+    PipelineStageStats apply;
+    // Frames that were dropped because they failed to decompress or deserialize, and bad frame lengths
+    u64 decodeErrors;
+};
+
+/**
+ * Moves receiving, decrypting and decoding off the thread that owns the client state.
+ *
+ * The receive thread reads the socket, decrypts and splits the stream into packet frames.
+ * The decode thread decompresses and deserializes them. Each hand-off goes through an SPSC queue,
+ * and the owner thread polls the finished packets and dispatches them in the order they arrived.
+ * A slow ChunkData decode only delays the packets behind it in the queue, never the owner thread.
+ * Frames also pass through the connection's priority lane on the receive thread, so keepalives
+ * are answered before they even reach the decode queue.
+ *
+ * Only used in the play state, where the compression and encryption settings no longer change.
+ */
+class PacketPipeline {
+private:
+    struct Frame {
+        DataBuffer data;
+        std::size_t length;
+        s64 timestamp;
+    };
+
+    struct Decoded {
+        protocol::packets::Packet* packet;
+        s64 timestamp;
+    };
+
+    struct StageCounters {
+        std::atomic<std::size_t> maxDepth;
+        std::atomic<u64> processed;
+        std::atomic<u64> totalLatency;
+        std::atomic<u64> maxLatency;
+
+        StageCounters() : maxDepth(0), processed(0), totalLatency(0), maxLatency(0) { }
+    };
+
+    Connection* m_Connection;
+    protocol::Protocol& m_Protocol;
+    network::Socket* m_Socket;
+    EncryptionStrategy* m_Encrypter;
+    CompressionStrategy* m_Compressor;
+
+    util::SPSCQueue<Frame> m_Frames;
+    util::SPSCQueue<Decoded> m_Packets;
+    // Packets from the connection's priority lane that skip ahead of m_Packets
+    util::SPSCQueue<Decoded> m_Urgent;
+    StageCounters m_DecodeCounters;
+    StageCounters m_ApplyCounters;
+    std::atomic<u64> m_DecodeErrors;
+
+    DataBuffer m_ReceiveBuffer;
+    std::thread m_ReceiveThread;
+    std::thread m_DecodeThread;
+    std::atomic<bool> m_Running;
+    std::atomic<bool> m_ReceiveFinished;
+    std::atomic<bool> m_Closed;
+
+    void ReceiveThread();
+    void DecodeThread();
+    bool ReadFrames();
+    void Record(StageCounters& counters, std::size_t depth, s64 timestamp);
+
+    template <typename T>
+    bool Push(util::SPSCQueue<T>& queue, T&& value);
+
+public:
+    MCLIB_API PacketPipeline(Connection* connection, protocol::Protocol& protocol, network::Socket* socket,
+        EncryptionStrategy* encrypter, CompressionStrategy* compressor, std::size_t queueSize = 1024);
+    MCLIB_API ~PacketPipeline();
+
+    PacketPipeline(const PacketPipeline& rhs) = delete;
+    PacketPipeline& operator=(const PacketPipeline& rhs) = delete;
+
+    // pending holds data that was already received and decrypted but not framed yet.
+    void MCLIB_API Start(DataBuffer pending);
+    // Joins the worker threads and frees every packet that wasn't polled.
+    void MCLIB_API Stop();
+
+    bool IsRunning() const noexcept { return m_Running; }
+    // Set once the socket stopped being connected or sent a bad frame length, and every packet before that was decoded.
+    bool IsClosed() const noexcept { return m_Closed; }
+
+    /**
+     * Owner thread only. Returns the next decoded packet or nullptr if none are ready.
+     * The caller frees it with PacketFactory::FreePacket.
+     */
+    MCLIB_API protocol::packets::Packet* Poll();
+
+    PipelineStats MCLIB_API GetStats() const;
+};
+
+} // ns core
+} // ns mc
+
+#endif
@@ -6,8 +6,10 @@
 #include <mclib/entity/Player.h>
 #include <mclib/util/ObserverSubject.h>
 
+#include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 
 
 // TODO: Add properties, gamemode, and ping
@@ -22,19 +24,23 @@ private:
     UUID m_UUID;
     std::wstring m_Name;
     entity::PlayerEntityPtr m_Entity;
+    // Id of m_Entity, still known after the entity is gone so the PlayerManager can drop it from its index
+    EntityId m_EntityId;
+
+    // Only the PlayerManager sets the entity, so its entity id index stays in sync.
+    void SetEntity(entity::PlayerEntityPtr entity) { m_Entity = entity; }
 
 public:
     Player(UUID uuid, std::wstring name)
         : m_UUID(uuid),
-        m_Name(name)
+        m_Name(name),
+        m_EntityId(-1)
     {
 
     }
 
     std::shared_ptr<entity::PlayerEntity> GetEntity() const { return m_Entity.lock(); }
 
-    void SetEntity(entity::PlayerEntityPtr entity) { m_Entity = entity; }
-
     const std::wstring& GetName() const { return m_Name; }
     UUID GetUUID() const { return m_UUID; }
 
@@ -66,11 +72,22 @@ class PlayerManager : public protocol::packets::PacketHandler, public entity::En
 public:
     typedef std::map<UUID, PlayerPtr> PlayerList;
     typedef PlayerList::iterator iterator;
+    using PlayerMoveEvent = util::Event<const PlayerPtr&, const Vector3d&, const Vector3d&>;
 
 private:
     PlayerList m_Players;
+    // Players with a spawned entity, by entity id. Lookups drop the players whose entity is gone.
+    mutable std::unordered_map<EntityId, PlayerPtr> m_EntityPlayers;
+    // Players by lowercase name
+    std::unordered_map<std::wstring, PlayerPtr> m_NamedPlayers;
     entity::EntityManager* m_EntityManager;
     UUID m_ClientUUID;
+    PlayerMoveEvent m_PlayerMoveEvent;
+
+    // Sets the player's entity and keeps the entity id index up to date.
+    void SetPlayerEntity(const PlayerPtr& player, entity::PlayerEntityPtr entity);
+    void SetPlayerName(const PlayerPtr& player, const std::wstring& name);
+    void RemovePlayer(PlayerList::iterator iter);
 
 public:
     MCLIB_API PlayerManager(protocol::packets::PacketDispatcher* dispatcher, entity::EntityManager* entityManager);
@@ -81,15 +98,16 @@ public:
     PlayerManager(PlayerManager&& rhs) = delete;
     PlayerManager& operator=(PlayerManager&& rhs) = delete;
 
+    PlayerMoveEvent& GetPlayerMoveEvent() noexcept { return m_PlayerMoveEvent; }
+
     iterator MCLIB_API begin();
     iterator MCLIB_API end();
 
     // Gets a player by their UUID. Fast method, just requires map lookup.
     PlayerPtr MCLIB_API GetPlayerByUUID(UUID uuid) const;
-    // Gets a player by their EntityId. Somewhat slow method, has to loop through player map to find the player with that eid.
-    // It should still be pretty fast though since there aren't many players on a server usually.
+    // Gets a player by the EntityId of their spawned entity, or null if the entity is gone. Hash lookup, so other entities are rejected quickly.
     PlayerPtr MCLIB_API GetPlayerByEntityId(EntityId eid) const;
-    // Gets a player by their username.
+    // Gets a player by their username, ignoring case like the server does. Hash lookup.
     PlayerPtr MCLIB_API GetPlayerByName(const std::wstring& name) const;
 
     void MCLIB_API OnPlayerSpawn(entity::PlayerEntityPtr entity, UUID uuid);
@@ -1,9 +1,12 @@
 #ifndef MCLIB_ENTITY_ENTITY_H_
 #define MCLIB_ENTITY_ENTITY_H_
 
+#include <mclib/mclib.h>
 #include <mclib/common/DataBuffer.h>
 #include <mclib/common/Types.h>
 #include <mclib/entity/Attribute.h>
+#include <mclib/entity/EntityStore.h>
+#include <mclib/entity/EntityType.h>
 #include <mclib/entity/Metadata.h>
 
 #include <string>
@@ -13,153 +16,63 @@
 namespace mc {
 namespace entity {
 
-enum class EntityType {
-    Item = 1,
-    XPOrb,
-    AreaEffectCloud,
-    ElderGuardian,
-    WitherSkeleton,
-    Stray,
-    ThrownEgg,
-    LeashKnot,
-    Painting,
-    Arrow,
-    Snowball,
-    Fireball,
-    SmallFireball,
-    ThrownEnderpearl,
-    EyeOfEnderSignal,
-    ThrownPotion,
-    ThrownExpBottle,
-    ItemFrame,
-    WitherSkull,
-    PrimedTnt,
-    FallingSand,
-    FireworksRocketEntity,
-    Husk,
-    SpectralArrow,
-    ShulkerBullet,
-    DragonFireball,
-    ZombieVillager,
-    SkeletonHorse,
-    ZombieHorse,
-    ArmorStand,
-    Donkey,
-    Mule,
-    EvocationFangs,
-    EvocationIllager,
-    Vex,
-    VindicationIllager,
-    IllusionIllager,
-
-    MinecartCommandBlock = 40,
-    Boat,
-    MinecartRideable,
-    MinecartChest,
-    MinecartFurnace,
-    MinecartTNT,
-    MinecartHopper,
-    MinecartSpawner,
-
-    Creeper = 50,
-    Skeleton,
-    Spider,
-    Giant,
-    Zombie,
-    Slime,
-    Ghast,
-    PigZombie,
-    Enderman,
-    CaveSpider,
-    Silverfish,
-    Blaze,
-    LavaSlime,
-    EnderDragon,
-    WitherBoss,
-    Bat,
-    Witch,
-    Endermite,
-    Guardian,
-    Shulker,
-
-    Pig = 90,
-    Sheep,
-    Cow,
-    Chicken,
-    Squid,
-    Wolf,
-    Mooshroom,
-    SnowMan,
-    Ocelot,
-    IronGolem,
-    Horse,
-    Rabbit,
-    PolarBear,
-    Llama,
-    LlamaSpit,
-    Parrot,
-
-    Villager = 120,
-
-    EnderCrystal = 200,
-
-    // Not part of protocol
-    Lightning= 251,
-    FallingObject = 252,
-    FishingHook = 253,
-    Player = 254,
-    Unknown
-};
-
+/**
+ * Position, velocity, rotation, type and vehicle are kept in an EntityStore, the rest is kept here.
+ * Entities of an EntityManager share its store and should only be used from the thread that handles packets.
+ */
 class Entity {
 public:
     using AttributeMap = std::unordered_map<std::wstring, Attribute>;
 
 protected:
+    EntityStorePtr m_Store;
+    EntityHandle m_Handle;
+    EntityId m_EntityId;
     AttributeMap m_Attributes;
     EntityMetadata m_Metadata;
-    Vector3d m_Position;
-    Vector3d m_Velocity;
-    EntityId m_EntityId;
-    // Stored in radians
-    float m_Yaw, m_Pitch, m_HeadPitch;
-    EntityId m_VehicleId;
-    EntityType m_Type;
 
 public:
-    Entity(EntityId id, protocol::Version protocolVersion) noexcept : m_EntityId(id), m_VehicleId(-1), m_Type(EntityType::Unknown), m_Metadata(protocolVersion) { }
-    virtual ~Entity() { }
+    // Keeps its state in a store of its own.
+    MCLIB_API Entity(EntityId id, protocol::Version protocolVersion);
+    MCLIB_API Entity(EntityId id, protocol::Version protocolVersion, EntityStorePtr store);
+    MCLIB_API virtual ~Entity();
 
-    Entity(const Entity& rhs) = default;
-    Entity& operator=(const Entity& rhs) = default;
-    Entity(Entity&& rhs) = default;
-    Entity& operator=(Entity&& rhs) = default;
+    // Copies get a store of their own.
+    MCLIB_API Entity(const Entity& rhs);
+    MCLIB_API Entity& operator=(const Entity& rhs);
+    MCLIB_API Entity(Entity&& rhs) noexcept;
+    MCLIB_API Entity& operator=(Entity&& rhs) noexcept;
 
     EntityId GetEntityId() const noexcept { return m_EntityId; }
-    EntityId GetVehicleId() const noexcept { return m_VehicleId; }
-    const Vector3d& GetPosition() const noexcept { return m_Position; }
-    const Vector3d& GetVelocity() const noexcept { return m_Velocity; }
-    float GetYaw() const noexcept { return m_Yaw; }
-    float GetPitch() const noexcept { return m_Pitch; }
-    float GetHeadPitch() const noexcept { return m_HeadPitch; }
-    EntityType GetType() const noexcept { return m_Type; }
+    EntityId GetVehicleId() const noexcept { return m_Store->GetVehicleId(m_Handle); }
+    const Vector3d& GetPosition() const noexcept { return m_Store->GetPosition(m_Handle); }
+    const Vector3d& GetVelocity() const noexcept { return m_Store->GetVelocity(m_Handle); }
+    // Stored in radians
+    float GetYaw() const noexcept { return m_Store->GetYaw(m_Handle); }
+    float GetPitch() const noexcept { return m_Store->GetPitch(m_Handle); }
+    float GetHeadPitch() const noexcept { return m_Store->GetHeadPitch(m_Handle); }
+    EntityType GetType() const noexcept { return m_Store->GetType(m_Handle); }
     const EntityMetadata& GetMetadata() const noexcept { return m_Metadata; }
     const AttributeMap& GetAttributes() const noexcept { return m_Attributes; }
 
+    const EntityStorePtr& GetStore() const noexcept { return m_Store; }
+    EntityHandle GetHandle() const noexcept { return m_Handle; }
+
     Attribute GetAttribute(const std::wstring& key) {
         auto iter = m_Attributes.find(key);
         if (iter == m_Attributes.end()) return Attribute(key, 0);
         return iter->second;
     }
 
-    void SetPosition(const Vector3d& pos) noexcept { m_Position = pos; }
-    void SetVelocity(const Vector3d& vel) noexcept { m_Velocity = vel; }
-    void SetYaw(float yaw) noexcept { m_Yaw = yaw; }
-    void SetPitch(float pitch) noexcept { m_Pitch = pitch; }
-    void SetHeadPitch(float pitch) noexcept { m_HeadPitch = pitch; }
-    void SetVehicleId(EntityId vid) noexcept { m_VehicleId = vid; }
-    void SetType(EntityType type) { m_Type = type; }
+    void SetPosition(const Vector3d& pos) noexcept { m_Store->SetPosition(m_Handle, pos); }
+    void SetVelocity(const Vector3d& vel) noexcept { m_Store->SetVelocity(m_Handle, vel); }
+    void SetYaw(float yaw) noexcept { m_Store->SetYaw(m_Handle, yaw); }
+    void SetPitch(float pitch) noexcept { m_Store->SetPitch(m_Handle, pitch); }
+    void SetHeadPitch(float pitch) noexcept { m_Store->SetHeadPitch(m_Handle, pitch); }
+    void SetVehicleId(EntityId vid) noexcept { m_Store->SetVehicleId(m_Handle, vid); }
+    void SetType(EntityType type) { m_Store->SetType(m_Handle, type); }
     void SetMetadata(const EntityMetadata& metadata) { m_Metadata = metadata; }
+    void MergeMetadata(const EntityMetadata& delta) { m_Metadata.Merge(delta); }
 
     void SetAttribute(const std::wstring& key, const Attribute& attrib) { 
         m_Attributes.erase(key);
@@ -167,6 +80,9 @@ public:
     }
 
     void ClearAttributes() { m_Attributes.clear(); }
+
+    // Moves the state into a store of its own, for entities that outlive their place in a shared store.
+    void MCLIB_API Detach();
 };
 
 typedef std::shared_ptr<Entity> EntityPtr;
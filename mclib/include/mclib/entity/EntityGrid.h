@@ -0,0 +1,86 @@
+#ifndef MCLIB_ENTITY_ENTITY_GRID_H_
+#define MCLIB_ENTITY_ENTITY_GRID_H_
+
+#include <mclib/mclib.h>
+#include <mclib/common/AABB.h>
+#include <mclib/common/Types.h>
+#include <mclib/common/Vector.h>
+#include <mclib/entity/Entity.h>
+
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+namespace mc {
+namespace entity {
+
+/**
+ * Entity positions bucketed by chunk column, for finding the entities near a position without looking at all of them.
+ * Each column keeps its entities and their positions in one array, and empty columns are dropped.
+ * Queries that would look at more columns than there are occupied ones go through the occupied columns instead.
+ */
+class EntityGrid {
+public:
+    enum { CellSize = 16 };
+
+    // Accepts the candidates for Nearest
+    typedef std::function<bool(const EntityPtr&)> Filter;
+
+private:
+    struct Entry {
+        EntityId id;
+        Vector3d position;
+        EntityPtr entity;
+    };
+
+    struct Cell {
+        s64 x;
+        s64 z;
+        std::vector<Entry> entries;
+    };
+
+    // Cells stay where they are when the map rehashes, so entities can point at theirs.
+    struct Location {
+        Cell* cell;
+        std::size_t index;
+    };
+
+    std::unordered_map<u64, Cell> m_Cells;
+    std::unordered_map<EntityId, Location> m_Locations;
+
+    static s64 GetCellCoord(double coord) noexcept { return (s64)std::floor(coord / CellSize); }
+    static u64 GetCellKey(s64 x, s64 z) noexcept { return ((u64)(x & 0xFFFFFFFF) << 32) | (u64)(z & 0xFFFFFFFF); }
+
+    void RemoveEntry(const Location& location);
+    // Calls visitor with every occupied cell that overlaps bounds horizontally.
+    template <typename Visitor>
+    void ForEachCell(const AABB& bounds, Visitor visitor) const;
+
+public:
+    // Adds the entity, or moves it if it's already in the grid.
+    void MCLIB_API Update(const EntityPtr& entity, const Vector3d& position);
+    void MCLIB_API Remove(EntityId id);
+    void MCLIB_API Clear();
+
+    std::size_t GetSize() const noexcept { return m_Locations.size(); }
+    std::size_t GetCellCount() const noexcept { return m_Cells.size(); }
+
+    // Appends the entities inside of bounds, edges included.
+    void MCLIB_API QueryAABB(const AABB& bounds, std::vector<EntityPtr>& result) const;
+    // Appends the entities within radius of center.
+    void MCLIB_API QueryRadius(const Vector3d& center, double radius, std::vector<EntityPtr>& result) const;
+
+    /**
+     * Closest entity to position within maxDistance that filter accepts, or null if there's none.
+     * Columns are searched in rings around position, and the filter is only asked about entities closer than the best so far.
+     */
+    EntityPtr MCLIB_API Nearest(const Vector3d& position, const Filter& filter,
+        double maxDistance = std::numeric_limits<double>::infinity()) const;
+};
+
+} // ns entity
+} // ns mc
+
+#endif
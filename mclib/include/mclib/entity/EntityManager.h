@@ -3,12 +3,18 @@
 
 #include <mclib/mclib.h>
 #include <mclib/entity/Entity.h>
+#include <mclib/entity/EntityGrid.h>
+#include <mclib/entity/EntitySnapshot.h>
+#include <mclib/entity/EntityStore.h>
 #include <mclib/entity/Player.h>
 #include <mclib/protocol/packets/Packet.h>
 #include <mclib/protocol/packets/PacketHandler.h>
 #include <mclib/util/ObserverSubject.h>
 
 #include <array>
+#include <atomic>
+#include <functional>
+#include <limits>
 #include <unordered_map>
 
 namespace mc {
@@ -28,14 +34,37 @@ public:
 class EntityManager : public protocol::packets::PacketHandler, public util::ObserverSubject<EntityListener> {
 public:
     using EntityMap = std::unordered_map<EntityId, EntityPtr>;
+    using EntityMoveEvent = util::Event<const EntityPtr&, const Vector3d&, const Vector3d&>;
     using iterator = EntityMap::iterator;
     using const_iterator = EntityMap::const_iterator;
 
 private:
     std::unordered_map<EntityId, EntityPtr> m_Entities;
+    // Position, rotation and the other fields that packets keep changing, packed for every entity in m_Entities
+    EntityStorePtr m_Store;
     // Entity Id for the client player
     EntityId m_EntityId;
     protocol::Version m_ProtocolVersion;
+    EntityMoveEvent m_EntityMoveEvent;
+    // Positions of every entity in m_Entities
+    EntityGrid m_Grid;
+
+    // Only accessed with std::atomic_load/atomic_store
+    EntitySnapshotPtr m_Snapshot;
+    mutable std::atomic<bool> m_SnapshotRequested;
+    bool m_SnapshotDirty;
+
+    void NotifyEntityMove(const EntityPtr& entity, const Vector3d& oldPos, const Vector3d& newPos);
+
+    // Allocates the entity from the store's pool and keeps its state in the store.
+    template <typename T, typename... Args>
+    std::shared_ptr<T> CreateEntity(EntityId eid, Args&&... args) {
+        return std::allocate_shared<T>(EntityAllocator<T>(m_Store), eid, std::forward<Args>(args)..., m_ProtocolVersion, m_Store);
+    }
+
+    // Adds the entity, replacing any entity with the same id.
+    void AddEntity(EntityId eid, const EntityPtr& entity);
+    void RemoveEntity(EntityMap::iterator iter);
 
 public:
     MCLIB_API EntityManager(protocol::packets::PacketDispatcher* dispatcher, protocol::Version protocolVersion);
@@ -59,6 +88,42 @@ public:
         return iter->second;
     }
 
+    /**
+     * Packed state of every entity, for going through all of them without touching the Entity objects.
+     * Handles from Entity::GetHandle stay valid until the entity is removed.
+     */
+    const EntityStore& GetStore() const noexcept { return *m_Store; }
+
+    // Receives every entity move without the shared_ptr copies that EntityListener::OnEntityMove makes.
+    EntityMoveEvent& GetEntityMoveEvent() noexcept { return m_EntityMoveEvent; }
+
+    /**
+     * Returns the latest published snapshot. Can be called from any thread.
+     * Snapshots are only built after the first call, so that first call returns an empty snapshot.
+     */
+    EntitySnapshotPtr MCLIB_API GetSnapshot() const;
+
+    /**
+     * Publishes a new snapshot if any entity changed since the last call. Call from the thread that handles packets.
+     */
+    void MCLIB_API PublishSnapshot();
+
+    // Call after changing an entity outside of the packet handlers so the next publish picks it up.
+    void InvalidateSnapshot() noexcept { m_SnapshotDirty = true; }
+
+    // Call after moving an entity outside of the packet handlers so the queries and the next publish pick it up.
+    void MCLIB_API UpdatePosition(EntityId eid);
+
+    // Entities within radius of center.
+    std::vector<EntityPtr> MCLIB_API QueryRadius(const Vector3d& center, double radius) const;
+    // Entities inside of bounds, edges included.
+    std::vector<EntityPtr> MCLIB_API QueryAABB(const AABB& bounds) const;
+    // Closest entity to position within maxDistance that filter accepts, or null if there's none.
+    EntityPtr MCLIB_API Nearest(const Vector3d& position, const std::function<bool(const EntityPtr&)>& filter,
+        double maxDistance = std::numeric_limits<double>::infinity()) const;
+
+    const EntityGrid& GetGrid() const noexcept { return m_Grid; }
+
     iterator begin() { return m_Entities.begin(); }
     iterator end() { return m_Entities.end(); }
 
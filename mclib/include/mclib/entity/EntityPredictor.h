@@ -0,0 +1,107 @@
+#ifndef MCLIB_ENTITY_ENTITY_PREDICTOR_H_
+#define MCLIB_ENTITY_ENTITY_PREDICTOR_H_
+
+#include <mclib/mclib.h>
+#include <mclib/common/Types.h>
+#include <mclib/common/Vector.h>
+#include <mclib/entity/EntityManager.h>
+#include <mclib/util/EventBus.h>
+
+#include <unordered_map>
+#include <vector>
+
+namespace mc {
+namespace entity {
+
+/**
+ * Estimates where entities are between and after their movement packets.
+ * Every move is recorded with the time it arrived, and the velocity is measured over the recent moves.
+ * Times before the last move are interpolated between the recorded positions, later times are extrapolated
+ * with the velocity for a short while and then ease back to the last move, since entities that stop moving stop sending packets.
+ *
+ * The latest position and velocity of every tracked entity are kept as one array per axis,
+ * so PredictAll extrapolates the whole set with SIMD. Times are in milliseconds, like util::GetTime.
+ */
+class EntityPredictor : public EntityListener {
+public:
+    enum { HistorySize = 8 };
+
+private:
+    struct Sample {
+        s64 time;
+        Vector3d position;
+    };
+
+    EntityManager* m_EntityManager;
+    util::EventSubscription m_MoveSubscription;
+    s64 m_MaxExtrapolation;
+    s64 m_VelocityWindow;
+    // Latest sample time of any entity, so PredictAll knows when nothing needs interpolating
+    s64 m_LatestTime;
+
+    std::unordered_map<EntityId, u32> m_Indices;
+
+    // By index
+    std::vector<EntityId> m_Ids;
+    std::vector<double> m_Times;
+    std::vector<double> m_X;
+    std::vector<double> m_Y;
+    std::vector<double> m_Z;
+    // Blocks per millisecond
+    std::vector<double> m_VelocityX;
+    std::vector<double> m_VelocityY;
+    std::vector<double> m_VelocityZ;
+    // HistorySize samples for each index, written round robin
+    std::vector<Sample> m_History;
+    std::vector<u8> m_HistoryCount;
+    // Newest sample of each index
+    std::vector<u8> m_HistoryHead;
+
+    void OnMove(const EntityPtr& entity, const Vector3d& oldPos, const Vector3d& newPos);
+    void UpdateVelocity(std::size_t index);
+    Vector3d Predict(std::size_t index, s64 time) const;
+
+public:
+    MCLIB_API EntityPredictor(EntityManager* entityManager);
+    MCLIB_API ~EntityPredictor();
+
+    EntityPredictor(const EntityPredictor& rhs) = delete;
+    EntityPredictor& operator=(const EntityPredictor& rhs) = delete;
+
+    // Records that the entity was at position at time. Moves are recorded automatically.
+    void MCLIB_API AddSample(EntityId eid, const Vector3d& position, s64 time);
+    void MCLIB_API Remove(EntityId eid);
+    void MCLIB_API Clear();
+
+    bool IsTracked(EntityId eid) const { return m_Indices.find(eid) != m_Indices.end(); }
+    std::size_t GetSize() const noexcept { return m_Ids.size(); }
+    // Tracked entities, in the order PredictAll uses
+    const std::vector<EntityId>& GetIds() const noexcept { return m_Ids; }
+
+    /**
+     * Stores the estimated position of the entity at time in position.
+     * Entities that haven't moved since they were tracked are where the EntityManager has them.
+     * Returns false if the entity doesn't exist.
+     */
+    bool MCLIB_API PredictPosition(EntityId eid, s64 time, Vector3d* position) const;
+    // Estimated positions of every tracked entity at time, in the order of GetIds().
+    void MCLIB_API PredictAll(s64 time, std::vector<Vector3d>& positions) const;
+    // Blocks per second. Zero for entities that aren't tracked.
+    Vector3d MCLIB_API GetVelocity(EntityId eid) const;
+
+    // How long past the last move positions keep being extrapolated. They return to the last move over the same time after that.
+    void SetMaxExtrapolation(s64 milliseconds) noexcept { m_MaxExtrapolation = milliseconds; }
+    s64 GetMaxExtrapolation() const noexcept { return m_MaxExtrapolation; }
+    // How far back from the last move the velocity is measured. Longer windows smooth out packets that arrive in bursts.
+    void SetVelocityWindow(s64 milliseconds) noexcept { m_VelocityWindow = milliseconds; }
+    s64 GetVelocityWindow() const noexcept { return m_VelocityWindow; }
+
+    void MCLIB_API OnEntitySpawn(EntityPtr entity) override;
+    void MCLIB_API OnObjectSpawn(EntityPtr entity) override;
+    void MCLIB_API OnEntityDestroy(EntityPtr entity) override;
+};
+
+} // ns entity
+} // ns mc
+
+#endif
@@ -0,0 +1,65 @@
+#ifndef MCLIB_ENTITY_ENTITY_SNAPSHOT_H_
+#define MCLIB_ENTITY_ENTITY_SNAPSHOT_H_
+
+#include <mclib/mclib.h>
+#include <mclib/common/Types.h>
+#include <mclib/common/Vector.h>
+#include <mclib/entity/Entity.h>
+
+#include <memory>
+#include <vector>
+
+namespace mc {
+namespace entity {
+
+/**
+ * The parts of an entity that readers on other threads care about, copied by value.
+ */
+struct EntityState {
+    EntityId id;
+    EntityType type;
+    EntityId vehicleId;
+    Vector3d position;
+    Vector3d velocity;
+    // Stored in radians
+    float yaw;
+    float pitch;
+    float headPitch;
+};
+
+/**
+ * Immutable copy of every entity's state at the time it was published.
+ * Safe to read from any thread while the packet thread keeps updating the EntityManager.
+ */
+class EntitySnapshot {
+public:
+    typedef std::vector<EntityState>::const_iterator const_iterator;
+
+private:
+    // Sorted by id
+    std::vector<EntityState> m_Entities;
+    EntityId m_PlayerId;
+    u64 m_Version;
+
+    friend class EntityManager;
+
+public:
+    MCLIB_API EntitySnapshot();
+
+    u64 GetVersion() const noexcept { return m_Version; }
+    std::size_t GetSize() const noexcept { return m_Entities.size(); }
+
+    // Returns nullptr if the entity didn't exist when the snapshot was published.
+    MCLIB_API const EntityState* GetEntity(EntityId eid) const;
+    const EntityState* GetPlayerEntity() const { return GetEntity(m_PlayerId); }
+
+    const_iterator begin() const { return m_Entities.begin(); }
+    const_iterator end() const { return m_Entities.end(); }
+};
+
+typedef std::shared_ptr<const EntitySnapshot> EntitySnapshotPtr;
+
+} // ns entity
+} // ns mc
+
+#endif
@@ -0,0 +1,161 @@
+#ifndef MCLIB_ENTITY_ENTITY_STORE_H_
+#define MCLIB_ENTITY_ENTITY_STORE_H_
+
+#include <mclib/mclib.h>
+#include <mclib/common/Types.h>
+#include <mclib/common/Vector.h>
+#include <mclib/entity/EntityType.h>
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace mc {
+namespace entity {
+
+/**
+ * Refers to an entity in an EntityStore.
+ * The slot can be reused once the entity is gone, but the generation won't match anymore.
+ */
+struct EntityHandle {
+    u32 slot;
+    u32 generation;
+
+    bool operator==(const EntityHandle& other) const noexcept { return slot == other.slot && generation == other.generation; }
+    bool operator!=(const EntityHandle& other) const noexcept { return !(*this == other); }
+};
+
+/**
+ * The fields of entities that change with every movement packet, kept as one packed array per field.
+ * Entities are swapped into the holes that removals leave, so iterating the arrays only visits live entities.
+ * Handles go through a slot table, which keeps them valid while entities move around in the arrays.
+ *
+ * The store also pools the memory of the Entity objects themselves, which keep the rest of the entity data.
+ * Only the pool is safe to use from several threads.
+ */
+class EntityStore {
+private:
+    struct BlockPool {
+        std::size_t size;
+        std::size_t blocks;
+        std::vector<void*> free;
+    };
+
+    // By slot
+    std::vector<u32> m_Indices;
+    std::vector<u32> m_Generations;
+    std::vector<u32> m_FreeSlots;
+
+    // By index
+    std::vector<u32> m_Slots;
+    std::vector<EntityId> m_Ids;
+    std::vector<Vector3d> m_Positions;
+    std::vector<Vector3d> m_Velocities;
+    // Stored in radians
+    std::vector<float> m_Yaws;
+    std::vector<float> m_Pitches;
+    std::vector<float> m_HeadPitches;
+    std::vector<EntityType> m_Types;
+    std::vector<EntityId> m_VehicleIds;
+
+    std::mutex m_PoolMutex;
+    std::vector<BlockPool> m_Pools;
+    std::vector<void*> m_Chunks;
+
+public:
+    MCLIB_API EntityStore();
+    MCLIB_API ~EntityStore();
+
+    EntityStore(const EntityStore& rhs) = delete;
+    EntityStore& operator=(const EntityStore& rhs) = delete;
+
+    // Adds an entity that stands still at the origin.
+    EntityHandle MCLIB_API Create(EntityId id);
+    void MCLIB_API Destroy(EntityHandle handle);
+
+    bool IsValid(EntityHandle handle) const noexcept {
+        return handle.slot < m_Generations.size() && m_Generations[handle.slot] == handle.generation;
+    }
+
+    // Index of a valid handle's entity in the arrays. Changes when other entities are destroyed.
+    std::size_t GetIndex(EntityHandle handle) const noexcept { return m_Indices[handle.slot]; }
+    std::size_t GetSize() const noexcept { return m_Ids.size(); }
+
+    // Copies everything but the id.
+    void MCLIB_API CopyState(EntityHandle handle, const EntityStore& from, EntityHandle fromHandle);
+
+    EntityId GetId(EntityHandle handle) const noexcept { return m_Ids[GetIndex(handle)]; }
+    const Vector3d& GetPosition(EntityHandle handle) const noexcept { return m_Positions[GetIndex(handle)]; }
+    const Vector3d& GetVelocity(EntityHandle handle) const noexcept { return m_Velocities[GetIndex(handle)]; }
+    float GetYaw(EntityHandle handle) const noexcept { return m_Yaws[GetIndex(handle)]; }
+    float GetPitch(EntityHandle handle) const noexcept { return m_Pitches[GetIndex(handle)]; }
+    float GetHeadPitch(EntityHandle handle) const noexcept { return m_HeadPitches[GetIndex(handle)]; }
+    EntityType GetType(EntityHandle handle) const noexcept { return m_Types[GetIndex(handle)]; }
+    EntityId GetVehicleId(EntityHandle handle) const noexcept { return m_VehicleIds[GetIndex(handle)]; }
+
+    void SetId(EntityHandle handle, EntityId id) noexcept { m_Ids[GetIndex(handle)] = id; }
+    void SetPosition(EntityHandle handle, const Vector3d& position) noexcept { m_Positions[GetIndex(handle)] = position; }
+    void SetVelocity(EntityHandle handle, const Vector3d& velocity) noexcept { m_Velocities[GetIndex(handle)] = velocity; }
+    void SetYaw(EntityHandle handle, float yaw) noexcept { m_Yaws[GetIndex(handle)] = yaw; }
+    void SetPitch(EntityHandle handle, float pitch) noexcept { m_Pitches[GetIndex(handle)] = pitch; }
+    void SetHeadPitch(EntityHandle handle, float pitch) noexcept { m_HeadPitches[GetIndex(handle)] = pitch; }
+    void SetType(EntityHandle handle, EntityType type) noexcept { m_Types[GetIndex(handle)] = type; }
+    void SetVehicleId(EntityHandle handle, EntityId vid) noexcept { m_VehicleIds[GetIndex(handle)] = vid; }
+
+    // The packed arrays, in the same order
+    const std::vector<EntityId>& GetIds() const noexcept { return m_Ids; }
+    const std::vector<Vector3d>& GetPositions() const noexcept { return m_Positions; }
+    const std::vector<Vector3d>& GetVelocities() const noexcept { return m_Velocities; }
+    const std::vector<float>& GetYaws() const noexcept { return m_Yaws; }
+    const std::vector<float>& GetPitches() const noexcept { return m_Pitches; }
+    const std::vector<float>& GetHeadPitches() const noexcept { return m_HeadPitches; }
+    const std::vector<EntityType>& GetTypes() const noexcept { return m_Types; }
+    const std::vector<EntityId>& GetVehicleIds() const noexcept { return m_VehicleIds; }
+
+    // Pooled memory for objects of one size. Freed blocks are kept for the next allocation of that size.
+    MCLIB_API void* Allocate(std::size_t size);
+    void MCLIB_API Deallocate(void* block, std::size_t size) noexcept;
+};
+
+typedef std::shared_ptr<EntityStore> EntityStorePtr;
+
+/**
+ * Allocates from an EntityStore's pool, for use with std::allocate_shared.
+ * Every copy keeps the store alive, so objects can outlive whoever created them.
+ */
+template <typename T>
+class EntityAllocator {
+private:
+    EntityStorePtr m_Store;
+
+    template <typename U>
+    friend class EntityAllocator;
+
+public:
+    typedef T value_type;
+
+    EntityAllocator(EntityStorePtr store) noexcept : m_Store(std::move(store)) { }
+
+    template <typename U>
+    EntityAllocator(const EntityAllocator<U>& other) noexcept : m_Store(other.m_Store) { }
+
+    T* allocate(std::size_t count) {
+        static_assert(alignof(T) <= alignof(std::max_align_t), "Pooled objects can't be over-aligned");
+        return static_cast<T*>(m_Store->Allocate(count * sizeof(T)));
+    }
+
+    void deallocate(T* block, std::size_t count) noexcept {
+        m_Store->Deallocate(block, count * sizeof(T));
+    }
+
+    template <typename U>
+    bool operator==(const EntityAllocator<U>& other) const noexcept { return m_Store == other.m_Store; }
+    template <typename U>
+    bool operator!=(const EntityAllocator<U>& other) const noexcept { return m_Store != other.m_Store; }
+};
+
+} // ns entity
+} // ns mc
+
+#endif
@@ -0,0 +1,108 @@
+#ifndef MCLIB_ENTITY_ENTITY_TYPE_H_
+#define MCLIB_ENTITY_ENTITY_TYPE_H_
+
+namespace mc {
+namespace entity {
+
+enum class EntityType {
+    Item = 1,
+    XPOrb,
+    AreaEffectCloud,
+    ElderGuardian,
+    WitherSkeleton,
+    Stray,
+    ThrownEgg,
+    LeashKnot,
+    Painting,
+    Arrow,
+    Snowball,
+    Fireball,
+    SmallFireball,
+    ThrownEnderpearl,
+    EyeOfEnderSignal,
+    ThrownPotion,
+    ThrownExpBottle,
+    ItemFrame,
+    WitherSkull,
+    PrimedTnt,
+    FallingSand,
+    FireworksRocketEntity,
+    Husk,
+    SpectralArrow,
+    ShulkerBullet,
+    DragonFireball,
+    ZombieVillager,
+    SkeletonHorse,
+    ZombieHorse,
+    ArmorStand,
+    Donkey,
+    Mule,
+    EvocationFangs,
+    EvocationIllager,
+    Vex,
+    VindicationIllager,
+    IllusionIllager,
+
+    MinecartCommandBlock = 40,
+    Boat,
+    MinecartRideable,
+    MinecartChest,
+    MinecartFurnace,
+    MinecartTNT,
+    MinecartHopper,
+    MinecartSpawner,
+
+    Creeper = 50,
+    Skeleton,
+    Spider,
+    Giant,
+    Zombie,
+    Slime,
+    Ghast,
+    PigZombie,
+    Enderman,
+    CaveSpider,
+    Silverfish,
+    Blaze,
+    LavaSlime,
+    EnderDragon,
+    WitherBoss,
+    Bat,
+    Witch,
+    Endermite,
+    Guardian,
+    Shulker,
+
+    Pig = 90,
+    Sheep,
+    Cow,
+    Chicken,
+    Squid,
+    Wolf,
+    Mooshroom,
+    SnowMan,
+    Ocelot,
+    IronGolem,
+    Horse,
+    Rabbit,
+    PolarBear,
+    Llama,
+    LlamaSpit,
+    Parrot,
+
+    Villager = 120,
+
+    EnderCrystal = 200,
+
+    // Not part of protocol
+    Lightning= 251,
+    FallingObject = 252,
+    FishingHook = 253,
+    Player = 254,
+    Unknown
+};
+
+} // ns entity
+} // ns mc
+
+#endif
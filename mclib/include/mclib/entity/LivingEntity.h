@@ -12,6 +12,7 @@ private:
 
 public:
     LivingEntity(EntityId id, protocol::Version protocolVersion) : Entity(id, protocolVersion) { }
+    LivingEntity(EntityId id, protocol::Version protocolVersion, EntityStorePtr store) : Entity(id, protocolVersion, std::move(store)) { }
 
     float GetHealth() const { return m_Health; }
 };
@@ -9,6 +9,7 @@
 
 #include <array>
 #include <memory>
+#include <vector>
 
 namespace mc {
 
@@ -18,10 +19,8 @@ namespace entity {
 
 class EntityMetadata {
 public:
-    class Type {
-    public:
-        virtual ~Type() { }
-    };
+    // Base of the value types. The values are stored by value inside the metadata, so this has no virtual members.
+    struct Type { };
 
     struct ByteType : public Type {
         u8 value;
@@ -58,7 +57,7 @@ public:
         SlotType() = default;
         SlotType(const inventory::Slot& value) : value(value) { }
 
-        DataBuffer Serialize(mc::protocol::Version protocolVersion);
+        DataBuffer Serialize(mc::protocol::Version protocolVersion) const;
         void Deserialize(DataBuffer& in, mc::protocol::Version protocolVersion);
     };
 
@@ -100,26 +99,99 @@ public:
     };
 
 private:
-    enum DataType { Byte, VarInt, Float, String, Chat, OptChat, Slot, Boolean, Rotation, Position, OptPosition, Direction, OptUUID, OptBlockID, NBT, Particle, None };
+    enum DataType : u8 { Byte, VarInt, Float, String, Chat, OptChat, Slot, Boolean, Rotation, Position, OptPosition, Direction, OptUUID, OptBlockID, NBT, Particle, None };
+
+    // Which member of Field's union holds the value for a DataType.
+    enum class Kind : u8 { None, Byte, VarInt, Float, String, Slot, Boolean, Rotation, Position, UUID, NBT };
+
+    /**
+     * One metadata value stored as a tagged union.
+     * Small values live inline, strings, slots and NBT are kept out of line because of their size.
+     */
+    struct Field {
+        DataType type;
+
+        union {
+            ByteType byte;
+            VarIntType varInt;
+            FloatType floatValue;
+            BooleanType boolean;
+            RotationType rotation;
+            PositionType position;
+            UUIDType uuid;
+            StringType* string;
+            SlotType* slot;
+            NBTType* nbt;
+        };
+
+        Field() noexcept : type(DataType::None), string(nullptr) { }
+        MCLIB_API Field(const Field& other);
+        MCLIB_API Field(Field&& other) noexcept;
+        MCLIB_API Field& operator=(const Field& other);
+        MCLIB_API Field& operator=(Field&& other) noexcept;
+        ~Field() { Reset(); }
+
+        bool IsSet() const noexcept { return type != DataType::None; }
+        MCLIB_API const void* Get() const noexcept;
+
+        void MCLIB_API Reset() noexcept;
+        // Changes the stored type, reusing the out of line storage when the kind doesn't change.
+        void MCLIB_API SetType(DataType newType);
+    };
 
     enum { MetadataCount = 0xFE };
-    std::array<std::pair<std::unique_ptr<Type>, DataType>, MetadataCount> m_Metadata;
+    // Indices below this are stored directly in m_Fields. Vanilla entities never go above it.
+    enum { InlineCount = 32 };
+
+    std::array<Field, InlineCount> m_Fields;
+    std::vector<std::pair<u8, Field>> m_Overflow;
+    u32 m_Present;
     protocol::Version m_ProtocolVersion;
 
-    void CopyOther(const EntityMetadata& other);
+    static Kind MCLIB_API GetKind(DataType type) noexcept;
+
+    static constexpr Kind KindOf(const ByteType*) { return Kind::Byte; }
+    static constexpr Kind KindOf(const VarIntType*) { return Kind::VarInt; }
+    static constexpr Kind KindOf(const FloatType*) { return Kind::Float; }
+    static constexpr Kind KindOf(const StringType*) { return Kind::String; }
+    static constexpr Kind KindOf(const SlotType*) { return Kind::Slot; }
+    static constexpr Kind KindOf(const BooleanType*) { return Kind::Boolean; }
+    static constexpr Kind KindOf(const RotationType*) { return Kind::Rotation; }
+    static constexpr Kind KindOf(const PositionType*) { return Kind::Position; }
+    static constexpr Kind KindOf(const UUIDType*) { return Kind::UUID; }
+    static constexpr Kind KindOf(const NBTType*) { return Kind::NBT; }
+
+    MCLIB_API const Field* FindField(std::size_t index) const noexcept;
+    MCLIB_API Field& GetOrCreateField(std::size_t index);
+
 public:
     MCLIB_API EntityMetadata(protocol::Version protocolVersion);
 
-    MCLIB_API EntityMetadata(const EntityMetadata& rhs);
-    MCLIB_API EntityMetadata& operator=(const EntityMetadata& rhs);
-    MCLIB_API EntityMetadata(EntityMetadata&& rhs) = default;
-    MCLIB_API EntityMetadata& operator=(EntityMetadata&& rhs) = default;
+    EntityMetadata(const EntityMetadata& rhs) = default;
+    EntityMetadata& operator=(const EntityMetadata& rhs) = default;
+    EntityMetadata(EntityMetadata&& rhs) = default;
+    EntityMetadata& operator=(EntityMetadata&& rhs) = default;
 
     template <typename T>
-    T* GetIndex(std::size_t index) const {
-        return dynamic_cast<T*>(m_Metadata[index].first.get());
+    const T* GetIndex(std::size_t index) const {
+        const Field* field = FindField(index);
+
+        if (!field || GetKind(field->type) != KindOf(static_cast<const T*>(nullptr)))
+            return nullptr;
+
+        return static_cast<const T*>(field->Get());
     }
 
+    bool HasIndex(std::size_t index) const noexcept { return FindField(index) != nullptr; }
+
+    /**
+     * Applies the values set in delta on top of this metadata.
+     * Metadata packets only carry the indices that changed, so this keeps the rest intact.
+     */
+    void MCLIB_API Merge(const EntityMetadata& delta);
+
+    void MCLIB_API Clear() noexcept;
+
     void MCLIB_API SetProtocolVersion(protocol::Version version) { m_ProtocolVersion = version; }
 
     friend MCLIB_API DataBuffer& operator<<(DataBuffer& out, const EntityMetadata& metadata);
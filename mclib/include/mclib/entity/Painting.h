@@ -17,6 +17,7 @@ private:
 
 public:
     PaintingEntity(EntityId eid, protocol::Version protocolVersion) : Entity(eid, protocolVersion), m_Title(L""), m_Direction(Direction::South) { SetType(EntityType::Painting); }
+    PaintingEntity(EntityId eid, protocol::Version protocolVersion, EntityStorePtr store) : Entity(eid, protocolVersion, std::move(store)), m_Title(L""), m_Direction(Direction::South) { SetType(EntityType::Painting); }
 
     const std::wstring& GetTitle() const noexcept { return m_Title; }
     Direction GetDirection() const noexcept { return m_Direction; }
@@ -9,6 +9,7 @@ namespace entity {
 class PlayerEntity : public LivingEntity {
 public:
     PlayerEntity(EntityId id, protocol::Version protocolVersion) : LivingEntity(id, protocolVersion) { }
+    PlayerEntity(EntityId id, protocol::Version protocolVersion, EntityStorePtr store) : LivingEntity(id, protocolVersion, std::move(store)) { }
 };
 
 typedef std::weak_ptr<PlayerEntity> PlayerEntityPtr;
@@ -13,6 +13,7 @@ private:
 public:
     XPOrb(EntityId eid, protocol::Version protocolVersion) : Entity(eid, protocolVersion), m_Count(0) { SetType(EntityType::XPOrb); }
     XPOrb(EntityId eid, u16 count, protocol::Version protocolVersion) : Entity(eid, protocolVersion), m_Count(count) { SetType(EntityType::XPOrb); }
+    XPOrb(EntityId eid, u16 count, protocol::Version protocolVersion, EntityStorePtr store) : Entity(eid, protocolVersion, std::move(store)), m_Count(count) { SetType(EntityType::XPOrb); }
 
     inline u16 GetCount() const noexcept { return m_Count; }
     void SetCount(u16 count) { m_Count = count; }
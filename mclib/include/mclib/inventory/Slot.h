@@ -10,6 +10,12 @@ namespace mc {
 
 class DataBuffer;
 
+namespace nbt {
+
+class Builder;
+
+} // ns nbt
+
 namespace inventory {
 
 class Slot {
@@ -42,6 +48,11 @@ public:
     static MCLIB_API Slot FromNBT(nbt::TagCompound& compound);
 
     DataBuffer Serialize(protocol::Version version) const;
+
+    /**
+     * Writes an item whose NBT was made with an nbt::Builder, without building an nbt::NBT tree.
+     */
+    static MCLIB_API void Serialize(DataBuffer& out, s32 itemId, u8 itemCount, s16 itemDamage, const nbt::Builder& nbt, protocol::Version version);
     void Deserialize(DataBuffer& in, protocol::Version version);
 };
 
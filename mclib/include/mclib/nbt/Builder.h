@@ -0,0 +1,207 @@
+#ifndef MCLIB_NBT_BUILDER_H_
+#define MCLIB_NBT_BUILDER_H_
+
+#include <mclib/mclib.h>
+#include <mclib/common/Types.h>
+#include <mclib/nbt/Tag.h>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace mc {
+
+class DataBuffer;
+
+namespace nbt {
+
+/**
+ * Bump allocator that hands out memory from fixed-size blocks.
+ * Reset keeps the blocks around so a reused arena stops touching the heap.
+ */
+class Arena {
+private:
+    std::vector<std::unique_ptr<u8[]>> m_Blocks;
+    std::vector<std::unique_ptr<u8[]>> m_LargeBlocks;
+    std::size_t m_BlockSize;
+    std::size_t m_CurrentBlock;
+    std::size_t m_Offset;
+
+public:
+    MCLIB_API Arena(std::size_t blockSize = 4096);
+
+    Arena(const Arena& rhs) = delete;
+    Arena& operator=(const Arena& rhs) = delete;
+    Arena(Arena&& rhs) = default;
+    Arena& operator=(Arena&& rhs) = default;
+
+    MCLIB_API void* Allocate(std::size_t size, std::size_t alignment);
+
+    template <typename T>
+    T* Allocate(std::size_t count = 1) {
+        return static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+    }
+
+    void MCLIB_API Reset();
+    std::size_t MCLIB_API GetCapacity() const;
+};
+
+/**
+ * Handle to a name stored in a KeyTable.
+ */
+class Key {
+private:
+    u32 m_Id;
+
+public:
+    enum : u32 { None = 0xFFFFFFFF };
+
+    Key() noexcept : m_Id(None) { }
+    explicit Key(u32 id) noexcept : m_Id(id) { }
+
+    u32 GetId() const noexcept { return m_Id; }
+    bool IsValid() const noexcept { return m_Id != None; }
+
+    bool operator==(Key other) const noexcept { return m_Id == other.m_Id; }
+    bool operator!=(Key other) const noexcept { return m_Id != other.m_Id; }
+};
+
+/**
+ * Interns tag names and keeps them already encoded the way they go on the wire
+ * (u16 big endian length followed by utf-8), so writing a name is a single copy.
+ * A table can be shared by any number of builders.
+ */
+class KeyTable {
+private:
+    std::unordered_map<std::string, u32> m_Lookup;
+    std::vector<std::string> m_Encoded;
+
+public:
+    MCLIB_API KeyTable();
+
+    Key MCLIB_API Intern(const std::string& utf8);
+    Key MCLIB_API Intern(const std::wstring& name);
+
+    // Returns an invalid key if the name was never interned.
+    Key MCLIB_API Find(const std::string& utf8) const;
+
+    std::string MCLIB_API GetName(Key key) const;
+    const std::string& GetEncoded(Key key) const { return m_Encoded[key.GetId()]; }
+    std::size_t GetSize() const noexcept { return m_Encoded.size(); }
+};
+
+/**
+ * A node in a Builder tree. Nodes live in the builder's arena and are only valid until the builder is reset.
+ */
+struct BuilderNode {
+    TagType type;
+    TagType listType;
+    Key key;
+    BuilderNode* next;
+
+    union {
+        s64 integer;
+        float f;
+        double d;
+
+        struct {
+            BuilderNode* first;
+            BuilderNode* last;
+            u32 count;
+        } children;
+
+        struct {
+            const void* data;
+            u32 length;
+        } array;
+    } value;
+};
+
+/**
+ * Mutable NBT tree that stores every node and value in an arena.
+ * Building an item's NBT and writing it out doesn't allocate once the arena and key table are warm,
+ * which matters when items are created by the thousand.
+ *
+ * Values added to a list ignore the key and must match the list type.
+ */
+class Builder {
+private:
+    Arena m_Arena;
+    std::unique_ptr<KeyTable> m_OwnedKeys;
+    KeyTable* m_Keys;
+    BuilderNode* m_Root;
+    std::size_t m_Size;
+
+    BuilderNode* CreateNode(BuilderNode* parent, TagType type, Key key);
+    void MCLIB_API WriteNode(u8*& out, const BuilderNode* node, bool named) const;
+    TagPtr MCLIB_API ToTag(const BuilderNode* node) const;
+
+public:
+    MCLIB_API Builder(std::size_t blockSize = 4096);
+    MCLIB_API Builder(KeyTable& keys, std::size_t blockSize = 4096);
+
+    Builder(const Builder& rhs) = delete;
+    Builder& operator=(const Builder& rhs) = delete;
+
+    KeyTable& GetKeys() noexcept { return *m_Keys; }
+    BuilderNode* GetRoot() noexcept { return m_Root; }
+    const BuilderNode* GetRoot() const noexcept { return m_Root; }
+
+    void MCLIB_API SetRootName(Key key);
+    void SetRootName(const std::string& name) { SetRootName(m_Keys->Intern(name)); }
+
+    MCLIB_API BuilderNode* AddByte(BuilderNode* parent, Key key, u8 value);
+    MCLIB_API BuilderNode* AddShort(BuilderNode* parent, Key key, s16 value);
+    MCLIB_API BuilderNode* AddInt(BuilderNode* parent, Key key, s32 value);
+    MCLIB_API BuilderNode* AddLong(BuilderNode* parent, Key key, s64 value);
+    MCLIB_API BuilderNode* AddFloat(BuilderNode* parent, Key key, float value);
+    MCLIB_API BuilderNode* AddDouble(BuilderNode* parent, Key key, double value);
+    MCLIB_API BuilderNode* AddString(BuilderNode* parent, Key key, const std::string& utf8);
+    MCLIB_API BuilderNode* AddByteArray(BuilderNode* parent, Key key, const u8* data, std::size_t length);
+    MCLIB_API BuilderNode* AddIntArray(BuilderNode* parent, Key key, const s32* data, std::size_t length);
+    MCLIB_API BuilderNode* AddList(BuilderNode* parent, Key key, TagType listType);
+    MCLIB_API BuilderNode* AddCompound(BuilderNode* parent, Key key);
+
+    BuilderNode* AddIntArray(BuilderNode* parent, Key key, const std::vector<s32>& values) {
+        return AddIntArray(parent, key, values.data(), values.size());
+    }
+
+    // Convenience overloads that intern the name on every call.
+    BuilderNode* AddByte(BuilderNode* parent, const std::string& name, u8 value) { return AddByte(parent, m_Keys->Intern(name), value); }
+    BuilderNode* AddShort(BuilderNode* parent, const std::string& name, s16 value) { return AddShort(parent, m_Keys->Intern(name), value); }
+    BuilderNode* AddInt(BuilderNode* parent, const std::string& name, s32 value) { return AddInt(parent, m_Keys->Intern(name), value); }
+    BuilderNode* AddLong(BuilderNode* parent, const std::string& name, s64 value) { return AddLong(parent, m_Keys->Intern(name), value); }
+    BuilderNode* AddFloat(BuilderNode* parent, const std::string& name, float value) { return AddFloat(parent, m_Keys->Intern(name), value); }
+    BuilderNode* AddDouble(BuilderNode* parent, const std::string& name, double value) { return AddDouble(parent, m_Keys->Intern(name), value); }
+    BuilderNode* AddString(BuilderNode* parent, const std::string& name, const std::string& utf8) { return AddString(parent, m_Keys->Intern(name), utf8); }
+    BuilderNode* AddIntArray(BuilderNode* parent, const std::string& name, const std::vector<s32>& values) { return AddIntArray(parent, m_Keys->Intern(name), values); }
+    BuilderNode* AddList(BuilderNode* parent, const std::string& name, TagType listType) { return AddList(parent, m_Keys->Intern(name), listType); }
+    BuilderNode* AddCompound(BuilderNode* parent, const std::string& name) { return AddCompound(parent, m_Keys->Intern(name)); }
+
+    bool HasData() const noexcept { return m_Root->value.children.count > 0; }
+
+    // Exact number of bytes Write will produce. Kept up to date as nodes are added.
+    std::size_t GetSerializedSize() const noexcept { return m_Size; }
+
+    /**
+     * Writes the tree into a caller-provided buffer.
+     * Returns the number of bytes written, or 0 if capacity is too small.
+     */
+    std::size_t MCLIB_API Write(u8* buffer, std::size_t capacity) const;
+    // Appends the tree to out with a single resize.
+    void MCLIB_API Write(DataBuffer& out) const;
+
+    // Builds the equivalent shared_ptr tree for code that still needs nbt::NBT.
+    TagCompound MCLIB_API ToCompound() const;
+
+    // Drops every node but keeps the arena blocks and interned keys for reuse.
+    void MCLIB_API Reset();
+};
+
+MCLIB_API DataBuffer& operator<<(DataBuffer& out, const Builder& builder);
+
+} // ns nbt
+} // ns mc
+
+#endif
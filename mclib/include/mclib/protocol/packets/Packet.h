@@ -10,6 +10,7 @@
 #include <mclib/entity/Attribute.h>
 #include <mclib/entity/Metadata.h>
 #include <mclib/protocol/ProtocolState.h>
+#include <mclib/util/Chat.h>
 #include <mclib/world/Chunk.h>
 
 #include <map>
@@ -509,7 +510,10 @@ public:
     enum class ChatPosition { ChatBox, SystemMessage, Hotbar };
 
 private:
-    json m_ChatData;
+    // Raw utf-8 json. The DOM is only built if something asks for it.
+    std::string m_RawChatData;
+    mutable json m_ChatData;
+    mutable bool m_ChatDataParsed;
     ChatPosition m_Position;
 
 public:
@@ -518,7 +522,12 @@ public:
     void MCLIB_API Dispatch(PacketHandler* handler);
 
     ChatPosition GetChatPosition() const { return m_Position; }
-    const nlohmann::json& GetChatData() const { return m_ChatData; }
+    const std::string& GetRawChatData() const { return m_RawChatData; }
+    MCLIB_API const nlohmann::json& GetChatData() const;
+
+    // Parses the json straight into text and styled runs without building a DOM.
+    util::ChatMessage MCLIB_API GetChatMessage() const;
+    std::string MCLIB_API GetText() const;
 };
 
 class MultiBlockChangePacket : public InboundPacket { // 0x10
@@ -788,18 +797,32 @@ public:
     s64 GetAliveId() const { return m_AliveId; }
 };
 
+/**
+ * Only the column metadata is read when deserializing. The sections and block entities
+ * are decoded the first time the column is requested, so World can decode them on a worker thread instead.
+ */
 class ChunkDataPacket : public InboundPacket { // 0x20
 private:
-    world::ChunkColumnPtr m_ChunkColumn;
-    std::vector<block::BlockEntityPtr> m_BlockEntities;
+    world::ChunkColumnMetadata m_Metadata;
+    mutable DataBuffer m_ColumnData;
+    mutable world::ChunkColumnPtr m_ChunkColumn;
+    mutable std::vector<block::BlockEntityPtr> m_BlockEntities;
+
+    void Decode(const block::BlockRegistry* registry) const;
 
 public:
     MCLIB_API ChunkDataPacket();
     bool MCLIB_API Deserialize(DataBuffer& data, std::size_t packetLength);
     void MCLIB_API Dispatch(PacketHandler* handler);
 
-    world::ChunkColumnPtr GetChunkColumn() const { return m_ChunkColumn; }
-    const std::vector<block::BlockEntityPtr>& GetBlockEntities() const { return m_BlockEntities; }
+    const world::ChunkColumnMetadata& GetMetadata() const { return m_Metadata; }
+    // The undecoded sections, biomes and block entities, see ChunkColumn::Load.
+    const DataBuffer& GetColumnData() const { return m_ColumnData; }
+    bool IsDecoded() const { return m_ChunkColumn != nullptr; }
+
+    // Decodes with BlockRegistry::GetInstance() unless it's given a registry. Only the first call decodes.
+    world::ChunkColumnPtr GetChunkColumn(const block::BlockRegistry* registry = nullptr) const { Decode(registry); return m_ChunkColumn; }
+    const std::vector<block::BlockEntityPtr>& GetBlockEntities() const { Decode(nullptr); return m_BlockEntities; }
 };
 
 class EffectPacket : public InboundPacket { // 0x21
@@ -2062,9 +2085,12 @@ class CreativeInventoryActionPacket : public OutboundPacket { // 0x18
 private:
     s16 m_Slot;
     inventory::Slot m_Item;
+    const nbt::Builder* m_ItemNBT;
 
 public:
     MCLIB_API CreativeInventoryActionPacket(s16 slot, inventory::Slot item);
+    // The builder is only referenced, so it has to stay alive until the packet is sent.
+    MCLIB_API CreativeInventoryActionPacket(s16 slot, s32 itemId, u8 itemCount, s16 itemDamage, const nbt::Builder& nbt);
     DataBuffer MCLIB_API Serialize() const;
 };
 
@@ -0,0 +1,113 @@
+#ifndef MCLIB_UTIL_CHAT_H_
+#define MCLIB_UTIL_CHAT_H_
+
+#include <mclib/mclib.h>
+#include <mclib/common/Types.h>
+
+#include <string>
+#include <vector>
+
+namespace mc {
+namespace util {
+
+enum class ChatColor : u8 {
+    Black, DarkBlue, DarkGreen, DarkAqua, DarkRed, DarkPurple, Gold, Gray,
+    DarkGray, Blue, Green, Aqua, Red, LightPurple, Yellow, White, Reset
+};
+
+enum ChatFormat : u8 {
+    Bold = 0x01,
+    Italic = 0x02,
+    Underlined = 0x04,
+    Strikethrough = 0x08,
+    Obfuscated = 0x10
+};
+
+/**
+ * A piece of text that has the same style all the way through.
+ * The text itself lives in the ChatMessage.
+ */
+struct ChatRun {
+    u32 offset;
+    u32 length;
+    ChatColor color;
+    // ChatFormat flags
+    u8 format;
+};
+
+/**
+ * A chat component flattened into its plain text and the styled runs that cover it.
+ */
+class ChatMessage {
+private:
+    std::string m_Text;
+    std::vector<ChatRun> m_Runs;
+
+public:
+    const std::string& GetText() const noexcept { return m_Text; }
+    const std::vector<ChatRun>& GetRuns() const noexcept { return m_Runs; }
+
+    std::string GetRunText(const ChatRun& run) const {
+        return m_Text.substr(run.offset, run.length);
+    }
+
+    void Clear() {
+        m_Text.clear();
+        m_Runs.clear();
+    }
+
+    friend class ChatParser;
+};
+
+/**
+ * Parses chat json with a single SAX pass into a flat component list, without building a json DOM.
+ * The internal buffers are kept between calls, so a parser that is reused stops allocating.
+ */
+class ChatParser {
+public:
+    struct Component {
+        // Text, or the translation key when translate is set
+        u32 textOffset;
+        u32 textLength;
+        bool translate;
+        // -1 when inherited from the parent
+        s8 color;
+        // ChatFormat flags that this component sets and their values
+        u8 formatMask;
+        u8 format;
+        s32 firstExtra;
+        s32 lastExtra;
+        s32 firstWith;
+        s32 lastWith;
+        s32 next;
+    };
+
+private:
+    std::vector<Component> m_Components;
+    std::string m_Strings;
+
+    void Emit(s32 index, ChatColor color, u8 format, ChatMessage* message, std::string* text) const;
+    void EmitText(const char* text, std::size_t length, ChatColor& color, u8& format, ChatMessage* message, std::string* out) const;
+    bool ParseComponents(const std::string& json);
+
+public:
+    MCLIB_API ChatParser();
+
+    /**
+     * Parses json into message. Returns false if the json is malformed, in which case
+     * message holds whatever could be read before the error.
+     */
+    bool MCLIB_API Parse(const std::string& json, ChatMessage* message);
+
+    // Only extracts the plain text, skipping style tracking and runs.
+    bool MCLIB_API ParseText(const std::string& json, std::string* text);
+};
+
+// Both parse with a ChatParser that each thread keeps for these calls.
+MCLIB_API ChatMessage ParseChat(const std::string& json);
+MCLIB_API std::string GetChatText(const std::string& json);
+
+} // ns util
+} // ns mc
+
+#endif
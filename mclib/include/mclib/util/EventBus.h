@@ -0,0 +1,170 @@
+#ifndef MCLIB_UTIL_EVENT_BUS_H_
+#define MCLIB_UTIL_EVENT_BUS_H_
+
+#include <mclib/common/Types.h>
+
+#include <algorithm>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace mc {
+namespace util {
+
+/**
+ * Handle returned by Event::Subscribe. Zero is never handed out.
+ */
+using EventSubscription = u32;
+
+/**
+ * A single event with its own subscriber list.
+ * Subscribers are stored as a context pointer and a plain function pointer, so dispatching
+ * doesn't allocate and arguments are passed straight through without being copied by the event.
+ * Declare reference types in Args (const EntityPtr&) to avoid copies in the subscribers as well.
+ *
+ * Subscribing or unsubscribing from inside a callback is allowed. New subscribers only receive
+ * the next event and removed ones stop receiving events immediately.
+ *
+ * Post queues an event instead of delivering it, and Flush delivers every queued event in order.
+ * The queue keeps its capacity, so a steady stream of batched events stops allocating too.
+ * If a subscriber throws during Flush, the events after the one that threw stay queued for the next Flush.
+ */
+template <typename... Args>
+class Event {
+public:
+    using Callback = void (*)(void* context, Args... args);
+
+private:
+    struct Subscriber {
+        Callback callback;
+        void* context;
+        EventSubscription id;
+    };
+
+    using Queued = std::tuple<typename std::decay<Args>::type...>;
+
+    std::vector<Subscriber> m_Subscribers;
+    std::vector<Queued> m_Queue;
+    std::vector<Queued> m_Delivering;
+    EventSubscription m_NextId;
+    u32 m_DispatchDepth;
+    bool m_PendingRemoval;
+
+    template <typename T, void (T::*Method)(Args...)>
+    static void Invoke(void* context, Args... args) {
+        (static_cast<T*>(context)->*Method)(std::forward<Args>(args)...);
+    }
+
+    template <std::size_t... Indices>
+    void DispatchQueued(Queued& event, std::index_sequence<Indices...>) {
+        Dispatch(std::get<Indices>(event)...);
+    }
+
+    void Compact() {
+        m_Subscribers.erase(std::remove_if(m_Subscribers.begin(), m_Subscribers.end(), [](const Subscriber& subscriber) {
+            return subscriber.callback == nullptr;
+        }), m_Subscribers.end());
+
+        m_PendingRemoval = false;
+    }
+
+public:
+    Event() : m_NextId(1), m_DispatchDepth(0), m_PendingRemoval(false) { }
+
+    Event(const Event& rhs) = delete;
+    Event& operator=(const Event& rhs) = delete;
+
+    EventSubscription Subscribe(Callback callback, void* context) {
+        EventSubscription id = m_NextId++;
+
+        m_Subscribers.push_back({ callback, context, id });
+        return id;
+    }
+
+    template <typename T, void (T::*Method)(Args...)>
+    EventSubscription Subscribe(T* object) {
+        return Subscribe(&Invoke<T, Method>, object);
+    }
+
+    // Does nothing if the subscription doesn't exist.
+    void Unsubscribe(EventSubscription id) {
+        auto iter = std::find_if(m_Subscribers.begin(), m_Subscribers.end(), [id](const Subscriber& subscriber) {
+            return subscriber.id == id && subscriber.callback != nullptr;
+        });
+
+        if (iter == m_Subscribers.end()) return;
+
+        if (m_DispatchDepth > 0) {
+            iter->callback = nullptr;
+            m_PendingRemoval = true;
+        } else {
+            m_Subscribers.erase(iter);
+        }
+    }
+
+    bool HasSubscribers() const noexcept {
+        return !m_Subscribers.empty();
+    }
+
+    template <typename... CallArgs>
+    void Dispatch(CallArgs&&... args) {
+        // Every subscriber gets the same arguments, so they are passed on as lvalues.
+        std::size_t count = m_Subscribers.size();
+
+        ++m_DispatchDepth;
+
+        try {
+            for (std::size_t i = 0; i < count; ++i) {
+                const Subscriber subscriber = m_Subscribers[i];
+
+                if (subscriber.callback)
+                    subscriber.callback(subscriber.context, args...);
+            }
+        } catch (...) {
+            if (--m_DispatchDepth == 0 && m_PendingRemoval)
+                Compact();
+            throw;
+        }
+
+        if (--m_DispatchDepth == 0 && m_PendingRemoval)
+            Compact();
+    }
+
+    template <typename... CallArgs>
+    void Post(CallArgs&&... args) {
+        if (m_Subscribers.empty()) return;
+
+        m_Queue.emplace_back(std::forward<CallArgs>(args)...);
+    }
+
+    std::size_t GetQueuedCount() const noexcept { return m_Queue.size(); }
+
+    void Flush() {
+        // A subscriber flushing from inside a flush would deliver events out of order.
+        if (!m_Delivering.empty()) return;
+
+        // Swap so that events posted by subscribers during the flush wait for the next one.
+        m_Delivering.swap(m_Queue);
+
+        std::size_t delivered = 0;
+
+        try {
+            for (; delivered < m_Delivering.size(); ++delivered)
+                DispatchQueued(m_Delivering[delivered], std::index_sequence_for<Args...>());
+        } catch (...) {
+            // Keep the undelivered events ahead of anything posted since, and let later flushes run again.
+            m_Queue.insert(m_Queue.begin(), std::make_move_iterator(m_Delivering.begin() + delivered + 1), std::make_move_iterator(m_Delivering.end()));
+            m_Delivering.clear();
+            throw;
+        }
+
+        m_Delivering.clear();
+    }
+};
+
+} // ns util
+} // ns mc
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef MCLIB_UTIL_LATENCY_TRACKER_H_
+#define MCLIB_UTIL_LATENCY_TRACKER_H_
+
+#include <mclib/mclib.h>
+#include <mclib/common/Types.h>
+
+#include <mutex>
+#include <vector>
+
+namespace mc {
+namespace util {
+
+// All values are in microseconds.
+struct LatencyPercentiles {
+    std::size_t samples;
+    u64 p50;
+    u64 p90;
+    u64 p99;
+    u64 max;
+};
+
+/**
+ * Keeps the most recent latency samples in a ring buffer and computes percentiles over them on request.
+ * Recording is safe from any thread.
+ */
+class LatencyTracker {
+private:
+    mutable std::mutex m_Mutex;
+    std::vector<u64> m_Samples;
+    std::size_t m_Next;
+    std::size_t m_Count;
+
+public:
+    MCLIB_API LatencyTracker(std::size_t capacity = 1024);
+
+    void MCLIB_API Record(u64 latency);
+    void MCLIB_API Clear();
+    LatencyPercentiles MCLIB_API GetPercentiles() const;
+
+    // Monotonic clock in microseconds, meant for measuring intervals.
+    static s64 MCLIB_API Now();
+};
+
+} // ns util
+} // ns mc
+
+#endif
@@ -1,33 +1,78 @@
 #ifndef MCLIB_UTIL_OBSERVER_SUBJECT_H_
 #define MCLIB_UTIL_OBSERVER_SUBJECT_H_
 
-#include <functional>
+#include <mclib/util/EventBus.h>
+
 #include <vector>
 #include <algorithm>
 
 namespace mc {
 namespace util {
 
+/**
+ * Notifies every registered listener through a member function of the listener interface.
+ * Listeners may register or unregister themselves, or each other, while being notified.
+ * Use an Event for the hot paths where listeners should only receive what they subscribe to.
+ */
 template <typename T>
 class ObserverSubject {
 protected:
     std::vector<T*> m_Listeners;
+    u32 m_NotifyDepth = 0;
+    bool m_PendingRemoval = false;
+
+    void CompactListeners() {
+        m_Listeners.erase(std::remove(m_Listeners.begin(), m_Listeners.end(), nullptr), m_Listeners.end());
+        m_PendingRemoval = false;
+    }
 
 public:
     void RegisterListener(T* listener) {
+        if (std::find(m_Listeners.begin(), m_Listeners.end(), listener) != m_Listeners.end()) return;
+
         m_Listeners.push_back(listener);
     }
 
     void UnregisterListener(T* listener) {
         auto iter = std::find(m_Listeners.begin(), m_Listeners.end(), listener);
 
-        m_Listeners.erase(iter);
+        if (iter == m_Listeners.end()) return;
+
+        if (m_NotifyDepth > 0) {
+            // Erasing would shift the listeners that are still waiting to be notified.
+            *iter = nullptr;
+            m_PendingRemoval = true;
+        } else {
+            m_Listeners.erase(iter);
+        }
+    }
+
+    bool HasListeners() const noexcept {
+        return !m_Listeners.empty();
     }
 
     template <typename Func, typename... Args>
-    void NotifyListeners(Func f, Args... args) {
-        for (T* listener : m_Listeners)
-            std::bind(f, listener, args...)();
+    void NotifyListeners(Func f, Args&&... args) {
+        // Listeners registered during the notification are only told about the next one.
+        std::size_t count = m_Listeners.size();
+
+        ++m_NotifyDepth;
+
+        try {
+            for (std::size_t i = 0; i < count; ++i) {
+                T* listener = m_Listeners[i];
+
+                if (listener)
+                    (listener->*f)(args...);
+            }
+        } catch (...) {
+            if (--m_NotifyDepth == 0 && m_PendingRemoval)
+                CompactListeners();
+            throw;
+        }
+
+        if (--m_NotifyDepth == 0 && m_PendingRemoval)
+            CompactListeners();
     }
 };
 
@@ -0,0 +1,85 @@
+#ifndef MCLIB_UTIL_SPSC_QUEUE_H_
+#define MCLIB_UTIL_SPSC_QUEUE_H_
+
+#include <mclib/common/Types.h>
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace mc {
+namespace util {
+
+/**
+ * Bounded lock-free queue for exactly one producer thread and one consumer thread.
+ * Capacity is rounded up to a power of two. Slots are constructed up front and reused,
+ * so values are moved in and out instead of being allocated per push.
+ */
+template <typename T>
+class SPSCQueue {
+private:
+    // Keeps the producer and consumer indices on separate cache lines.
+    static constexpr std::size_t CacheLineSize = 64;
+
+    std::unique_ptr<T[]> m_Slots;
+    std::size_t m_Mask;
+
+    alignas(CacheLineSize) std::atomic<std::size_t> m_Head;
+    alignas(CacheLineSize) std::atomic<std::size_t> m_Tail;
+
+public:
+    SPSCQueue(std::size_t capacity) : m_Head(0), m_Tail(0) {
+        if (capacity == 0)
+            throw std::invalid_argument("SPSCQueue capacity must be greater than zero.");
+
+        std::size_t size = 1;
+        while (size < capacity)
+            size <<= 1;
+
+        m_Slots = std::make_unique<T[]>(size);
+        m_Mask = size - 1;
+    }
+
+    SPSCQueue(const SPSCQueue& rhs) = delete;
+    SPSCQueue& operator=(const SPSCQueue& rhs) = delete;
+
+    // Producer only. Returns false without touching value if the queue is full.
+    bool TryPush(T&& value) {
+        std::size_t tail = m_Tail.load(std::memory_order_relaxed);
+
+        if (tail - m_Head.load(std::memory_order_acquire) > m_Mask)
+            return false;
+
+        m_Slots[tail & m_Mask] = std::move(value);
+        m_Tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer only.
+    bool TryPop(T& value) {
+        std::size_t head = m_Head.load(std::memory_order_relaxed);
+
+        if (head == m_Tail.load(std::memory_order_acquire))
+            return false;
+
+        value = std::move(m_Slots[head & m_Mask]);
+        m_Head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Approximate when called while the other side is running.
+    std::size_t GetSize() const noexcept {
+        // Head first, since the tail never falls behind it.
+        std::size_t head = m_Head.load(std::memory_order_acquire);
+        return m_Tail.load(std::memory_order_acquire) - head;
+    }
+
+    std::size_t GetCapacity() const noexcept { return m_Mask + 1; }
+    bool IsEmpty() const noexcept { return GetSize() == 0; }
+};
+
+} // ns util
+} // ns mc
+
+#endif
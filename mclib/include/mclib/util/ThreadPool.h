@@ -0,0 +1,69 @@
+#ifndef MCLIB_UTIL_THREAD_POOL_H_
+#define MCLIB_UTIL_THREAD_POOL_H_
+
+#include <mclib/mclib.h>
+#include <mclib/common/Types.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace mc {
+namespace util {
+
+/**
+ * Fixed set of worker threads with one task queue each.
+ * Submitted tasks are spread over the queues, and a worker whose own queue is empty steals from the back of the others,
+ * so a few slow tasks don't leave the rest of the workers idle.
+ */
+class ThreadPool {
+public:
+    using Task = std::function<void()>;
+
+private:
+    struct WorkQueue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<std::unique_ptr<WorkQueue>> m_Queues;
+    std::vector<std::thread> m_Threads;
+    std::mutex m_WakeMutex;
+    std::condition_variable m_Wake;
+    std::atomic<std::size_t> m_Queued;
+    std::atomic<std::size_t> m_NextQueue;
+    std::atomic<bool> m_Running;
+
+    void WorkerThread(std::size_t index);
+    bool PopTask(std::size_t index, Task& task);
+
+public:
+    // threadCount of 0 uses one thread per hardware thread.
+    MCLIB_API ThreadPool(std::size_t threadCount = 0);
+    // Waits for the running tasks, queued tasks are dropped.
+    MCLIB_API ~ThreadPool();
+
+    ThreadPool(const ThreadPool& rhs) = delete;
+    ThreadPool& operator=(const ThreadPool& rhs) = delete;
+
+    void MCLIB_API Submit(Task task);
+
+    /**
+     * Runs one queued task on the calling thread. Returns false if nothing was queued.
+     * Lets a thread that waits on the results help instead of blocking.
+     */
+    bool MCLIB_API RunPendingTask();
+
+    std::size_t GetThreadCount() const noexcept { return m_Threads.size(); }
+    std::size_t GetQueuedCount() const noexcept { return m_Queued; }
+};
+
+} // ns util
+} // ns mc
+
+#endif
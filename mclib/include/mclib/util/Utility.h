@@ -8,6 +8,12 @@
 #include <mclib/core/Client.h>
 #include <mclib/core/Connection.h>
 #include <mclib/core/PlayerManager.h>
+#include <mclib/entity/EntityPredictor.h>
+#include <mclib/world/Collision.h>
+#include <mclib/world/IncrementalPathfinder.h>
+#include <mclib/world/NavigationGrid.h>
+#include <mclib/world/Pathfinder.h>
+#include <mclib/world/PhysicsBatch.h>
 #include <mclib/world/World.h>
 
 #include <fstream>
@@ -41,12 +47,27 @@ private:
     float m_Yaw;
     float m_Pitch;
     AABB m_BoundingBox;
+    world::Collider m_Collider;
+    world::NavigationGrid m_NavigationGrid;
+    world::Pathfinder m_Pathfinder;
+    world::IncrementalPathfinder m_PathPlanner;
+    world::Path m_Path;
+    // Next node of m_Path to walk to
+    std::size_t m_PathIndex;
+    // Grid version that m_Path was last checked against
+    u64 m_PathVersion;
+    bool m_Replan;
+    // Moves the player together with other controllers instead of in Update, if set
+    world::PhysicsBatch* m_PhysicsBatch;
+    world::PhysicsBatch::BodyId m_Body;
     EntityId m_EntityId;
     u64 m_LastUpdate;
     Vector3d m_TargetPos;
     bool m_Sprinting;
     bool m_LoadedIn;
     bool m_HandleFall;
+    // Whether the player was standing on something after the last update
+    bool m_OnGround;
 
     double m_MoveSpeed;
 
@@ -54,8 +75,17 @@ private:
 
     // todo: gravity
     const float FallSpeed = 8.3f * (50.0f / 1000.0f);
-
-    std::vector<std::pair<block::BlockPtr, mc::Vector3i>> GetNearbyBlocks(const s32 radius);
+    // Highest ledge that players walk up without jumping
+    const double StepHeight = 0.6;
+    // Highest ledge that a jump gets onto
+    const double JumpHeight = 1.25;
+
+    Vector3i GetFeetPosition() const;
+    // Searches for a path to the target if there's none yet, and repairs it when the world changes.
+    void UpdatePath();
+    bool IsInVehicle() const;
+    // Moves by delta without going through blocks, climbing ledges up to stepHeight.
+    void Walk(Vector3d delta, double stepHeight);
 
 public:
     MCLIB_API PlayerController(core::Connection* connection, world::World& world, core::PlayerManager& playerManager);
@@ -66,6 +96,7 @@ public:
 
     void MCLIB_API Dig(Vector3d target);
     void MCLIB_API Attack(EntityId id);
+    // Moves by delta without going through blocks, stepping up onto slabs and stairs.
     void MCLIB_API Move(Vector3d delta);
 
     bool MCLIB_API HandleJump();
@@ -80,6 +111,10 @@ public:
     float MCLIB_API GetYaw() const;
     float MCLIB_API GetPitch() const;
     AABB MCLIB_API GetBoundingBox() const;
+    // The path being followed to the target position.
+    const world::Path& GetPath() const noexcept { return m_Path; }
+    world::Pathfinder& GetPathfinder() noexcept { return m_Pathfinder; }
+    world::IncrementalPathfinder& GetPathPlanner() noexcept { return m_PathPlanner; }
 
     void MCLIB_API SetYaw(float yaw);
     void MCLIB_API SetPitch(float pitch);
@@ -87,6 +122,14 @@ public:
     void MCLIB_API SetMoveSpeed(double speed);
     void MCLIB_API SetTargetPosition(Vector3d target);
     void MCLIB_API SetHandleFall(bool handle);
+
+    /**
+     * Lets batch move the player from now on, or stops using one if it's null.
+     * Update then only steers the body and sends where the batch moved it, so batch.Step has to be called every tick too.
+     * The batch has to outlive the controller or be unset first.
+     */
+    void MCLIB_API SetPhysicsBatch(world::PhysicsBatch* batch);
+    world::PhysicsBatch* GetPhysicsBatch() const noexcept { return m_PhysicsBatch; }
 };
 
 class PlayerFollower : public core::PlayerListener, public core::ClientListener {
@@ -98,12 +141,19 @@ private:
     PlayerController& m_PlayerController;
     std::wstring m_Target;
     u64 m_LastUpdate;
+    const entity::EntityPredictor* m_Predictor;
+
+    // Where the entity is now, or its vehicle if it's riding one.
+    Vector3d GetTargetPosition(const entity::EntityPtr& entity) const;
 
 public:
     MCLIB_API PlayerFollower(protocol::packets::PacketDispatcher* dispatcher, core::Client* client);
 
     MCLIB_API ~PlayerFollower();
 
+    // Aims at where the followed player should be by now instead of where the last packet put them. Null to stop.
+    void SetPredictor(const entity::EntityPredictor* predictor) noexcept { m_Predictor = predictor; }
+
     MCLIB_API void UpdateRotation();
 
     MCLIB_API void OnTick() override;
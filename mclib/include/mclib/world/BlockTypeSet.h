@@ -0,0 +1,103 @@
+#ifndef MCLIB_WORLD_BLOCK_TYPE_SET_H_
+#define MCLIB_WORLD_BLOCK_TYPE_SET_H_
+
+#include <mclib/common/Types.h>
+#include <mclib/block/Block.h>
+
+#include <algorithm>
+#include <initializer_list>
+#include <vector>
+
+namespace mc {
+namespace world {
+
+/**
+ * Set of block states (type << 4 | meta, or the flattened state ids) with constant time lookups, used for searching the world.
+ * Grows to fit the states that are added, so it works with any registry.
+ */
+class BlockTypeSet {
+private:
+    // One bit per state
+    std::vector<u64> m_Words;
+
+public:
+    BlockTypeSet() { }
+
+    // Sized for every state of the registry, so adding them doesn't grow it.
+    explicit BlockTypeSet(const block::BlockRegistry& registry)
+        : m_Words((registry.GetStateCount() + 63) / 64, 0)
+    {
+    }
+
+    // Adds every meta variant of the types
+    BlockTypeSet(std::initializer_list<u16> types) {
+        for (u16 type : types)
+            AddType(type);
+    }
+
+    void AddType(u16 type) {
+        for (u32 meta = 0; meta < 16; ++meta)
+            AddState(((u32)type << 4) | meta);
+    }
+
+    void AddState(u32 data) {
+        std::size_t word = data / 64;
+
+        if (word >= m_Words.size())
+            m_Words.resize(word + 1, 0);
+
+        m_Words[word] |= 1ULL << (data % 64);
+    }
+
+    void Add(block::BlockPtr block) {
+        if (block)
+            AddState(block->GetType());
+    }
+
+    void Remove(u32 data) {
+        std::size_t word = data / 64;
+
+        if (word < m_Words.size())
+            m_Words[word] &= ~(1ULL << (data % 64));
+    }
+
+    bool Contains(u32 data) const noexcept {
+        std::size_t word = data / 64;
+        return word < m_Words.size() && ((m_Words[word] >> (data % 64)) & 1);
+    }
+
+    bool Contains(const BlockTypeSet& other) const noexcept {
+        for (std::size_t i = 0; i < other.m_Words.size(); ++i) {
+            u64 word = i < m_Words.size() ? m_Words[i] : 0;
+
+            if (other.m_Words[i] & ~word)
+                return false;
+        }
+
+        return true;
+    }
+
+    bool Intersects(const BlockTypeSet& other) const noexcept {
+        std::size_t size = (std::min)(m_Words.size(), other.m_Words.size());
+
+        for (std::size_t i = 0; i < size; ++i) {
+            if (m_Words[i] & other.m_Words[i])
+                return true;
+        }
+
+        return false;
+    }
+
+    bool IsEmpty() const noexcept {
+        for (u64 word : m_Words) {
+            if (word) return false;
+        }
+
+        return true;
+    }
+};
+
+} // ns world
+} // ns mc
+
+#endif
@@ -4,11 +4,14 @@
 #include "mclib/block/Block.h"
 #include "mclib/block/BlockEntity.h"
 #include "mclib/common/Types.h"
+#include "mclib/world/BlockTypeSet.h"
 #include "mclib/nbt/NBT.h"
 
 #include <array>
+#include <functional>
 #include <map>
 #include <memory>
+#include <vector>
 
 namespace mc {
 
@@ -32,31 +35,109 @@ class Chunk {
 private:
     std::vector<u32> m_Palette;
     std::vector<u64> m_Data;
+    // Open addressing table from block data to palette index + 1, 0 is an empty slot.
+    // Built on the first SetBlock so sections that are only read don't pay for it.
+    std::vector<u16> m_PaletteIndex;
     u8 m_BitsPerBlock;
+    // Owned by the SectionStore and possibly used by several worlds. Copies don't inherit this.
+    bool m_Shared;
+
+    friend class SectionStore;
+
+    u32 GetValue(std::size_t index) const;
+    void SetValue(std::size_t index, u32 value);
+    s32 FindPaletteEntry(u32 blockData);
+    void IndexPaletteEntry(std::size_t paletteIndex);
+    u32 AddPaletteEntry(u32 blockData, u8 directBits);
+    // Repacks a direct section with more bits.
+    void Widen(u8 bitsPerBlock);
+    void Repack(u8 bitsPerBlock, const std::vector<u32>& remap);
 
 public:
+    enum {
+        // Sections using more bits than this store block data directly instead of palette indices.
+        MaxPaletteBits = 8,
+        // Fewest bits a direct section uses, enough for every block type << 4 | meta.
+        // Registries with more states, like the flattened ones, use more. See GetDirectBits.
+        GlobalPaletteBits = 13
+    };
+
     MCLIB_API Chunk();
 
     MCLIB_API Chunk(const Chunk& other);
     MCLIB_API Chunk& operator=(const Chunk& other);
     /**
+     * Position is relative to this chunk position. Sections don't know which registry their column uses, so it's passed in.
+     */
+    block::BlockPtr MCLIB_API GetBlock(Vector3i chunkPosition, const block::BlockRegistry* registry) const;
+
+    /**
+     * Returns the raw block state (type << 4 | meta) without looking it up in the registry.
      * Position is relative to this chunk position
      */
-    block::BlockPtr MCLIB_API GetBlock(Vector3i chunkPosition) const;
+    u32 MCLIB_API GetBlockData(Vector3i chunkPosition) const;
+
+    /**
+     * Position is relative to this chunk position.
+     * The registry decides how many bits the section uses once it runs out of palette, BlockRegistry::GetInstance() if it's null.
+     */
+    void MCLIB_API SetBlock(Vector3i chunkPosition, block::BlockPtr block, const block::BlockRegistry* registry = nullptr);
 
     /**
-    * Position is relative to this chunk position
-    */
-    void MCLIB_API SetBlock(Vector3i chunkPosition, block::BlockPtr block);
+     * False only if none of the states can be in this section, checked against the palette.
+     * Direct sections have no palette, so they always may.
+     */
+    bool MCLIB_API MayContain(const BlockTypeSet& states) const;
+
+    /**
+     * Writes map(block data) for every block, indexed by y << 8 | z << 4 | x.
+     * map is called once per palette entry instead of once per block.
+     */
+    void MCLIB_API MapBlocks(const std::function<u8(u32)>& map, std::array<u8, 16 * 16 * 16>& out) const;
 
     /**
      * chunkIndex is the index (0-16) of this chunk in the ChunkColumn
      */
     void MCLIB_API Load(DataBuffer& in, ChunkColumnMetadata* meta, s32 chunkIndex);
+
+    /**
+     * Compact format for keeping sections in memory, not the network format.
+     */
+    void MCLIB_API Serialize(DataBuffer& out) const;
+    void MCLIB_API Deserialize(DataBuffer& in);
+
+    /**
+     * Drops palette entries that no block uses anymore and shrinks the bits per block to fit.
+     * Called automatically before the palette grows. Returns true if anything was dropped.
+     */
+    bool MCLIB_API Compact();
+
+    u8 GetBitsPerBlock() const noexcept { return m_BitsPerBlock; }
+    std::size_t GetPaletteSize() const noexcept { return m_Palette.size(); }
+    // Direct sections have no palette and store block data in GetDirectBits bits.
+    bool IsDirect() const noexcept { return m_BitsPerBlock > MaxPaletteBits; }
+
+    // Bits per block of direct sections for the registry, enough for all of its states and at least GlobalPaletteBits.
+    static u8 MCLIB_API GetDirectBits(const block::BlockRegistry* registry);
+
+    // Shared sections must not be modified, copy them first.
+    bool IsShared() const noexcept { return m_Shared; }
+
+    // Approximate heap and object size in bytes
+    std::size_t MCLIB_API GetMemoryUsage() const;
 };
 
 typedef std::shared_ptr<Chunk> ChunkPtr;
 
+enum class HeightmapType {
+    // Blocks that can be collided with
+    Solid,
+    // Solid blocks and fluids
+    MotionBlocking,
+    // Anything that isn't air
+    NonAir
+};
+
 /**
  * Stores a 16x256x16 area. Uses chunks (16x16x16) to store the data vertically.
  * A null chunk is fully air.
@@ -74,9 +155,15 @@ private:
     std::array<ChunkPtr, ChunksPerColumn> m_Chunks;
     ChunkColumnMetadata m_Metadata;
     std::map<Vector3i, block::BlockEntityPtr> m_BlockEntities;
+    // One above the highest matching block per HeightmapType, indexed by z << 4 | x
+    std::array<std::array<u16, 16 * 16>, 3> m_Heightmaps;
+    const block::BlockRegistry* m_Registry;
+    // Heightmap flags per state of m_Registry, shared with the other columns using it
+    std::shared_ptr<const std::vector<u8>> m_HeightmapFlags;
 
 public:
-    MCLIB_API ChunkColumn(ChunkColumnMetadata metadata);
+    // Blocks are looked up in registry, BlockRegistry::GetInstance() if it's null.
+    MCLIB_API ChunkColumn(ChunkColumnMetadata metadata, const block::BlockRegistry* registry = nullptr);
 
     ChunkColumn(const ChunkColumn& rhs) = default;
     ChunkColumn& operator=(const ChunkColumn& rhs) = default;
@@ -118,11 +205,36 @@ public:
     /**
      * Position is relative to this ChunkColumn position.
      */
-    block::BlockPtr MCLIB_API GetBlock(Vector3i position);
+    block::BlockPtr MCLIB_API GetBlock(Vector3i position) const;
     const ChunkColumnMetadata& GetMetadata() const { return m_Metadata; }
 
-    MCLIB_API block::BlockEntityPtr GetBlockEntity(Vector3i worldPos);
-    std::vector<block::BlockEntityPtr> MCLIB_API GetBlockEntities();
+    const block::BlockRegistry* GetRegistry() const noexcept { return m_Registry; }
+    // Recomputes the heightmaps with the new registry.
+    void MCLIB_API SetRegistry(const block::BlockRegistry* registry);
+
+    /**
+     * y of the highest block of the type at x, z relative to this column, plus one. 0 if there are none.
+     */
+    s32 GetHeight(s32 x, s32 z, HeightmapType type) const noexcept {
+        return m_Heightmaps[(std::size_t)type][(z << 4) | x];
+    }
+
+    // Rebuilds the heightmaps from the sections. Done when the column is loaded.
+    void MCLIB_API ComputeHeightmaps();
+    // Call after the block at the position relative to this column changed to blockData.
+    void MCLIB_API UpdateHeightmaps(Vector3i position, u32 blockData);
+
+    /**
+     * Reads the sections, biomes and block entities that follow the section size in a ChunkData packet.
+     * Only touches this column, so separate columns can be loaded on separate threads.
+     */
+    void MCLIB_API Load(DataBuffer& in);
+
+    MCLIB_API block::BlockEntityPtr GetBlockEntity(Vector3i worldPos) const;
+    std::vector<block::BlockEntityPtr> MCLIB_API GetBlockEntities() const;
+
+    // Approximate memory used by the sections in bytes
+    std::size_t MCLIB_API GetMemoryUsage() const;
 
     friend MCLIB_API DataBuffer& operator>>(DataBuffer& in, ChunkColumn& column);
 };
@@ -0,0 +1,93 @@
+#ifndef MCLIB_WORLD_COLD_COLUMN_STORE_H_
+#define MCLIB_WORLD_COLD_COLUMN_STORE_H_
+
+#include <mclib/mclib.h>
+#include <mclib/common/Types.h>
+#include <mclib/world/Chunk.h>
+
+#include <list>
+#include <map>
+#include <vector>
+
+namespace mc {
+namespace world {
+
+struct ColdColumnStats {
+    std::size_t columns;
+    std::size_t compressedBytes;
+    // Cold columns currently decompressed for reading
+    std::size_t cachedColumns;
+    std::size_t cachedBytes;
+    u64 hits;
+    u64 misses;
+};
+
+/**
+ * Keeps chunk columns zlib compressed and decompresses them on demand.
+ * Recently read columns stay decompressed in an LRU cache that's bounded by a byte budget.
+ * Block entities are kept as they are since there are few of them.
+ */
+class ColdColumnStore {
+public:
+    typedef std::pair<s32, s32> ColumnCoord;
+
+private:
+    struct ColdColumn {
+        ChunkColumnMetadata metadata;
+        const block::BlockRegistry* registry;
+        u16 sectionMask;
+        std::size_t rawSize;
+        std::vector<u8> data;
+        std::vector<block::BlockEntityPtr> blockEntities;
+    };
+
+    typedef std::list<std::pair<ColumnCoord, ChunkColumnPtr>> CacheList;
+
+    std::map<ColumnCoord, ColdColumn> m_Columns;
+    CacheList m_Cache;
+    std::map<ColumnCoord, CacheList::iterator> m_CacheIndex;
+    std::size_t m_CacheBudget;
+    std::size_t m_CacheBytes;
+    std::size_t m_CompressedBytes;
+    u64 m_Hits;
+    u64 m_Misses;
+
+    ChunkColumnPtr Decompress(const ColdColumn& cold) const;
+    void EvictCached(const ColumnCoord& coord);
+    void TrimCache();
+
+public:
+    MCLIB_API ColdColumnStore(std::size_t cacheBudget);
+
+    ColdColumnStore(const ColdColumnStore& rhs) = delete;
+    ColdColumnStore& operator=(const ColdColumnStore& rhs) = delete;
+
+    // Compresses the column. The column itself isn't kept.
+    void MCLIB_API Store(const ColumnCoord& coord, const ChunkColumn& column);
+
+    // Read-only access through the cache. Returns nullptr if the column isn't stored.
+    MCLIB_API ChunkColumnPtr Get(const ColumnCoord& coord);
+    // Read-only access that doesn't add the column to the cache, for passes over many columns that would flush it.
+    MCLIB_API ChunkColumnPtr Read(const ColumnCoord& coord) const;
+
+    // Removes the column from the store and returns it decompressed, for changing it.
+    MCLIB_API ChunkColumnPtr Take(const ColumnCoord& coord);
+
+    bool Contains(const ColumnCoord& coord) const { return m_Columns.find(coord) != m_Columns.end(); }
+    void MCLIB_API Remove(const ColumnCoord& coord);
+    void MCLIB_API Clear();
+
+    void SetCacheBudget(std::size_t bytes) { m_CacheBudget = bytes; TrimCache(); }
+    std::size_t GetCacheBudget() const noexcept { return m_CacheBudget; }
+
+    std::vector<block::BlockEntityPtr> MCLIB_API GetBlockEntities() const;
+    ColdColumnStats MCLIB_API GetStats() const;
+
+    std::map<ColumnCoord, ColdColumn>::const_iterator begin() const { return m_Columns.begin(); }
+    std::map<ColumnCoord, ColdColumn>::const_iterator end() const { return m_Columns.end(); }
+};
+
+} // ns world
+} // ns mc
+
+#endif
@@ -0,0 +1,98 @@
+#ifndef MCLIB_WORLD_COLLISION_H_
+#define MCLIB_WORLD_COLLISION_H_
+
+#include <mclib/mclib.h>
+#include <mclib/common/AABB.h>
+#include <mclib/common/Types.h>
+#include <mclib/block/Block.h>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace mc {
+namespace world {
+
+class World;
+
+// Stopping at a block and then adding the position back to the bounds can leave a box a rounding error inside of the block.
+// Overlaps smaller than this don't count as being stuck in a block.
+const double StuckTolerance = 1e-7;
+
+/**
+ * Collision boxes of every block state in a registry, relative to the block position.
+ * All of the boxes are kept in one array, so looking up a state's boxes doesn't allocate.
+ * Blocks that aren't solid have no boxes.
+ */
+class CollisionShapes {
+private:
+    // Range in m_Boxes for each block state
+    std::vector<std::pair<u32, u32>> m_Ranges;
+    std::vector<AABB> m_Boxes;
+
+public:
+    MCLIB_API CollisionShapes(const block::BlockRegistry& registry);
+
+    std::size_t GetStateCount() const noexcept { return m_Ranges.size(); }
+
+    const AABB* begin(u32 blockData) const noexcept {
+        return blockData < m_Ranges.size() ? m_Boxes.data() + m_Ranges[blockData].first : nullptr;
+    }
+
+    const AABB* end(u32 blockData) const noexcept {
+        return blockData < m_Ranges.size() ? m_Boxes.data() + m_Ranges[blockData].second : nullptr;
+    }
+
+    bool IsEmpty(u32 blockData) const noexcept { return begin(blockData) == end(blockData); }
+
+    // Shared table for the registry. Built again if blocks were registered since the last one.
+    static MCLIB_API std::shared_ptr<const CollisionShapes> Get(const block::BlockRegistry* registry);
+};
+
+struct MoveResult {
+    // What's left of the motion after colliding
+    Vector3d motion;
+    bool collidedHorizontally;
+    bool collidedVertically;
+    // Stopped by something below
+    bool onGround;
+};
+
+/**
+ * Moves boxes through a world the way vanilla moves entities.
+ * The motion is clipped against the block boxes along y first, then x, then z.
+ * The boxes are gathered into a buffer that's kept between calls, so moving doesn't allocate once it has grown.
+ */
+class Collider {
+private:
+    const World& m_World;
+    std::shared_ptr<const CollisionShapes> m_Shapes;
+    std::vector<AABB> m_Boxes;
+
+    // Moves box by as much of motion as the boxes allow, along y first, then x, then z.
+    static Vector3d Clip(AABB& box, Vector3d motion, const AABB* begin, const AABB* end) noexcept;
+
+public:
+    MCLIB_API Collider(const World& world);
+
+    Collider(const Collider& rhs) = delete;
+    Collider& operator=(const Collider& rhs) = delete;
+
+    // World boxes of the blocks that intersect area. Only valid until the next call.
+    MCLIB_API const std::vector<AABB>& GetCollisionBoxes(const AABB& area);
+
+    /**
+     * Moves box by motion, stopping at blocks in the way.
+     * If it's blocked horizontally while on the ground, it also tries climbing up to stepHeight like players do on slabs and stairs.
+     */
+    MoveResult MCLIB_API Move(const AABB& box, Vector3d motion, bool onGround = false, double stepHeight = 0.0);
+
+    // Same as Move, but against boxes that were already gathered. They have to cover box expanded by motion and raised by stepHeight.
+    static MoveResult MCLIB_API MoveAgainst(const AABB& box, Vector3d motion, const AABB* begin, const AABB* end,
+        bool onGround = false, double stepHeight = 0.0);
+};
+
+} // ns world
+} // ns mc
+
+#endif
@@ -0,0 +1,99 @@
+#ifndef MCLIB_WORLD_INCREMENTAL_PATHFINDER_H_
+#define MCLIB_WORLD_INCREMENTAL_PATHFINDER_H_
+
+#include <mclib/mclib.h>
+#include <mclib/world/Pathfinder.h>
+
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace mc {
+namespace world {
+
+struct PathRepairStats {
+    // Searches that started over, because the goal changed or the changes couldn't be repaired
+    u64 searches;
+    u64 searchExpanded;
+    // Searches that only fixed up the nodes around changed blocks
+    u64 repairs;
+    u64 repairExpanded;
+
+    PathRepairStats() : searches(0), searchExpanded(0), repairs(0), repairExpanded(0) { }
+};
+
+/**
+ * D* Lite search from the goal back to the start, kept between queries to the same goal.
+ * Blocks that changed since the last query are read from the NavigationGrid, and only the
+ * nodes whose moves they can affect are updated before the search is resumed.
+ * Walking along the path doesn't need a new search either, since the costs are kept relative to the goal.
+ * Loading or unloading a column next to the searched area starts over.
+ */
+class IncrementalPathfinder {
+private:
+    typedef std::pair<double, double> Key;
+
+    struct Node {
+        Vector3i position;
+        // Cost to the goal, and the cost through the best neighbor
+        double g;
+        double rhs;
+        Key key;
+        bool open;
+    };
+
+    typedef std::pair<Key, u64> OpenEntry;
+
+    Pathfinder& m_Pathfinder;
+    Vector3i m_Goal;
+    bool m_HasGoal;
+    // Start of the last query
+    Vector3i m_Start;
+    // Added to the keys so they stay comparable after the start moved
+    double m_KeyModifier;
+    u64 m_GridVersion;
+    std::unordered_map<u64, Node> m_Nodes;
+    // Min heap. Entries whose key no longer matches the node are skipped.
+    std::vector<OpenEntry> m_Open;
+    // Area containing every node, grown by two blocks
+    Vector3i m_Min;
+    Vector3i m_Max;
+    std::vector<PathEdge> m_Successors;
+    std::vector<PathEdge> m_Predecessors;
+    std::vector<NavigationChange> m_Changes;
+    PathRepairStats m_Stats;
+
+    void Reset(const Vector3i& start);
+    Node& GetNode(const Vector3i& position);
+    double GetCost(const Vector3i& position) const;
+    Key CalculateKey(const Node& node) const;
+    void UpdateVertex(Node& node);
+    // Updates the nodes around the changed blocks. Returns false if the search has to start over.
+    bool ApplyChanges(bool* changed);
+    std::size_t ComputeShortestPath();
+
+public:
+    MCLIB_API IncrementalPathfinder(Pathfinder& pathfinder);
+
+    IncrementalPathfinder(const IncrementalPathfinder& rhs) = delete;
+    IncrementalPathfinder& operator=(const IncrementalPathfinder& rhs) = delete;
+
+    // Forgets the previous search if the goal is different.
+    void MCLIB_API SetGoal(const Vector3i& goal);
+    const Vector3i& GetGoal() const noexcept { return m_Goal; }
+    bool HasGoal() const noexcept { return m_HasGoal; }
+
+    /**
+     * Same as Pathfinder::FindPath to the goal, but reuses the previous search.
+     * Path::expanded only counts the nodes expanded by this query.
+     */
+    Path MCLIB_API FindPath(const Vector3i& start);
+
+    const PathRepairStats& GetStats() const noexcept { return m_Stats; }
+    std::size_t GetNodeCount() const noexcept { return m_Nodes.size(); }
+};
+
+} // ns world
+} // ns mc
+
+#endif
@@ -0,0 +1,135 @@
+#ifndef MCLIB_WORLD_NAVIGATION_GRID_H_
+#define MCLIB_WORLD_NAVIGATION_GRID_H_
+
+#include <mclib/mclib.h>
+#include <mclib/common/Types.h>
+#include <mclib/world/Collision.h>
+#include <mclib/world/World.h>
+
+#include <array>
+#include <deque>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace mc {
+namespace world {
+
+struct NavigationChange {
+    // The block that changed, or the lowest corner of the column that was loaded or unloaded
+    Vector3i position;
+    bool column;
+};
+
+/**
+ * Walkability of the world for a player sized mob, one byte of flags per block.
+ * The flags come from the block collision shapes and are cached per section as sections are first looked at.
+ * The cache is kept up to date by listening to the world, so changed and reloaded sections are rebuilt when needed.
+ */
+class NavigationGrid : public WorldListener {
+public:
+    enum CellFlags : u8 {
+        // Has a collision box
+        Blocking = 1 << 0,
+        // The collision box sticks out into the block above, like fences and walls
+        Tall = 1 << 1,
+        // Liquids and blocks that hurt, never walked through or stood on
+        Hazard = 1 << 2,
+        // The column isn't loaded
+        Unloaded = 1 << 3
+    };
+
+private:
+    typedef std::array<u8, 16 * 16 * 16> Section;
+
+    World& m_World;
+    std::shared_ptr<const CollisionShapes> m_Shapes;
+    // CellFlags per block data
+    std::vector<u8> m_StateFlags;
+    // Keyed by GetSectionKey. Air and unloaded sections point to the shared ones below.
+    std::unordered_map<u64, const Section*> m_Sections;
+    std::vector<std::unique_ptr<Section>> m_Owned;
+    std::vector<Section*> m_Free;
+    Section m_AirSection;
+    Section m_UnloadedSection;
+    u64 m_LastKey;
+    const Section* m_LastSection;
+    u64 m_Version;
+    // The most recent changes, the last one made at m_Version
+    std::deque<NavigationChange> m_Changes;
+
+    static u64 GetSectionKey(s64 sectionX, s64 sectionY, s64 sectionZ) noexcept {
+        return ((u64)(sectionX & 0xFFFFFFF) << 36) | ((u64)(sectionZ & 0xFFFFFFF) << 8) | (u64)(sectionY & 0xFF);
+    }
+
+    void UpdateStateFlags();
+    const Section* BuildSection(s64 sectionX, s64 sectionY, s64 sectionZ);
+    void Release(std::unordered_map<u64, const Section*>::iterator iter);
+    void InvalidateColumn(s32 chunkX, s32 chunkZ);
+    void AddChange(const Vector3i& position, bool column);
+
+public:
+    // How many changes are kept for GetChangesSince
+    enum { MaxChanges = 4096 };
+
+    MCLIB_API NavigationGrid(World& world);
+    MCLIB_API ~NavigationGrid();
+
+    NavigationGrid(const NavigationGrid& rhs) = delete;
+    NavigationGrid& operator=(const NavigationGrid& rhs) = delete;
+
+    // CellFlags of the block. Below the world is unloaded and above it is air.
+    u8 GetCell(s64 x, s64 y, s64 z) {
+        if (y < 0) return Unloaded;
+        if (y > 255) return 0;
+
+        u64 key = GetSectionKey(x >> 4, y >> 4, z >> 4);
+
+        if (key != m_LastKey || !m_LastSection) {
+            auto iter = m_Sections.find(key);
+
+            m_LastSection = iter != m_Sections.end() ? iter->second : BuildSection(x >> 4, y >> 4, z >> 4);
+            m_LastKey = key;
+        }
+
+        return (*m_LastSection)[((y & 15) << 8) | ((z & 15) << 4) | (x & 15)];
+    }
+
+    // Nothing in the block stops a player from moving through it.
+    bool IsPassable(s64 x, s64 y, s64 z) {
+        return (GetCell(x, y, z) & (Blocking | Hazard | Unloaded)) == 0 && (GetCell(x, y - 1, z) & Tall) == 0;
+    }
+
+    // A player can stand with their feet in the block, with room for their head and something solid to stand on.
+    bool IsStandable(s64 x, s64 y, s64 z) {
+        return IsPassable(x, y, z) && IsPassable(x, y + 1, z) && (GetCell(x, y - 1, z) & (Blocking | Hazard)) == Blocking;
+    }
+
+    bool IsPassable(const Vector3i& position) { return IsPassable(position.x, position.y, position.z); }
+    bool IsStandable(const Vector3i& position) { return IsStandable(position.x, position.y, position.z); }
+
+    // Incremented for every change to the world that can change the cells.
+    u64 GetVersion() const noexcept { return m_Version; }
+
+    /**
+     * Appends the changes made after version, oldest first.
+     * Returns false if they are no longer all known, either because there were more than MaxChanges or the grid was cleared.
+     */
+    bool MCLIB_API GetChangesSince(u64 version, std::vector<NavigationChange>& changes) const;
+
+    std::size_t GetCachedSectionCount() const noexcept { return m_Sections.size(); }
+
+    // Records a change to the block and drops the cached section containing it.
+    void MCLIB_API Invalidate(const Vector3i& position);
+    void MCLIB_API Clear();
+
+    void MCLIB_API OnChunkLoad(ChunkPtr chunk, const ChunkColumnMetadata& meta, u16 yIndex) override;
+    void MCLIB_API OnChunkUnload(ChunkColumnPtr chunk) override;
+    void MCLIB_API OnBlockChange(Vector3i position, block::BlockPtr newBlock, block::BlockPtr oldBlock) override;
+    void MCLIB_API OnBlockChanges(const std::vector<BlockChange>& changes) override;
+};
+
+} // ns world
+} // ns mc
+
+#endif
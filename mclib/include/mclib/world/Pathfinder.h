@@ -0,0 +1,106 @@
+#ifndef MCLIB_WORLD_PATHFINDER_H_
+#define MCLIB_WORLD_PATHFINDER_H_
+
+#include <mclib/mclib.h>
+#include <mclib/common/Types.h>
+#include <mclib/common/Vector.h>
+#include <mclib/world/NavigationGrid.h>
+
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace mc {
+namespace world {
+
+struct Path {
+    // Feet positions from the start, ending at the goal or at the closest position to it that could be reached
+    std::vector<Vector3i> nodes;
+    bool complete;
+    // Nodes taken off the open list
+    std::size_t expanded;
+
+    Path() : complete(false), expanded(0) { }
+};
+
+struct PathEdge {
+    Vector3i to;
+    double cost;
+};
+
+/**
+ * A* search over a NavigationGrid for a walking player.
+ * Besides walking to the 8 neighbors, a move can jump up one block or drop down a few blocks.
+ * Diagonal moves need both of the blocks beside them to be clear, so they never cut corners.
+ * The search buffers are kept between queries.
+ */
+class Pathfinder {
+public:
+    static constexpr double WalkCost = 1.0;
+    static constexpr double DiagonalCost = 1.41421356237;
+    static constexpr double JumpCost = 2.0;
+    // Added per block dropped
+    static constexpr double DropCost = 0.5;
+
+private:
+    struct Node {
+        Vector3i position;
+        double cost;
+        u32 parent;
+        bool closed;
+    };
+
+    NavigationGrid& m_Grid;
+    s32 m_MaxDrop;
+    std::size_t m_MaxNodes;
+
+    std::vector<Node> m_Nodes;
+    std::unordered_map<u64, u32> m_NodeIndex;
+    // Estimated total cost and node, as a min heap
+    std::vector<std::pair<double, u32>> m_Open;
+    std::vector<PathEdge> m_Edges;
+
+public:
+    // Identifies a position in the world, for keying nodes.
+    static u64 GetKey(const Vector3i& position) noexcept {
+        return ((u64)(position.x & 0xFFFFFFF) << 36) | ((u64)(position.z & 0xFFFFFFF) << 8) | (u64)(position.y & 0xFF);
+    }
+
+    MCLIB_API Pathfinder(NavigationGrid& grid);
+
+    Pathfinder(const Pathfinder& rhs) = delete;
+    Pathfinder& operator=(const Pathfinder& rhs) = delete;
+
+    NavigationGrid& GetGrid() noexcept { return m_Grid; }
+
+    // How many blocks a move can drop down. Defaults to 3, the most a player can fall without taking damage.
+    void SetMaxDrop(s32 blocks) noexcept { m_MaxDrop = blocks; }
+    s32 GetMaxDrop() const noexcept { return m_MaxDrop; }
+    // Searches give up after expanding this many nodes and return a path to the closest one.
+    void SetMaxNodes(std::size_t nodes) noexcept { m_MaxNodes = nodes; }
+    std::size_t GetMaxNodes() const noexcept { return m_MaxNodes; }
+
+    // Appends the moves that can be made from a standable position.
+    void MCLIB_API GetNeighbors(const Vector3i& from, std::vector<PathEdge>& edges);
+    // Appends the moves that end at to. The edges hold the positions the moves start from.
+    void MCLIB_API GetPredecessors(const Vector3i& to, std::vector<PathEdge>& edges);
+    // Cost of the single move, or infinity if GetNeighbors wouldn't return it.
+    double MCLIB_API GetMoveCost(const Vector3i& from, const Vector3i& to);
+
+    // Standable position at or near position, or position itself if there isn't one.
+    Vector3i MCLIB_API FindStandable(const Vector3i& position);
+
+    // Lower bound of the cost between two positions.
+    static MCLIB_API double EstimateCost(const Vector3i& from, const Vector3i& to);
+
+    /**
+     * Positions are the blocks the feet are in. Start is moved onto the ground if it's just above it.
+     * If the goal can't be reached, the path leads to the reached position closest to it.
+     */
+    Path MCLIB_API FindPath(const Vector3i& start, const Vector3i& goal);
+};
+
+} // ns world
+} // ns mc
+
+#endif
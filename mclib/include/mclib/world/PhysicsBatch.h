@@ -0,0 +1,157 @@
+#ifndef MCLIB_WORLD_PHYSICS_BATCH_H_
+#define MCLIB_WORLD_PHYSICS_BATCH_H_
+
+#include <mclib/mclib.h>
+#include <mclib/common/AABB.h>
+#include <mclib/common/Types.h>
+#include <mclib/common/Vector.h>
+#include <mclib/world/Collision.h>
+
+#include <memory>
+#include <vector>
+
+namespace mc {
+namespace world {
+
+class World;
+
+/**
+ * Steps the movement of many player sized bodies at once, the way PlayerController moves a single player.
+ * Bodies walk towards their target without going through blocks, step up ledges like Collider::Move does
+ * and fall until they land.
+ *
+ * The body state is kept as one array per field, so working out where the bodies walk runs over all of them with SIMD.
+ * Bodies are then sorted by the chunk section they're in, and the bodies of a world in the same section
+ * share one gather of collision boxes, as long as that reads no more blocks than gathering for each of them would.
+ * The shared boxes are bucketed by block column, so each body only looks at the boxes under its own feet.
+ * Bodies of different worlds in the same section are still stepped one after another, which keeps the chunk
+ * sections that the worlds share in the cache.
+ */
+class PhysicsBatch {
+public:
+    typedef u32 BodyId;
+
+private:
+    enum BodyFlags : u8 {
+        Alive = 1 << 0,
+        Falls = 1 << 1,
+        OnGround = 1 << 2
+    };
+
+    struct WorldEntry {
+        const World* world;
+        std::unique_ptr<Collider> collider;
+        std::size_t bodies;
+    };
+
+    struct SortEntry {
+        // Chunk section of the body, then its world
+        u64 section;
+        u32 world;
+        BodyId body;
+
+        bool operator<(const SortEntry& other) const noexcept {
+            if (section != other.section) return section < other.section;
+            return world < other.world;
+        }
+    };
+
+    // Blocks that a gather of collision boxes reads, inclusive
+    struct BlockArea {
+        s64 minX, minY, minZ;
+        s64 maxX, maxY, maxZ;
+
+        s64 GetVolume() const noexcept { return (maxX - minX + 1) * (maxY - minY + 1) * (maxZ - minZ + 1); }
+    };
+
+    AABB m_Bounds;
+    // Blocks per second
+    double m_FallSpeed;
+
+    std::vector<double> m_X;
+    std::vector<double> m_Y;
+    std::vector<double> m_Z;
+    std::vector<double> m_TargetX;
+    std::vector<double> m_TargetZ;
+    // Blocks per second, zero for removed bodies so the walking step leaves them alone
+    std::vector<double> m_Speed;
+    // Highest ledge the body walks up onto
+    std::vector<double> m_StepHeight;
+    // Where the body wants to walk in the current step, before it's stopped by blocks
+    std::vector<double> m_MotionX;
+    std::vector<double> m_MotionZ;
+    std::vector<u32> m_World;
+    std::vector<u8> m_Flags;
+    std::vector<BodyId> m_FreeBodies;
+
+    std::vector<WorldEntry> m_Worlds;
+
+    // Sorted bodies of the last step. Rebuilt after bodies were added or removed.
+    std::vector<SortEntry> m_Order;
+    bool m_OrderChanged;
+    // Scratch buffers of Collide
+    std::vector<SortEntry> m_Moved;
+    std::vector<SortEntry> m_Merged;
+    std::vector<AABB> m_Areas;
+    std::vector<BlockArea> m_BlockAreas;
+    std::vector<AABB> m_CellBoxes;
+    std::vector<u32> m_CellStarts;
+    std::vector<AABB> m_BodyBoxes;
+    // Column of the last IsLoaded call
+    const World* m_LastWorld;
+    s64 m_LastColumnX;
+    s64 m_LastColumnZ;
+    bool m_LastLoaded;
+
+    void Walk(double dt);
+    void SortBodies(double fall);
+    void Collide(double fall);
+    bool IsLoaded(BodyId body);
+    // Walks the body by its motion against the boxes, then climbs onto the block it's inside of or falls.
+    void Resolve(BodyId body, double fall, const AABB* begin, const AABB* end);
+
+public:
+    // Bodies are player sized by default.
+    MCLIB_API PhysicsBatch();
+
+    PhysicsBatch(const PhysicsBatch& rhs) = delete;
+    PhysicsBatch& operator=(const PhysicsBatch& rhs) = delete;
+
+    // Adds a body standing still at position. The world has to outlive the body.
+    BodyId MCLIB_API AddBody(const World& world, const Vector3d& position);
+    void MCLIB_API RemoveBody(BodyId body);
+
+    std::size_t GetBodyCount() const noexcept { return m_X.size() - m_FreeBodies.size(); }
+
+    Vector3d GetPosition(BodyId body) const noexcept { return Vector3d(m_X[body], m_Y[body], m_Z[body]); }
+    // Moves the body there and stops it.
+    void MCLIB_API SetPosition(BodyId body, const Vector3d& position);
+
+    // The body walks towards the target's x and z at speed blocks per second until it's there, stepping up ledges up to stepHeight.
+    void SetTarget(BodyId body, const Vector3d& target, double speed, double stepHeight) noexcept {
+        m_TargetX[body] = target.x;
+        m_TargetZ[body] = target.z;
+        m_Speed[body] = speed;
+        m_StepHeight[body] = stepHeight;
+    }
+
+    void Stop(BodyId body) noexcept { SetTarget(body, GetPosition(body), 0.0, 0.0); }
+
+    // Bodies that don't fall count as being on the ground.
+    void MCLIB_API SetFalls(BodyId body, bool falls);
+    // Stood on something or climbed onto a block in the last step. Only bodies on the ground step up ledges.
+    bool IsOnGround(BodyId body) const noexcept { return (m_Flags[body] & OnGround) != 0; }
+
+    // Bounding box of every body, relative to its position.
+    void SetBounds(const AABB& bounds) noexcept { m_Bounds = bounds; }
+    const AABB& GetBounds() const noexcept { return m_Bounds; }
+    void SetFallSpeed(double blocksPerSecond) noexcept { m_FallSpeed = blocksPerSecond; }
+
+    // Moves every body by dt seconds.
+    void MCLIB_API Step(double dt);
+};
+
+} // ns world
+} // ns mc
+
+#endif
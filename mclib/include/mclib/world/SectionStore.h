@@ -0,0 +1,66 @@
+#ifndef MCLIB_WORLD_SECTION_STORE_H_
+#define MCLIB_WORLD_SECTION_STORE_H_
+
+#include <mclib/mclib.h>
+#include <mclib/common/Types.h>
+#include <mclib/world/Chunk.h>
+
+#include <mutex>
+#include <unordered_map>
+
+namespace mc {
+namespace world {
+
+struct SectionStoreStats {
+    // Distinct sections that are still used by at least one world
+    std::size_t sections;
+    // Memory used by those sections
+    std::size_t bytes;
+    // Memory the same sections would use if every reference had its own copy
+    std::size_t referencedBytes;
+    u64 lookups;
+    u64 hits;
+};
+
+/**
+ * Process-wide store of chunk sections keyed by their content.
+ * Many clients in the same area of a server receive identical sections, so each distinct section
+ * is only kept once and shared between worlds. Shared sections are immutable, and World copies one before changing it.
+ * A section is dropped from the store when the last world releases it.
+ * Safe to use from any thread.
+ */
+class SectionStore {
+private:
+    mutable std::mutex m_Mutex;
+    // Only weak references, the worlds own the sections.
+    std::unordered_multimap<u64, std::weak_ptr<Chunk>> m_Sections;
+    // Live entries after the last sweep, so expired entries are swept once the map doubles.
+    std::size_t m_SweepSize;
+    u64 m_Lookups;
+    u64 m_Hits;
+
+    static u64 Hash(const Chunk& section);
+    static bool Equals(const Chunk& first, const Chunk& second);
+    void Sweep();
+
+public:
+    MCLIB_API SectionStore();
+
+    SectionStore(const SectionStore& rhs) = delete;
+    SectionStore& operator=(const SectionStore& rhs) = delete;
+
+    static MCLIB_API SectionStore& GetInstance();
+
+    /**
+     * Returns the stored section with the same content, or stores this one and marks it shared.
+     * The given section must not be used for writing afterwards.
+     */
+    MCLIB_API ChunkPtr Intern(const ChunkPtr& section);
+
+    SectionStoreStats MCLIB_API GetStats() const;
+};
+
+} // ns world
+} // ns mc
+
+#endif
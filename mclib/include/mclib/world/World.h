@@ -2,33 +2,142 @@
 #define MCLIB_WORLD_WORLD_H_
 
 #include <mclib/world/Chunk.h>
+#include <mclib/world/ColdColumnStore.h>
+#include <mclib/world/SectionStore.h>
+#include <mclib/world/WorldSnapshot.h>
 #include <mclib/protocol/packets/PacketHandler.h>
 #include <mclib/protocol/packets/PacketDispatcher.h>
 #include <mclib/util/ObserverSubject.h>
+#include <mclib/util/ThreadPool.h>
 
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <limits>
 #include <map>
+#include <unordered_map>
 
 namespace mc {
 namespace world {
 
+struct BlockChange {
+    Vector3i position;
+    block::BlockPtr newBlock;
+    block::BlockPtr oldBlock;
+};
+
 class MCLIB_API WorldListener {
 public:
     // yIndex is the chunk section index of the column, 0 means bottom chunk, 15 means top
     virtual void OnChunkLoad(ChunkPtr chunk, const ChunkColumnMetadata& meta, u16 yIndex) { }
     virtual void OnChunkUnload(ChunkColumnPtr chunk) { }
     virtual void OnBlockChange(Vector3i position, block::BlockPtr newBlock, block::BlockPtr oldBlock) { }
+
+    /**
+     * Every block changed by a single packet, like a MultiBlockChange or an Explosion.
+     * Calls OnBlockChange for each of them unless overridden.
+     */
+    virtual void OnBlockChanges(const std::vector<BlockChange>& changes) {
+        for (const BlockChange& change : changes)
+            OnBlockChange(change.position, change.newBlock, change.oldBlock);
+    }
+};
+
+struct RaycastHit {
+    // Null if nothing was hit
+    block::BlockPtr block;
+    Vector3i position;
+    // Face of the block the ray entered through
+    Face face;
+    // Along the normalized ray direction
+    double distance;
+
+    RaycastHit() : block(nullptr), face(Face::Bottom), distance(0) { }
 };
 
 class World : public protocol::packets::PacketHandler, public util::ObserverSubject<WorldListener> {
+public:
+    using BlockChangeEvent = util::Event<const Vector3i&, block::BlockPtr, block::BlockPtr>;
+    using BlockChangesEvent = util::Event<const std::vector<BlockChange>&>;
+
 private:
     typedef std::pair<s32, s32> ChunkCoord;
 
     std::map<ChunkCoord, ChunkColumnPtr> m_Chunks;
+    const block::BlockRegistry* m_Registry;
+    BlockChangeEvent m_BlockChangeEvent;
+    BlockChangesEvent m_BlockChangesEvent;
+
+    // Only accessed with std::atomic_load/atomic_store
+    WorldSnapshotPtr m_Snapshot;
+    // Returned until the first snapshot is published
+    WorldSnapshotPtr m_EmptySnapshot;
+    // Sections changed since the last publish, per column. Only tracked once a snapshot was requested.
+    std::map<ChunkCoord, u16> m_SnapshotDirty;
+    mutable std::atomic<bool> m_SnapshotRequested;
+    bool m_SnapshotRebuild;
+
+    // A ChunkData packet that's being decoded on the pool.
+    struct PendingColumn {
+        ChunkCoord coord;
+        ChunkColumnMetadata metadata;
+        DataBuffer data;
+        // Null if decoding failed
+        ChunkColumnPtr column;
+        std::atomic<bool> finished;
+        // Changes to this column that arrived after it, applied once it's loaded
+        std::vector<std::function<void()>> held;
+    };
+
+    bool m_ShareSections;
+
+    // Columns outside of the hot area, null unless cold storage is enabled
+    std::unique_ptr<ColdColumnStore> m_ColdStore;
+    s32 m_HotRadius;
+    ChunkCoord m_HotCenter;
+    bool m_HotScanNeeded;
+
+    // Positions of indexed states per column, keyed by y << 8 | z << 4 | x. Cold columns keep their entries.
+    BlockTypeSet m_IndexedStates;
+    std::map<ChunkCoord, std::unordered_map<u16, u32>> m_BlockIndex;
+
+    // Can be shared with other worlds
+    std::shared_ptr<util::ThreadPool> m_DecodePool;
+    // In the order the packets arrived
+    std::deque<std::shared_ptr<PendingColumn>> m_PendingColumns;
+
+    void NotifyBlockChanges(const std::vector<BlockChange>& changes);
+    void MarkSnapshotDirty(const ChunkCoord& coord, u16 sections);
+
+    static ChunkCoord GetChunkCoord(const Vector3i& pos);
+    // Hot column that can be changed, moved out of cold storage if needed.
+    ChunkColumnPtr GetLiveColumn(const ChunkCoord& coord);
+    ChunkColumnPtr PromoteColumn(const ChunkCoord& coord);
+    // Replaces the sections with the ones in the SectionStore if sharing is enabled.
+    void ShareSections(ChunkColumn& column);
+    // Creates the section if it's air and copies it if it's shared with other worlds.
+    Chunk& GetWritableSection(ChunkColumn& column, std::size_t index);
+    struct ColumnCursor;
+    u32 GetBlockData(ColumnCursor& cursor, const Vector3i& pos) const;
+    bool Raycast(ColumnCursor& cursor, const Ray& ray, double maxDistance, RaycastHit* hit) const;
+
+    void IndexColumn(const ChunkCoord& coord, const ChunkColumn& column);
+    void UpdateBlockIndex(const ChunkCoord& coord, const Vector3i& relative, u32 blockData);
+    bool HoldForPendingColumn(const ChunkCoord& coord, std::function<void()> apply);
+    void ApplyChunkColumn(ChunkColumnPtr col);
+    void ApplyBlockChange(Vector3i position, s32 blockId);
+    // Positions are relative to the column. Appends the changes that were made.
+    void SetColumnBlocks(const ChunkCoord& coord, const std::vector<protocol::packets::in::MultiBlockChangePacket::BlockChange>& changes,
+        std::vector<BlockChange>& notifications);
+    void ApplyMultiBlockChange(const ChunkCoord& coord, const std::vector<protocol::packets::in::MultiBlockChangePacket::BlockChange>& changes);
+    void ApplyBlockEntity(Vector3i position, block::BlockEntityPtr entity);
+    void ApplyUnload(const ChunkCoord& coord);
 
     bool MCLIB_API SetBlock(Vector3i position, u32 blockData);
 
 public:
-    MCLIB_API World(protocol::packets::PacketDispatcher* dispatcher);
+    // Blocks are looked up in registry, BlockRegistry::GetInstance() if it's null.
+    MCLIB_API World(protocol::packets::PacketDispatcher* dispatcher, const block::BlockRegistry* registry = nullptr);
     MCLIB_API ~World();
 
     World(const World& rhs) = delete;
@@ -36,6 +145,52 @@ public:
     World(World&& rhs) = delete;
     World& operator=(World&& rhs) = delete;
 
+    // Subscribe here instead of implementing WorldListener::OnBlockChange to only receive block changes.
+    BlockChangeEvent& GetBlockChangeEvent() noexcept { return m_BlockChangeEvent; }
+    // Every change made by a packet in one call. Block changes are dispatched to both events.
+    BlockChangesEvent& GetBlockChangesEvent() noexcept { return m_BlockChangesEvent; }
+
+    const block::BlockRegistry* GetRegistry() const noexcept { return m_Registry; }
+
+    /**
+     * Deduplicate sections through SectionStore::GetInstance, so worlds of clients in the same area share identical sections.
+     * Applies to columns loaded or moved out of cold storage after enabling it. Disabled by default.
+     */
+    void SetSectionSharing(bool enabled) noexcept { m_ShareSections = enabled; }
+    bool IsSectionSharing() const noexcept { return m_ShareSections; }
+
+    /**
+     * Keep columns more than hotRadius columns away from the center given to UpdateColdStorage compressed.
+     * GetChunk and GetBlock still see them, and the most recently read ones stay decompressed within cacheBudget bytes.
+     * A cold column is moved back to the hot set when it changes or the center gets close to it.
+     * Cold columns aren't included when iterating the world, but snapshots still have them.
+     */
+    void MCLIB_API EnableColdStorage(s32 hotRadius, std::size_t cacheBudget);
+    // Decompresses every cold column.
+    void MCLIB_API DisableColdStorage();
+    bool IsColdStorageEnabled() const noexcept { return m_ColdStore != nullptr; }
+    // Moves columns between the tiers, only does work when the center changed column or new columns arrived.
+    void MCLIB_API UpdateColdStorage(Vector3d center);
+    ColdColumnStats MCLIB_API GetColdStorageStats() const;
+
+    /**
+     * Decode ChunkData sections on pool instead of on the packet thread. Null decodes inline, which is the default.
+     * One pool can serve any number of worlds, so many clients in one process don't each need their own threads.
+     * Columns are still loaded in the order they arrived, from ApplyDecodedColumns on the packet thread.
+     * Block changes for a column that's still being decoded are held back and applied right after it's loaded.
+     */
+    void MCLIB_API SetDecodePool(std::shared_ptr<util::ThreadPool> pool);
+    const std::shared_ptr<util::ThreadPool>& GetDecodePool() const noexcept { return m_DecodePool; }
+    // Gives this world a pool of its own with count threads. 0 decodes inline.
+    void MCLIB_API SetDecodeThreads(std::size_t count);
+    std::size_t GetDecodeThreads() const noexcept { return m_DecodePool ? m_DecodePool->GetThreadCount() : 0; }
+    std::size_t GetPendingColumnCount() const noexcept { return m_PendingColumns.size(); }
+
+    // Loads every decoded column that isn't waiting on an earlier one. Call regularly from the packet thread.
+    void MCLIB_API ApplyDecodedColumns();
+    // Waits for every pending column and loads them, helping with the decoding meanwhile.
+    void MCLIB_API FinishPendingColumns();
+
     void MCLIB_API HandlePacket(protocol::packets::in::ChunkDataPacket* packet);
     void MCLIB_API HandlePacket(protocol::packets::in::UnloadChunkPacket* packet);
     void MCLIB_API HandlePacket(protocol::packets::in::MultiBlockChangePacket* packet);
@@ -45,18 +200,65 @@ public:
     void MCLIB_API HandlePacket(protocol::packets::in::RespawnPacket* packet);
 
     /**
-     * Pos can be any world position inside of the chunk
+     * Pos can be any world position inside of the chunk.
+     * Cold columns are read from the cache in the cold store, so reading through a const World can't change them.
      */
-    ChunkColumnPtr MCLIB_API GetChunk(Vector3i pos) const;
+    ConstChunkColumnPtr MCLIB_API GetChunk(Vector3i pos) const;
+    // For changing the column. A cold column moves back to the hot set first, so the changes aren't lost.
+    ChunkColumnPtr MCLIB_API GetChunk(Vector3i pos);
+
+    /**
+     * y of the highest block of the type at x, z plus one, from the column's heightmap.
+     * 0 if there are none or the column isn't loaded.
+     */
+    s32 MCLIB_API GetHeight(s64 x, s64 z, HeightmapType type = HeightmapType::Solid) const;
 
     block::BlockPtr MCLIB_API GetBlock(Vector3d pos) const;
     block::BlockPtr MCLIB_API GetBlock(Vector3f pos) const;
     block::BlockPtr MCLIB_API GetBlock(Vector3i pos) const;
 
+    /**
+     * Keep an index of where these states are, updated as columns load and blocks change.
+     * FindBlocks and ForEachBlockNearest use it for any subset of these states instead of scanning sections.
+     * Rebuilds the index from the loaded columns.
+     */
+    void MCLIB_API SetIndexedStates(const BlockTypeSet& states);
+    const BlockTypeSet& GetIndexedStates() const noexcept { return m_IndexedStates; }
+
+    /**
+     * Visits every block matching states within radius of center, nearest first, until visitor returns false.
+     * Sections whose palette has none of the states are skipped without looking at their blocks.
+     */
+    void MCLIB_API ForEachBlockNearest(const BlockTypeSet& states, Vector3d center, double radius,
+        const std::function<bool(const Vector3i&, block::BlockPtr)>& visitor) const;
+    // Positions of up to maxResults matching blocks within radius of center, nearest first.
+    MCLIB_API std::vector<Vector3i> FindBlocks(const BlockTypeSet& states, Vector3d center, double radius,
+        std::size_t maxResults = (std::numeric_limits<std::size_t>::max)()) const;
+
+    /**
+     * Walks the blocks along the ray in order and tests each block's bounding boxes, stopping at the first hit within maxDistance.
+     * Blocks without a bounding box, like air and plants, are passed through. The ray direction doesn't have to be normalized.
+     */
+    bool MCLIB_API Raycast(const Ray& ray, double maxDistance, RaycastHit* hit) const;
+    // One hit per ray, in the same order. Rays close to each other share the column lookups.
+    MCLIB_API std::vector<RaycastHit> Raycast(const std::vector<Ray>& rays, double maxDistance) const;
+
     MCLIB_API block::BlockEntityPtr GetBlockEntity(Vector3i pos) const;
     // Gets all of the known block entities in loaded chunks
     MCLIB_API std::vector<block::BlockEntityPtr> GetBlockEntities() const;
 
+    /**
+     * Returns the latest published snapshot. Can be called from any thread.
+     * Snapshots are only built after the first call, so that first call returns an empty snapshot.
+     */
+    WorldSnapshotPtr MCLIB_API GetSnapshot() const;
+
+    /**
+     * Publishes the changes made since the last call as a new snapshot. Call from the thread that handles packets.
+     * Does nothing if nothing changed or no snapshot was ever requested.
+     */
+    void MCLIB_API PublishSnapshot();
+
     const std::map<ChunkCoord, ChunkColumnPtr>::const_iterator begin() const { return m_Chunks.begin(); }
     const std::map<ChunkCoord, ChunkColumnPtr>::const_iterator end() const { return m_Chunks.end(); }
 };
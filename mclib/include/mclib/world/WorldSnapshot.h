@@ -0,0 +1,61 @@
+#ifndef MCLIB_WORLD_WORLD_SNAPSHOT_H_
+#define MCLIB_WORLD_WORLD_SNAPSHOT_H_
+
+#include <mclib/mclib.h>
+#include <mclib/common/Vector.h>
+#include <mclib/world/Chunk.h>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace mc {
+namespace world {
+
+using ConstChunkColumnPtr = std::shared_ptr<const ChunkColumn>;
+
+/**
+ * Immutable copy of the world's blocks at the time it was published.
+ * Safe to read from any thread while the packet thread keeps changing the world.
+ * Sections that didn't change between versions are shared, so a new version only copies what changed.
+ * Block entities aren't part of the snapshot.
+ */
+class WorldSnapshot {
+public:
+    typedef std::pair<s32, s32> ChunkCoord;
+    typedef std::pair<ChunkCoord, ConstChunkColumnPtr> Entry;
+    typedef std::vector<Entry>::const_iterator const_iterator;
+
+private:
+    // Sorted by coordinate
+    std::vector<Entry> m_Columns;
+    u64 m_Version;
+    const block::BlockRegistry* m_Registry;
+
+    friend class World;
+
+public:
+    MCLIB_API WorldSnapshot();
+
+    u64 GetVersion() const noexcept { return m_Version; }
+    std::size_t GetColumnCount() const noexcept { return m_Columns.size(); }
+
+    /**
+     * Pos can be any world position inside of the chunk
+     */
+    ConstChunkColumnPtr MCLIB_API GetChunk(Vector3i pos) const;
+    ConstChunkColumnPtr MCLIB_API GetChunk(s32 chunkX, s32 chunkZ) const;
+
+    block::BlockPtr MCLIB_API GetBlock(Vector3i pos) const;
+    block::BlockPtr MCLIB_API GetBlock(Vector3d pos) const;
+
+    const_iterator begin() const { return m_Columns.begin(); }
+    const_iterator end() const { return m_Columns.end(); }
+};
+
+typedef std::shared_ptr<const WorldSnapshot> WorldSnapshotPtr;
+
+} // ns world
+} // ns mc
+
+#endif
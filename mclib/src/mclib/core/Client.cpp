@@ -19,7 +19,7 @@ Client::Client(protocol::packets::PacketDispatcher* dispatcher, protocol::Versio
     m_Connection(m_Dispatcher, version),
     m_EntityManager(m_Dispatcher, version),
     m_PlayerManager(m_Dispatcher, &m_EntityManager),
-    m_World(m_Dispatcher),
+    m_World(m_Dispatcher, block::BlockRegistry::GetInstance(version)),
     m_PlayerController(std::make_unique<util::PlayerController>(&m_Connection, m_World, m_PlayerManager)),
     m_LastUpdate(0),
     m_Connected(false),
@@ -52,8 +52,17 @@ void Client::Update() {
     if (playerEntity) {
         // Keep entity manager and player controller in sync
         playerEntity->SetPosition(m_PlayerController->GetPosition());
+        m_EntityManager.UpdatePosition(playerEntity->GetEntityId());
+        m_World.UpdateColdStorage(playerEntity->GetPosition());
     }
 
+    // Only has work to do when the world was given a decode pool.
+    m_World.ApplyDecodedColumns();
+
+    // Readers on other threads see everything handled in this update at once.
+    m_World.PublishSnapshot();
+    m_EntityManager.PublishSnapshot();
+
     s64 time = util::GetTime();
     if (time >= m_LastUpdate + (1000 / 20)) {
         m_PlayerController->Update();
@@ -9,6 +9,7 @@
 #include <mclib/protocol/packets/PacketFactory.h>
 #include <mclib/util/Utility.h>
 
+#include <algorithm>
 #include <future>
 #include <thread>
 #include <memory>
@@ -24,7 +25,11 @@ Connection::Connection(protocol::packets::PacketDispatcher* dispatcher, protocol
     m_Yggdrasil(std::make_unique<util::Yggdrasil>()),
     m_Protocol(protocol::Protocol::GetProtocol(version)),
     m_SentSettings(false),
-    m_Dimension(1)
+    m_Dimension(1),
+    m_PipelineEnabled(false),
+    m_PriorityLaneEnabled(true),
+    m_Compressed(false),
+    m_ReceiveTime(0)
 {
     dispatcher->RegisterHandler(protocol::State::Login, protocol::login::Disconnect, this);
     dispatcher->RegisterHandler(protocol::State::Login, protocol::login::EncryptionRequest, this);
@@ -42,6 +47,7 @@ Connection::Connection(protocol::packets::PacketDispatcher* dispatcher, protocol
 }
 
 Connection::~Connection() {
+    StopPipeline();
     GetDispatcher()->UnregisterHandler(this);
 }
 
@@ -50,24 +56,53 @@ network::Socket::Status Connection::GetSocketState() const {
 }
 
 void Connection::HandlePacket(protocol::packets::in::JoinGamePacket* packet) {
+    // The pipeline's decode thread owns the dimension while it runs. It stored this one when it decoded
+    // the packet and may already be past a newer dimension change.
+    if (m_Pipeline && m_Pipeline->IsRunning()) return;
+
     m_Dimension = packet->GetDimension();
 }
 
 void Connection::HandlePacket(protocol::packets::in::RespawnPacket* packet) {
+    if (m_Pipeline && m_Pipeline->IsRunning()) return;
+
     m_Dimension = packet->GetDimension();
 }
 
+namespace {
+
+template <typename T>
+bool TakeAnswered(std::mutex& mutex, std::vector<T>& answered, T value) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto iter = std::find(answered.begin(), answered.end(), value);
+    if (iter == answered.end()) return false;
+
+    answered.erase(iter);
+    return true;
+}
+
+} // ns
+
 void Connection::HandlePacket(protocol::packets::in::KeepAlivePacket* packet) {
+    if (TakeAnswered(m_PriorityMutex, m_AnsweredKeepAlives, packet->GetAliveId())) return;
+
     protocol::packets::out::KeepAlivePacket response(packet->GetAliveId());
     SendPacket(&response);
+
+    // The receive time is only tracked here when the owner thread reads the socket itself.
+    if (!m_Pipeline || !m_Pipeline->IsRunning())
+        m_KeepAliveLatency.Record(util::LatencyTracker::Now() - m_ReceiveTime);
 }
 
 void Connection::HandlePacket(protocol::packets::in::PlayerPositionAndLookPacket* packet) {
     using namespace protocol::packets;
 
     // Used to verify position
-    out::TeleportConfirmPacket confirmation(packet->GetTeleportId());
-    SendPacket(&confirmation);
+    if (!TakeAnswered(m_PriorityMutex, m_ConfirmedTeleports, packet->GetTeleportId())) {
+        out::TeleportConfirmPacket confirmation(packet->GetTeleportId());
+        SendPacket(&confirmation);
+    }
 
     out::PlayerPositionAndLookPacket response(packet->GetPosition(),
         packet->GetYaw(), packet->GetPitch(), true);
@@ -85,6 +120,7 @@ void Connection::HandlePacket(protocol::packets::in::UpdateHealthPacket* packet)
 }
 
 void Connection::HandlePacket(protocol::packets::in::DisconnectPacket* packet) {
+    StopPipeline();
     m_Socket->Disconnect();
 
     NotifyListeners(&ConnectionListener::OnSocketStateChange, m_Socket->GetStatus());
@@ -160,11 +196,13 @@ void Connection::HandlePacket(protocol::packets::in::LoginSuccessPacket* packet)
 
 void Connection::HandlePacket(protocol::packets::in::SetCompressionPacket* packet) {
     m_Compressor = std::make_unique<CompressionZ>(packet->GetMaxPacketSize());
+    m_Compressed = true;
 }
 
 bool Connection::Connect(const std::string& server, u16 port) {
     bool result = false;
 
+    m_Pipeline.reset();
     m_Socket = std::make_unique<network::TCPSocket>();
     m_Yggdrasil = std::unique_ptr<util::Yggdrasil>(new util::Yggdrasil());
     m_ProtocolState = protocol::State::Handshake;
@@ -172,6 +210,14 @@ bool Connection::Connect(const std::string& server, u16 port) {
 
     m_Compressor = std::make_unique<CompressionNone>();
     m_Encrypter = std::make_unique<EncryptionStrategyNone>();
+    m_Compressed = false;
+    m_HandleBuffer = DataBuffer();
+
+    {
+        std::lock_guard<std::mutex> lock(m_PriorityMutex);
+        m_AnsweredKeepAlives.clear();
+        m_ConfirmedTeleports.clear();
+    }
 
     m_Server = server;
     m_Port = port;
@@ -201,6 +247,7 @@ bool Connection::Connect(const std::string& server, u16 port) {
 }
 
 void Connection::Disconnect() {
+    StopPipeline();
     m_Socket->Disconnect();
     NotifyListeners(&ConnectionListener::OnSocketStateChange, m_Socket->GetStatus());
 }
@@ -229,7 +276,181 @@ protocol::packets::Packet* Connection::CreatePacket(DataBuffer& buffer) {
     return protocol::packets::PacketFactory::CreatePacket(m_Protocol, m_ProtocolState, decompressed, length.GetInt(), this);
 }
 
+void Connection::StartPipeline() {
+    // Whatever is left in the handle buffer was already decrypted, so the pipeline continues from there.
+    DataBuffer pending;
+    if (!m_HandleBuffer.IsFinished())
+        pending = DataBuffer(m_HandleBuffer, m_HandleBuffer.GetReadOffset());
+
+    m_HandleBuffer = DataBuffer();
+
+    m_Pipeline = std::make_unique<PacketPipeline>(this, m_Protocol, m_Socket.get(), m_Encrypter.get(), m_Compressor.get());
+    m_Pipeline->Start(std::move(pending));
+}
+
+protocol::packets::Packet* Connection::HandlePriorityFrame(DataBuffer& data, std::size_t length, s64 receivedAt) {
+    using namespace protocol::packets;
+
+    std::size_t start = data.GetReadOffset();
+    s32 protocolId;
+
+    // Only the id is read here, everything else goes through the normal path untouched.
+    try {
+        if (m_Compressed) {
+            VarInt dataLength;
+            data >> dataLength;
+
+            // Time critical packets are all too small to be compressed.
+            if (dataLength.GetInt() != 0) {
+                data.SetReadOffset(start);
+                return nullptr;
+            }
+        }
+
+        VarInt id;
+        data >> id;
+        protocolId = id.GetInt();
+    } catch (const std::out_of_range&) {
+        data.SetReadOffset(start);
+        return nullptr;
+    }
+
+    data.SetReadOffset(start);
+
+    s32 agnosticId;
+    if (!m_Protocol.GetAgnosticId(protocol::State::Play, protocolId, agnosticId))
+        return nullptr;
+
+    if (agnosticId != protocol::play::KeepAlive && agnosticId != protocol::play::PlayerPositionAndLook && agnosticId != protocol::play::Disconnect)
+        return nullptr;
+
+    Packet* packet = nullptr;
+
+    try {
+        DataBuffer frame;
+        data.ReadSome(frame, length);
+
+        DataBuffer decompressed = m_Compressor->Decompress(frame, length);
+        packet = PacketFactory::CreatePacket(m_Protocol, protocol::State::Play, decompressed, length, this);
+    } catch (const protocol::UnfinishedProtocolException&) {
+        packet = nullptr;
+    } catch (const std::exception&) {
+        packet = nullptr;
+    }
+
+    data.SetReadOffset(start);
+
+    if (!packet) return nullptr;
+
+    if (agnosticId == protocol::play::Disconnect)
+        return packet;
+
+    if (agnosticId == protocol::play::KeepAlive) {
+        s64 aliveId = static_cast<in::KeepAlivePacket*>(packet)->GetAliveId();
+
+        {
+            std::lock_guard<std::mutex> lock(m_PriorityMutex);
+            m_AnsweredKeepAlives.push_back(aliveId);
+        }
+
+        out::KeepAlivePacket response(aliveId);
+        SendPacket(&response);
+
+        m_KeepAliveLatency.Record(util::LatencyTracker::Now() - receivedAt);
+    } else {
+        s32 teleportId = static_cast<in::PlayerPositionAndLookPacket*>(packet)->GetTeleportId();
+
+        {
+            std::lock_guard<std::mutex> lock(m_PriorityMutex);
+            m_ConfirmedTeleports.push_back(teleportId);
+        }
+
+        out::TeleportConfirmPacket confirmation(teleportId);
+        SendPacket(&confirmation);
+    }
+
+    PacketFactory::FreePacket(packet);
+    return nullptr;
+}
+
+bool Connection::HandlePriorityFrames() {
+    std::size_t start = m_HandleBuffer.GetReadOffset();
+
+    while (!m_HandleBuffer.IsFinished()) {
+        VarInt length;
+
+        try {
+            m_HandleBuffer >> length;
+        } catch (const std::out_of_range&) {
+            break;
+        }
+
+        if (length.GetInt() <= 0) {
+            // Nothing after a bad length can be framed, so the connection can't continue.
+            m_HandleBuffer = DataBuffer();
+            Disconnect();
+            return true;
+        }
+
+        if (m_HandleBuffer.GetRemaining() < (u32)length.GetInt())
+            break;
+
+        std::size_t dataStart = m_HandleBuffer.GetReadOffset();
+        protocol::packets::Packet* urgent = HandlePriorityFrame(m_HandleBuffer, length.GetInt(), m_ReceiveTime);
+
+        if (urgent) {
+            // The server is closing the connection, so nothing queued behind this matters anymore.
+            m_HandleBuffer = DataBuffer();
+
+            this->GetDispatcher()->Dispatch(urgent);
+            protocol::packets::PacketFactory::FreePacket(urgent);
+            return true;
+        }
+
+        m_HandleBuffer.SetReadOffset(dataStart + length.GetInt());
+    }
+
+    m_HandleBuffer.SetReadOffset(start);
+    return false;
+}
+
+void Connection::StopPipeline() {
+    if (m_Pipeline)
+        m_Pipeline->Stop();
+}
+
+void Connection::DispatchPipeline() {
+    // Read before polling so every packet decoded before the socket closed gets dispatched.
+    bool closed = m_Pipeline->IsClosed();
+
+    while (protocol::packets::Packet* packet = m_Pipeline->Poll()) {
+        if (!m_SentSettings)
+            SendSettingsPacket();
+
+        this->GetDispatcher()->Dispatch(packet);
+        protocol::packets::PacketFactory::FreePacket(packet);
+
+        // A handler disconnected.
+        if (!m_Pipeline->IsRunning()) return;
+    }
+
+    if (closed) {
+        m_Pipeline->Stop();
+
+        // Still connected means the pipeline stopped on a bad frame.
+        if (m_Socket->GetStatus() == network::Socket::Connected)
+            m_Socket->Disconnect();
+
+        NotifyListeners(&ConnectionListener::OnSocketStateChange, m_Socket->GetStatus());
+    }
+}
+
 void Connection::CreatePacket() {
+    if (m_Pipeline && m_Pipeline->IsRunning()) {
+        DispatchPipeline();
+        return;
+    }
+
     while (true) {
         DataBuffer buffer;
 
@@ -243,9 +464,28 @@ void Connection::CreatePacket() {
         }
 
         m_HandleBuffer << m_Encrypter->Decrypt(buffer);
+        m_ReceiveTime = util::LatencyTracker::Now();
+
+        if (m_PriorityLaneEnabled && m_ProtocolState == protocol::State::Play) {
+            static const std::size_t MaxPriorityScan = 4 * 1024 * 1024;
+
+            // Pull in everything the socket already has, so time critical packets queued behind
+            // a chunk flood are answered before any of the chunks are decoded.
+            while (m_HandleBuffer.GetSize() < MaxPriorityScan) {
+                DataBuffer more;
+
+                m_Socket->Receive(more, 65536);
+                if (more.IsEmpty()) break;
+
+                m_HandleBuffer << m_Encrypter->Decrypt(more);
+            }
+
+            if (HandlePriorityFrames()) return;
+        }
 
         do {
             try {
+                protocol::State state = m_ProtocolState;
                 protocol::packets::Packet* packet = CreatePacket(m_HandleBuffer);
 
                 if (packet) {
@@ -256,6 +496,13 @@ void Connection::CreatePacket() {
 
                     this->GetDispatcher()->Dispatch(packet);
                     protocol::packets::PacketFactory::FreePacket(packet);
+
+                    // Only started when entering the play state. Frames the priority lane already answered
+                    // would be answered again by the pipeline's receive thread.
+                    if (m_PipelineEnabled && state != protocol::State::Play && m_ProtocolState == protocol::State::Play && m_Socket->GetStatus() == network::Socket::Connected) {
+                        StartPipeline();
+                        return;
+                    }
                 } else {
                     break;
                 }
@@ -329,6 +576,9 @@ bool Connection::Login(const std::string& username, AuthToken token) {
 }
 
 void Connection::HandlePacket(protocol::packets::in::status::ResponsePacket* packet) {
+    // Nobody to hand the parsed response to.
+    if (!HasListeners()) return;
+
     std::string response = mc::to_string(packet->GetResponse());
 
     json data;
@@ -0,0 +1,262 @@
+#include <mclib/core/PacketPipeline.h>
+
+#include <mclib/core/Compression.h>
+#include <mclib/core/Connection.h>
+#include <mclib/core/Encryption.h>
+#include <mclib/network/Socket.h>
+#include <mclib/protocol/packets/PacketFactory.h>
+#include <mclib/util/LatencyTracker.h>
+
+#include <chrono>
+
+namespace mc {
+namespace core {
+
+namespace {
+
+template <typename T>
+void UpdateMax(std::atomic<T>& current, T value) {
+    T previous = current.load(std::memory_order_relaxed);
+
+    while (previous < value && !current.compare_exchange_weak(previous, value, std::memory_order_relaxed))
+        ;
+}
+
+} // ns
+
+PacketPipeline::PacketPipeline(Connection* connection, protocol::Protocol& protocol, network::Socket* socket,
+    EncryptionStrategy* encrypter, CompressionStrategy* compressor, std::size_t queueSize)
+    : m_Connection(connection),
+      m_Protocol(protocol),
+      m_Socket(socket),
+      m_Encrypter(encrypter),
+      m_Compressor(compressor),
+      m_Frames(queueSize),
+      m_Packets(queueSize),
+      m_Urgent(16),
+      m_DecodeErrors(0),
+      m_Running(false),
+      m_ReceiveFinished(false),
+      m_Closed(false)
+{
+
+}
+
+PacketPipeline::~PacketPipeline() {
+    Stop();
+}
+
+void PacketPipeline::Start(DataBuffer pending) {
+    if (m_Running) return;
+
+    m_ReceiveBuffer = std::move(pending);
+    m_ReceiveFinished = false;
+    m_Closed = false;
+    m_Running = true;
+
+    m_ReceiveThread = std::thread(&PacketPipeline::ReceiveThread, this);
+    m_DecodeThread = std::thread(&PacketPipeline::DecodeThread, this);
+}
+
+void PacketPipeline::Stop() {
+    m_Running = false;
+
+    if (m_ReceiveThread.joinable())
+        m_ReceiveThread.join();
+    if (m_DecodeThread.joinable())
+        m_DecodeThread.join();
+
+    Frame frame;
+    while (m_Frames.TryPop(frame))
+        ;
+
+    Decoded decoded;
+    while (m_Packets.TryPop(decoded))
+        protocol::packets::PacketFactory::FreePacket(decoded.packet);
+    while (m_Urgent.TryPop(decoded))
+        protocol::packets::PacketFactory::FreePacket(decoded.packet);
+}
+
+template <typename T>
+bool PacketPipeline::Push(util::SPSCQueue<T>& queue, T&& value) {
+    // The queue being full means the next stage is behind, so wait for it instead of dropping packets.
+    while (!queue.TryPush(std::move(value))) {
+        if (!m_Running) return false;
+
+        std::this_thread::yield();
+    }
+
+    return true;
+}
+
+void PacketPipeline::Record(StageCounters& counters, std::size_t depth, s64 timestamp) {
+    u64 latency = (u64)std::max<s64>(util::LatencyTracker::Now() - timestamp, 0);
+
+    UpdateMax(counters.maxDepth, depth);
+    UpdateMax(counters.maxLatency, latency);
+    counters.totalLatency.fetch_add(latency, std::memory_order_relaxed);
+    counters.processed.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool PacketPipeline::ReadFrames() {
+    while (!m_ReceiveBuffer.IsFinished() && m_ReceiveBuffer.GetSize() > 0) {
+        std::size_t readOffset = m_ReceiveBuffer.GetReadOffset();
+        VarInt length;
+
+        try {
+            m_ReceiveBuffer >> length;
+        } catch (const std::out_of_range&) {
+            // Only part of the length was received.
+            break;
+        }
+
+        if (length.GetInt() <= 0) {
+            // Nothing after a bad length can be framed, so stop receiving. The owner thread drops the connection once it's closed.
+            m_DecodeErrors.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        if (m_ReceiveBuffer.GetRemaining() < (u32)length.GetInt()) {
+            m_ReceiveBuffer.SetReadOffset(readOffset);
+            break;
+        }
+
+        Frame frame;
+        m_ReceiveBuffer.ReadSome(frame.data, length.GetInt());
+        frame.length = length.GetInt();
+        frame.timestamp = util::LatencyTracker::Now();
+
+        if (m_Connection && m_Connection->IsPriorityLaneEnabled()) {
+            protocol::packets::Packet* urgent = m_Connection->HandlePriorityFrame(frame.data, frame.length, frame.timestamp);
+
+            if (urgent) {
+                if (!Push(m_Urgent, Decoded{ urgent, frame.timestamp })) {
+                    protocol::packets::PacketFactory::FreePacket(urgent);
+                    return false;
+                }
+                continue;
+            }
+        }
+
+        if (!Push(m_Frames, std::move(frame)))
+            return false;
+    }
+
+    if (m_ReceiveBuffer.IsFinished())
+        m_ReceiveBuffer = DataBuffer();
+    else if (m_ReceiveBuffer.GetReadOffset() != 0)
+        m_ReceiveBuffer = DataBuffer(m_ReceiveBuffer, m_ReceiveBuffer.GetReadOffset());
+
+    return true;
+}
+
+void PacketPipeline::ReceiveThread() {
+    bool running = ReadFrames();
+
+    while (running && m_Running) {
+        DataBuffer buffer;
+
+        m_Socket->Receive(buffer, 4096);
+
+        if (buffer.IsEmpty()) {
+            if (m_Socket->GetStatus() != network::Socket::Connected)
+                break;
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            continue;
+        }
+
+        m_ReceiveBuffer << m_Encrypter->Decrypt(buffer);
+
+        running = ReadFrames();
+    }
+
+    m_ReceiveFinished = true;
+}
+
+void PacketPipeline::DecodeThread() {
+    using namespace protocol::packets;
+
+    while (m_Running) {
+        Frame frame;
+
+        if (!m_Frames.TryPop(frame)) {
+            if (m_ReceiveFinished && m_Frames.IsEmpty()) {
+                m_Closed = true;
+                break;
+            }
+
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+            continue;
+        }
+
+        Record(m_DecodeCounters, m_Frames.GetSize() + 1, frame.timestamp);
+
+        Packet* packet = nullptr;
+
+        try {
+            DataBuffer decompressed = m_Compressor->Decompress(frame.data, frame.length);
+
+            packet = PacketFactory::CreatePacket(m_Protocol, protocol::State::Play, decompressed, frame.length, m_Connection);
+        } catch (const protocol::UnfinishedProtocolException&) {
+            // Unknown packets are skipped, like they are when decoding on the owner thread.
+            continue;
+        } catch (const std::exception&) {
+            // A malformed frame only loses that packet, but it shouldn't go unnoticed.
+            m_DecodeErrors.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+
+        if (!packet) continue;
+
+        // Chunk data decoded after this needs the new dimension to know if there's sky light,
+        // and the owner thread might not have applied the packet yet. The owner thread leaves
+        // the dimension alone while the pipeline runs, so this is the only writer.
+        s32 agnosticId;
+        if (m_Connection && m_Protocol.GetAgnosticId(protocol::State::Play, packet->GetId().GetInt(), agnosticId)) {
+            if (agnosticId == protocol::play::JoinGame)
+                m_Connection->m_Dimension = static_cast<in::JoinGamePacket*>(packet)->GetDimension();
+            else if (agnosticId == protocol::play::Respawn)
+                m_Connection->m_Dimension = static_cast<in::RespawnPacket*>(packet)->GetDimension();
+        }
+
+        if (!Push(m_Packets, Decoded{ packet, util::LatencyTracker::Now() })) {
+            PacketFactory::FreePacket(packet);
+            break;
+        }
+    }
+}
+
+protocol::packets::Packet* PacketPipeline::Poll() {
+    Decoded decoded;
+
+    if (m_Urgent.TryPop(decoded))
+        return decoded.packet;
+
+    if (!m_Packets.TryPop(decoded))
+        return nullptr;
+
+    Record(m_ApplyCounters, m_Packets.GetSize() + 1, decoded.timestamp);
+    return decoded.packet;
+}
+
+PipelineStats PacketPipeline::GetStats() const {
+    auto fill = [](PipelineStageStats& stats, const StageCounters& counters, std::size_t depth) {
+        stats.depth = depth;
+        stats.maxDepth = counters.maxDepth;
+        stats.processed = counters.processed;
+        stats.totalLatency = counters.totalLatency;
+        stats.maxLatency = counters.maxLatency;
+    };
+
+    PipelineStats stats;
+
+    fill(stats.decode, m_DecodeCounters, m_Frames.GetSize());
+    fill(stats.apply, m_ApplyCounters, m_Packets.GetSize());
+    stats.decodeErrors = m_DecodeErrors;
+
+    return stats;
+}
+
+} // ns core
+} // ns mc
@@ -2,9 +2,24 @@
 
 #include <mclib/protocol/packets/PacketDispatcher.h>
 
+#include <cwctype>
+
 namespace mc {
 namespace core {
 
+namespace {
+
+std::wstring NormalizeName(const std::wstring& name) {
+    std::wstring normalized(name);
+
+    for (wchar_t& c : normalized)
+        c = (wchar_t)std::towlower(c);
+
+    return normalized;
+}
+
+} // ns
+
 PlayerManager::PlayerManager(protocol::packets::PacketDispatcher* dispatcher, entity::EntityManager* entityManager)
     : protocol::packets::PacketHandler(dispatcher),
     m_EntityManager(entityManager)
@@ -30,15 +45,65 @@ PlayerManager::iterator PlayerManager::end() {
     return m_Players.end();
 }
 
+void PlayerManager::SetPlayerEntity(const PlayerPtr& player, entity::PlayerEntityPtr entity) {
+    auto ptr = entity.lock();
+    EntityId eid = ptr ? ptr->GetEntityId() : -1;
+
+    if (player->m_EntityId != -1 && player->m_EntityId != eid) {
+        auto iter = m_EntityPlayers.find(player->m_EntityId);
+
+        if (iter != m_EntityPlayers.end() && iter->second == player)
+            m_EntityPlayers.erase(iter);
+    }
+
+    player->m_Entity = entity;
+    player->m_EntityId = eid;
+
+    if (eid == -1) return;
+
+    PlayerPtr& indexed = m_EntityPlayers[eid];
+
+    // The entity id was reused, so the last player with it doesn't have that entity anymore.
+    if (indexed && indexed != player) {
+        indexed->m_Entity.reset();
+        indexed->m_EntityId = -1;
+    }
+
+    indexed = player;
+}
+
+void PlayerManager::SetPlayerName(const PlayerPtr& player, const std::wstring& name) {
+    if (!player->m_Name.empty()) {
+        auto iter = m_NamedPlayers.find(NormalizeName(player->m_Name));
+
+        if (iter != m_NamedPlayers.end() && iter->second == player)
+            m_NamedPlayers.erase(iter);
+    }
+
+    player->m_Name = name;
+
+    if (!name.empty())
+        m_NamedPlayers[NormalizeName(name)] = player;
+}
+
+void PlayerManager::RemovePlayer(PlayerList::iterator iter) {
+    PlayerPtr player = iter->second;
+
+    SetPlayerEntity(player, entity::PlayerEntityPtr());
+    SetPlayerName(player, L"");
+
+    m_Players.erase(iter);
+}
+
 void PlayerManager::OnPlayerSpawn(entity::PlayerEntityPtr entity, UUID uuid) {
     auto iter = m_Players.find(uuid);
 
     if (iter == m_Players.end())
-        m_Players[uuid] = std::make_shared<Player>(uuid, L"");
+        iter = m_Players.emplace(uuid, std::make_shared<Player>(uuid, L"")).first;
 
-    m_Players[uuid]->SetEntity(entity);
+    SetPlayerEntity(iter->second, entity);
 
-    NotifyListeners(&PlayerListener::OnPlayerSpawn, m_Players[uuid]);
+    NotifyListeners(&PlayerListener::OnPlayerSpawn, iter->second);
 }
 
 void PlayerManager::OnEntityDestroy(entity::EntityPtr entity) {
@@ -47,7 +112,7 @@ void PlayerManager::OnEntityDestroy(entity::EntityPtr entity) {
     auto player = GetPlayerByEntityId(eid);
 
     if (player) {
-        player->SetEntity(entity::PlayerEntityPtr());
+        SetPlayerEntity(player, entity::PlayerEntityPtr());
         NotifyListeners(&PlayerListener::OnPlayerDestroy, player, eid);
     }
 }
@@ -59,6 +124,7 @@ void PlayerManager::OnEntityMove(entity::EntityPtr entity, Vector3d oldPos, Vect
     if (!player) return;
 
     NotifyListeners(&PlayerListener::OnPlayerMove, player, oldPos, newPos);
+    m_PlayerMoveEvent.Dispatch(player, oldPos, newPos);
 }
 
 PlayerPtr PlayerManager::GetPlayerByUUID(UUID uuid) const {
@@ -71,26 +137,26 @@ PlayerPtr PlayerManager::GetPlayerByUUID(UUID uuid) const {
 }
 
 PlayerPtr PlayerManager::GetPlayerByEntityId(EntityId eid) const {
-    auto iter = std::find_if(m_Players.begin(), m_Players.end(), [eid](std::pair<UUID, PlayerPtr> kv) {
-        PlayerPtr player = kv.second;
-        auto ptr = player->GetEntity();
-        if (!ptr) return false;
-        return ptr->GetEntityId() == eid;
-    });
+    auto iter = m_EntityPlayers.find(eid);
 
-    if (iter != m_Players.end())
-        return iter->second;
+    if (iter == m_EntityPlayers.end()) return nullptr;
 
-    return nullptr;
+    PlayerPtr player = iter->second;
+
+    // The entity was freed without being destroyed through the EntityManager.
+    if (player->m_Entity.expired()) {
+        player->m_EntityId = -1;
+        m_EntityPlayers.erase(iter);
+        return nullptr;
+    }
+
+    return player;
 }
 
 PlayerPtr PlayerManager::GetPlayerByName(const std::wstring& name) const {
-    auto iter = std::find_if(m_Players.begin(), m_Players.end(), [name](std::pair<UUID, PlayerPtr> kv) {
-        PlayerPtr player = kv.second;
-        return player->GetName().compare(name) == 0;
-    });
+    auto iter = m_NamedPlayers.find(NormalizeName(name));
 
-    if (iter != m_Players.end())
+    if (iter != m_NamedPlayers.end())
         return iter->second;
 
     return nullptr;
@@ -105,11 +171,11 @@ void PlayerManager::HandlePacket(protocol::packets::in::PlayerPositionAndLookPac
 
     auto iter = m_Players.find(m_ClientUUID);
     if (iter == m_Players.end()) {
-        m_Players[m_ClientUUID] = std::make_shared<Player>(m_ClientUUID, L"");
+        iter = m_Players.emplace(m_ClientUUID, std::make_shared<Player>(m_ClientUUID, L"")).first;
     }
-    m_Players[m_ClientUUID]->SetEntity(player);
+    SetPlayerEntity(iter->second, player);
 
-    NotifyListeners(&PlayerListener::OnClientSpawn, m_Players[m_ClientUUID]);
+    NotifyListeners(&PlayerListener::OnClientSpawn, iter->second);
 }
 
 void PlayerManager::HandlePacket(protocol::packets::in::PlayerListItemPacket* packet) {
@@ -127,25 +193,30 @@ void PlayerManager::HandlePacket(protocol::packets::in::PlayerListItemPacket* pa
             if (iter != m_Players.end()) {
                 bool newPlayer = iter->second->m_Name.empty();
                 if (newPlayer) {
-                    iter->second->m_Name = actionData->name;
-                    NotifyListeners(&PlayerListener::OnPlayerJoin, m_Players[uuid]);
+                    SetPlayerName(iter->second, actionData->name);
+                    NotifyListeners(&PlayerListener::OnPlayerJoin, iter->second);
                 }
                 continue;
             }
 
             PlayerPtr player;
 
-            player = std::make_shared<Player>(uuid, actionData->name);
+            player = std::make_shared<Player>(uuid, L"");
 
             m_Players[uuid] = player;
+            SetPlayerName(player, actionData->name);
 
-            NotifyListeners(&PlayerListener::OnPlayerJoin, m_Players[uuid]);
+            NotifyListeners(&PlayerListener::OnPlayerJoin, player);
         } else if (action == PlayerListItemPacket::Action::RemovePlayer) {
-            if (m_Players.find(uuid) == m_Players.end()) continue;
+            auto iter = m_Players.find(uuid);
+            if (iter == m_Players.end()) continue;
 
-            NotifyListeners(&PlayerListener::OnPlayerLeave, m_Players[uuid]);
+            NotifyListeners(&PlayerListener::OnPlayerLeave, iter->second);
 
-            m_Players.erase(uuid);
+            // Listeners could have changed the list
+            iter = m_Players.find(uuid);
+            if (iter != m_Players.end())
+                RemovePlayer(iter);
         }
     }
 }
@@ -0,0 +1,86 @@
+#include <mclib/entity/Entity.h>
+
+namespace mc {
+namespace entity {
+
+Entity::Entity(EntityId id, protocol::Version protocolVersion)
+    : Entity(id, protocolVersion, std::make_shared<EntityStore>())
+{
+
+}
+
+Entity::Entity(EntityId id, protocol::Version protocolVersion, EntityStorePtr store)
+    : m_Store(std::move(store)), m_EntityId(id), m_Metadata(protocolVersion)
+{
+    m_Handle = m_Store->Create(id);
+}
+
+Entity::~Entity() {
+    if (m_Store)
+        m_Store->Destroy(m_Handle);
+}
+
+Entity::Entity(const Entity& rhs)
+    : m_Store(std::make_shared<EntityStore>()),
+      m_EntityId(rhs.m_EntityId),
+      m_Attributes(rhs.m_Attributes),
+      m_Metadata(rhs.m_Metadata)
+{
+    m_Handle = m_Store->Create(m_EntityId);
+    m_Store->CopyState(m_Handle, *rhs.m_Store, rhs.m_Handle);
+}
+
+Entity& Entity::operator=(const Entity& rhs) {
+    if (this == &rhs) return *this;
+
+    if (!m_Store) {
+        m_Store = std::make_shared<EntityStore>();
+        m_Handle = m_Store->Create(rhs.m_EntityId);
+    }
+
+    m_EntityId = rhs.m_EntityId;
+    m_Attributes = rhs.m_Attributes;
+    m_Metadata = rhs.m_Metadata;
+
+    m_Store->SetId(m_Handle, m_EntityId);
+    m_Store->CopyState(m_Handle, *rhs.m_Store, rhs.m_Handle);
+    return *this;
+}
+
+Entity::Entity(Entity&& rhs) noexcept
+    : m_Store(std::move(rhs.m_Store)),
+      m_Handle(rhs.m_Handle),
+      m_EntityId(rhs.m_EntityId),
+      m_Attributes(std::move(rhs.m_Attributes)),
+      m_Metadata(std::move(rhs.m_Metadata))
+{
+
+}
+
+Entity& Entity::operator=(Entity&& rhs) noexcept {
+    if (this == &rhs) return *this;
+
+    if (m_Store)
+        m_Store->Destroy(m_Handle);
+
+    m_Store = std::move(rhs.m_Store);
+    m_Handle = rhs.m_Handle;
+    m_EntityId = rhs.m_EntityId;
+    m_Attributes = std::move(rhs.m_Attributes);
+    m_Metadata = std::move(rhs.m_Metadata);
+    return *this;
+}
+
+void Entity::Detach() {
+    auto store = std::make_shared<EntityStore>();
+    EntityHandle handle = store->Create(m_EntityId);
+
+    store->CopyState(handle, *m_Store, m_Handle);
+    m_Store->Destroy(m_Handle);
+
+    m_Store = std::move(store);
+    m_Handle = handle;
+}
+
+} // ns entity
+} // ns mc
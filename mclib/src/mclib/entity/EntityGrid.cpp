@@ -0,0 +1,191 @@
+#include <mclib/entity/EntityGrid.h>
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace mc {
+namespace entity {
+
+void EntityGrid::RemoveEntry(const Location& location) {
+    Cell& cell = *location.cell;
+
+    if (location.index + 1 < cell.entries.size()) {
+        cell.entries[location.index] = std::move(cell.entries.back());
+        m_Locations[cell.entries[location.index].id].index = location.index;
+    }
+
+    cell.entries.pop_back();
+
+    if (cell.entries.empty())
+        m_Cells.erase(GetCellKey(cell.x, cell.z));
+}
+
+void EntityGrid::Update(const EntityPtr& entity, const Vector3d& position) {
+    EntityId id = entity->GetEntityId();
+    s64 x = GetCellCoord(position.x);
+    s64 z = GetCellCoord(position.z);
+
+    auto iter = m_Locations.find(id);
+
+    if (iter != m_Locations.end()) {
+        Location& location = iter->second;
+
+        if (location.cell->x == x && location.cell->z == z) {
+            Entry& entry = location.cell->entries[location.index];
+
+            entry.position = position;
+            if (entry.entity != entity)
+                entry.entity = entity;
+            return;
+        }
+
+        RemoveEntry(location);
+    } else {
+        iter = m_Locations.emplace(id, Location{ nullptr, 0 }).first;
+    }
+
+    Cell& cell = m_Cells[GetCellKey(x, z)];
+
+    if (cell.entries.empty()) {
+        cell.x = x;
+        cell.z = z;
+    }
+
+    cell.entries.push_back(Entry{ id, position, entity });
+    iter->second = Location{ &cell, cell.entries.size() - 1 };
+}
+
+void EntityGrid::Remove(EntityId id) {
+    auto iter = m_Locations.find(id);
+    if (iter == m_Locations.end()) return;
+
+    Location location = iter->second;
+
+    m_Locations.erase(iter);
+    RemoveEntry(location);
+}
+
+void EntityGrid::Clear() {
+    m_Cells.clear();
+    m_Locations.clear();
+}
+
+template <typename Visitor>
+void EntityGrid::ForEachCell(const AABB& bounds, Visitor visitor) const {
+    if (m_Cells.empty()) return;
+
+    s64 minX = GetCellCoord(bounds.min.x);
+    s64 minZ = GetCellCoord(bounds.min.z);
+    s64 maxX = GetCellCoord(bounds.max.x);
+    s64 maxZ = GetCellCoord(bounds.max.z);
+
+    // Looking up every cell in the area costs more than going through the occupied ones once the area is larger.
+    double area = (double)(maxX - minX + 1) * (double)(maxZ - minZ + 1);
+
+    if (area > (double)m_Cells.size()) {
+        for (const auto& entry : m_Cells) {
+            const Cell& cell = entry.second;
+
+            if (cell.x >= minX && cell.x <= maxX && cell.z >= minZ && cell.z <= maxZ)
+                visitor(cell);
+        }
+        return;
+    }
+
+    for (s64 x = minX; x <= maxX; ++x) {
+        for (s64 z = minZ; z <= maxZ; ++z) {
+            auto iter = m_Cells.find(GetCellKey(x, z));
+
+            if (iter != m_Cells.end())
+                visitor(iter->second);
+        }
+    }
+}
+
+void EntityGrid::QueryAABB(const AABB& bounds, std::vector<EntityPtr>& result) const {
+    ForEachCell(bounds, [&](const Cell& cell) {
+        for (const Entry& entry : cell.entries) {
+            if (bounds.Contains(entry.position))
+                result.push_back(entry.entity);
+        }
+    });
+}
+
+void EntityGrid::QueryRadius(const Vector3d& center, double radius, std::vector<EntityPtr>& result) const {
+    if (radius < 0.0) return;
+
+    AABB bounds(center - Vector3d(radius, radius, radius), center + Vector3d(radius, radius, radius));
+    double radiusSq = radius * radius;
+
+    ForEachCell(bounds, [&](const Cell& cell) {
+        for (const Entry& entry : cell.entries) {
+            if (entry.position.DistanceSq(center) <= radiusSq)
+                result.push_back(entry.entity);
+        }
+    });
+}
+
+EntityPtr EntityGrid::Nearest(const Vector3d& position, const Filter& filter, double maxDistance) const {
+    if (m_Cells.empty() || maxDistance < 0.0) return nullptr;
+
+    const Entry* best = nullptr;
+    double bestSq = maxDistance * maxDistance;
+
+    auto visit = [&](const Cell& cell) {
+        for (const Entry& entry : cell.entries) {
+            double distanceSq = entry.position.DistanceSq(position);
+
+            if (distanceSq <= bestSq && (!filter || filter(entry.entity))) {
+                best = &entry;
+                bestSq = distanceSq;
+            }
+        }
+    };
+
+    s64 centerX = GetCellCoord(position.x);
+    s64 centerZ = GetCellCoord(position.z);
+
+    // Every cell of ring n is at least this far plus n - 1 cells away from position.
+    double offsetX = position.x - (double)centerX * CellSize;
+    double offsetZ = position.z - (double)centerZ * CellSize;
+    double edge = std::min(std::min(offsetX, CellSize - offsetX), std::min(offsetZ, CellSize - offsetZ));
+
+    for (s64 ring = 0; ; ++ring) {
+        if (ring > 0) {
+            double closest = edge + (double)(ring - 1) * CellSize;
+
+            if (closest * closest > bestSq) break;
+        }
+
+        std::size_t ringCells = ring == 0 ? 1 : (std::size_t)(8 * ring);
+
+        if (ringCells > m_Cells.size()) {
+            // The rest of the occupied cells are fewer than the next ring, so look at them directly.
+            for (const auto& entry : m_Cells) {
+                const Cell& cell = entry.second;
+                s64 distance = std::max(std::abs(cell.x - centerX), std::abs(cell.z - centerZ));
+
+                if (distance >= ring)
+                    visit(cell);
+            }
+            break;
+        }
+
+        for (s64 x = centerX - ring; x <= centerX + ring; ++x) {
+            // Only the first and last rows are full, the rows between only have their two ends in the ring.
+            s64 step = (x == centerX - ring || x == centerX + ring) ? 1 : std::max<s64>(2 * ring, 1);
+
+            for (s64 z = centerZ - ring; z <= centerZ + ring; z += step) {
+                auto iter = m_Cells.find(GetCellKey(x, z));
+
+                if (iter != m_Cells.end())
+                    visit(iter->second);
+            }
+        }
+    }
+
+    return best ? best->entity : nullptr;
+}
+
+} // ns entity
+} // ns mc
@@ -51,7 +51,8 @@ EntityType GetEntityTypeFromObjectId(s32 oid) {
 }
 
 EntityManager::EntityManager(protocol::packets::PacketDispatcher* dispatcher, protocol::Version protocolVersion)
-    : protocol::packets::PacketHandler(dispatcher), m_ProtocolVersion(protocolVersion)
+    : protocol::packets::PacketHandler(dispatcher), m_Store(std::make_shared<EntityStore>()), m_EntityId(-1), m_ProtocolVersion(protocolVersion),
+      m_SnapshotRequested(false), m_SnapshotDirty(true)
 {
     GetDispatcher()->RegisterHandler(protocol::State::Play, protocol::play::JoinGame, this);
     GetDispatcher()->RegisterHandler(protocol::State::Play, protocol::play::PlayerPositionAndLook, this);
@@ -76,9 +77,116 @@ EntityManager::EntityManager(protocol::packets::PacketDispatcher* dispatcher, pr
 
 EntityManager::~EntityManager() {
     GetDispatcher()->UnregisterHandler(this);
+
+    // Without the grid the map holds the manager's only reference, so any other one was handed out.
+    // Entities that are still referenced shouldn't keep using the store from whichever thread releases them.
+    m_Grid.Clear();
+
+    for (auto& entry : m_Entities) {
+        if (entry.second.use_count() > 1)
+            entry.second->Detach();
+    }
+}
+
+void EntityManager::AddEntity(EntityId eid, const EntityPtr& entity) {
+    auto iter = m_Entities.find(eid);
+
+    if (iter != m_Entities.end())
+        RemoveEntity(iter);
+
+    m_Entities.emplace(eid, entity);
+}
+
+void EntityManager::RemoveEntity(EntityMap::iterator iter) {
+    EntityId eid = iter->first;
+    EntityPtr entity = std::move(iter->second);
+
+    m_Entities.erase(iter);
+    m_Grid.Remove(eid);
+
+    // The map and the grid dropped their references, so any other one was handed out.
+    // Whoever still holds the entity keeps its state, but it shouldn't show up in the store anymore.
+    if (entity.use_count() > 1)
+        entity->Detach();
+}
+
+EntitySnapshotPtr EntityManager::GetSnapshot() const {
+    EntitySnapshotPtr snapshot = std::atomic_load(&m_Snapshot);
+
+    if (!snapshot) {
+        static const EntitySnapshotPtr empty = std::make_shared<EntitySnapshot>();
+
+        m_SnapshotRequested = true;
+        return empty;
+    }
+
+    return snapshot;
+}
+
+void EntityManager::PublishSnapshot() {
+    if (!m_SnapshotRequested || !m_SnapshotDirty) return;
+
+    EntitySnapshotPtr previous = std::atomic_load(&m_Snapshot);
+    auto snapshot = std::make_shared<EntitySnapshot>();
+
+    snapshot->m_Version = previous ? previous->m_Version + 1 : 1;
+    snapshot->m_PlayerId = m_EntityId;
+    const EntityStore& store = *m_Store;
+    std::size_t count = store.GetSize();
+
+    snapshot->m_Entities.resize(count);
+
+    for (std::size_t i = 0; i < count; ++i) {
+        EntityState& state = snapshot->m_Entities[i];
+
+        state.id = store.GetIds()[i];
+        state.type = store.GetTypes()[i];
+        state.vehicleId = store.GetVehicleIds()[i];
+        state.position = store.GetPositions()[i];
+        state.velocity = store.GetVelocities()[i];
+        state.yaw = store.GetYaws()[i];
+        state.pitch = store.GetPitches()[i];
+        state.headPitch = store.GetHeadPitches()[i];
+    }
+
+    std::sort(snapshot->m_Entities.begin(), snapshot->m_Entities.end(), [](const EntityState& first, const EntityState& second) {
+        return first.id < second.id;
+    });
+
+    std::atomic_store(&m_Snapshot, EntitySnapshotPtr(snapshot));
+    m_SnapshotDirty = false;
+}
+
+void EntityManager::UpdatePosition(EntityId eid) {
+    m_SnapshotDirty = true;
+
+    auto iter = m_Entities.find(eid);
+    if (iter == m_Entities.end() || !iter->second) return;
+
+    m_Grid.Update(iter->second, iter->second->GetPosition());
+}
+
+std::vector<EntityPtr> EntityManager::QueryRadius(const Vector3d& center, double radius) const {
+    std::vector<EntityPtr> result;
+
+    m_Grid.QueryRadius(center, radius, result);
+    return result;
+}
+
+std::vector<EntityPtr> EntityManager::QueryAABB(const AABB& bounds) const {
+    std::vector<EntityPtr> result;
+
+    m_Grid.QueryAABB(bounds, result);
+    return result;
+}
+
+EntityPtr EntityManager::Nearest(const Vector3d& position, const std::function<bool(const EntityPtr&)>& filter, double maxDistance) const {
+    return m_Grid.Nearest(position, filter, maxDistance);
 }
 
 void EntityManager::HandlePacket(protocol::packets::in::AttachEntityPacket* packet) {
+    m_SnapshotDirty = true;
+
     EntityId eid = packet->GetEntityId();
     EntityId vid = packet->GetVehicleId();
 
@@ -91,21 +199,26 @@ void EntityManager::HandlePacket(protocol::packets::in::AttachEntityPacket* pack
 }
 
 void EntityManager::HandlePacket(protocol::packets::in::JoinGamePacket* packet) {
+    m_SnapshotDirty = true;
+
     EntityId id = packet->GetEntityId();
 
     m_EntityId = id;
 
-    std::shared_ptr<PlayerEntity> entity = std::make_shared<PlayerEntity>(id, m_ProtocolVersion);
+    std::shared_ptr<PlayerEntity> entity = CreateEntity<PlayerEntity>(id);
 
-    m_Entities[id] = entity;
+    AddEntity(id, entity);
+    m_Grid.Update(entity, entity->GetPosition());
 }
 
 void EntityManager::HandlePacket(protocol::packets::in::PlayerPositionAndLookPacket* packet) {
+    m_SnapshotDirty = true;
+
     auto iter = m_Entities.find(m_EntityId);
     EntityPtr entity;
 
     if (iter == m_Entities.end()) {
-        entity = std::make_shared<PlayerEntity>(m_EntityId, m_ProtocolVersion);
+        entity = CreateEntity<PlayerEntity>(m_EntityId);
     } else {
         entity = iter->second;
     }
@@ -114,18 +227,24 @@ void EntityManager::HandlePacket(protocol::packets::in::PlayerPositionAndLookPac
         entity->SetPosition(packet->GetPosition());
         entity->SetYaw(packet->GetYaw() * DEG_TO_RAD);
         entity->SetPitch(packet->GetPitch() * DEG_TO_RAD);
+
+        if (iter != m_Entities.end())
+            m_Grid.Update(entity, entity->GetPosition());
     }
 }
 
 void EntityManager::HandlePacket(protocol::packets::in::SpawnPlayerPacket* packet) {
+    m_SnapshotDirty = true;
+
     EntityId id = packet->GetEntityId();
 
-    std::shared_ptr<PlayerEntity> entity = std::make_shared<PlayerEntity>(id, m_ProtocolVersion);
+    std::shared_ptr<PlayerEntity> entity = CreateEntity<PlayerEntity>(id);
 
-    m_Entities[id] = entity;
+    AddEntity(id, entity);
 
     entity->SetType(EntityType::Player);
     entity->SetPosition(packet->GetPosition());
+    m_Grid.Update(entity, entity->GetPosition());
     entity->SetYaw(packet->GetYaw() / 256.0f * TAU);
     entity->SetPitch(packet->GetPitch() / 256.0f * TAU);
     entity->SetMetadata(packet->GetMetadata());
@@ -137,11 +256,14 @@ void EntityManager::HandlePacket(protocol::packets::in::SpawnPlayerPacket* packe
 }
 
 void EntityManager::HandlePacket(protocol::packets::in::SpawnObjectPacket* packet) {
+    m_SnapshotDirty = true;
+
     EntityId eid = packet->GetEntityId();
-    EntityPtr entity = std::make_shared<Entity>(eid, m_ProtocolVersion);
+    EntityPtr entity = CreateEntity<Entity>(eid);
 
-    m_Entities[eid] = entity;
+    AddEntity(eid, entity);
     entity->SetPosition(ToVector3d(packet->GetPosition()));
+    m_Grid.Update(entity, entity->GetPosition());
     entity->SetYaw(packet->GetYaw() / 256.0f * TAU);
     entity->SetPitch(packet->GetPitch() / 256.0f * TAU);
 
@@ -155,45 +277,57 @@ void EntityManager::HandlePacket(protocol::packets::in::SpawnObjectPacket* packe
 }
 
 void EntityManager::HandlePacket(protocol::packets::in::SpawnPaintingPacket* packet) {
+    m_SnapshotDirty = true;
+
     EntityId eid = packet->GetEntityId();
-    auto entity = std::make_shared<PaintingEntity>(eid, m_ProtocolVersion);
+    auto entity = CreateEntity<PaintingEntity>(eid);
 
-    m_Entities[eid] = entity;
+    AddEntity(eid, entity);
 
     entity->SetPosition(ToVector3d(packet->GetPosition()));
+    m_Grid.Update(entity, entity->GetPosition());
     entity->SetType(EntityType::Painting);
     entity->SetTitle(packet->GetTitle());
     entity->SetDirection((PaintingEntity::Direction)packet->GetDirection());
 }
 
 void EntityManager::HandlePacket(protocol::packets::in::SpawnExperienceOrbPacket* packet) {
+    m_SnapshotDirty = true;
+
     EntityId eid = packet->GetEntityId();
-    EntityPtr entity = std::make_shared<XPOrb>(eid, packet->GetCount(), m_ProtocolVersion);
+    EntityPtr entity = CreateEntity<XPOrb>(eid, packet->GetCount());
 
-    m_Entities[eid] = entity;
+    AddEntity(eid, entity);
 
     entity->SetPosition(packet->GetPosition());
+    m_Grid.Update(entity, entity->GetPosition());
     entity->SetType(EntityType::XPOrb);
 }
 
 void EntityManager::HandlePacket(protocol::packets::in::SpawnGlobalEntityPacket* packet) {
+    m_SnapshotDirty = true;
+
     EntityId eid = packet->GetEntityId();
-    EntityPtr entity = std::make_shared<Entity>(eid, m_ProtocolVersion);
+    EntityPtr entity = CreateEntity<Entity>(eid);
 
-    m_Entities[eid] = entity;
+    AddEntity(eid, entity);
 
     entity->SetPosition(packet->GetPosition());
+    m_Grid.Update(entity, entity->GetPosition());
     entity->SetType(EntityType::Lightning);
 }
 
 void EntityManager::HandlePacket(protocol::packets::in::SpawnMobPacket* packet) {
+    m_SnapshotDirty = true;
+
     EntityId eid = packet->GetEntityId();
-    EntityPtr entity = std::make_shared<Entity>(eid, m_ProtocolVersion);
+    EntityPtr entity = CreateEntity<Entity>(eid);
 
-    m_Entities[eid] = entity;
+    AddEntity(eid, entity);
 
     entity->SetType((EntityType)packet->GetType());
     entity->SetPosition(packet->GetPosition());
+    m_Grid.Update(entity, entity->GetPosition());
     entity->SetYaw(packet->GetYaw() / 256.0f * TAU);
     entity->SetPitch(packet->GetPitch() / 256.0f * TAU);
     entity->SetHeadPitch(packet->GetHeadPitch() / 256.0f * TAU);
@@ -206,33 +340,38 @@ void EntityManager::HandlePacket(protocol::packets::in::SpawnMobPacket* packet)
 }
 
 void EntityManager::HandlePacket(protocol::packets::in::DestroyEntitiesPacket* packet) {
+    m_SnapshotDirty = true;
+
     std::vector<EntityId> eids = packet->GetEntityIds();
 
     for (EntityId eid : eids) {
         auto iter = m_Entities.find(eid);
         if (iter == m_Entities.end()) continue;
 
-        auto entity = iter->second;
-        if (entity)
-            NotifyListeners(&EntityListener::OnEntityDestroy, iter->second);
+        NotifyListeners(&EntityListener::OnEntityDestroy, iter->second);
 
-        m_Entities.erase(eid);
+        RemoveEntity(iter);
     }
 }
 
 void EntityManager::HandlePacket(protocol::packets::in::EntityPacket* packet) {
+    m_SnapshotDirty = true;
+
     EntityId eid = packet->GetEntityId();
 
     auto iter = m_Entities.find(eid);
 
     if (iter == m_Entities.end()) {
-        EntityPtr entity = std::make_shared<Entity>(eid, m_ProtocolVersion);
+        EntityPtr entity = CreateEntity<Entity>(eid);
 
-        m_Entities[eid] = entity;
+        AddEntity(eid, entity);
+        m_Grid.Update(entity, entity->GetPosition());
     }
 }
 
 void EntityManager::HandlePacket(protocol::packets::in::EntityVelocityPacket* packet) {
+    m_SnapshotDirty = true;
+
     EntityId eid = packet->GetEntityId();
 
     auto iter = m_Entities.find(eid);
@@ -247,7 +386,14 @@ void EntityManager::HandlePacket(protocol::packets::in::EntityVelocityPacket* pa
     }
 }
 
+void EntityManager::NotifyEntityMove(const EntityPtr& entity, const Vector3d& oldPos, const Vector3d& newPos) {
+    NotifyListeners(&EntityListener::OnEntityMove, entity, oldPos, newPos);
+    m_EntityMoveEvent.Dispatch(entity, oldPos, newPos);
+}
+
 void EntityManager::HandlePacket(protocol::packets::in::EntityRelativeMovePacket* packet) {
+    m_SnapshotDirty = true;
+
     EntityId eid = packet->GetEntityId();
 
     Vector3d delta = ToVector3d(packet->GetDelta()) / (32.0 * 128.0);
@@ -262,12 +408,15 @@ void EntityManager::HandlePacket(protocol::packets::in::EntityRelativeMovePacket
         Vector3d newPos = entity->GetPosition() + delta;
 
         entity->SetPosition(newPos);
+        m_Grid.Update(entity, newPos);
 
-        NotifyListeners(&EntityListener::OnEntityMove, entity, oldPos, newPos);
+        NotifyEntityMove(entity, oldPos, newPos);
     }
 }
 
 void EntityManager::HandlePacket(protocol::packets::in::EntityLookAndRelativeMovePacket* packet) {
+    m_SnapshotDirty = true;
+
     EntityId eid = packet->GetEntityId();
 
     Vector3d delta = ToVector3d(packet->GetDelta()) / (32.0 * 128.0);
@@ -282,14 +431,17 @@ void EntityManager::HandlePacket(protocol::packets::in::EntityLookAndRelativeMov
         Vector3d newPos = entity->GetPosition() + delta;
 
         entity->SetPosition(newPos);
+        m_Grid.Update(entity, newPos);
         entity->SetYaw(packet->GetYaw() / 256.0f * TAU);
         entity->SetPitch(packet->GetPitch() / 256.0f * TAU);
 
-        NotifyListeners(&EntityListener::OnEntityMove, entity, oldPos, newPos);
+        NotifyEntityMove(entity, oldPos, newPos);
     }
 }
 
 void EntityManager::HandlePacket(protocol::packets::in::EntityTeleportPacket* packet) {
+    m_SnapshotDirty = true;
+
     EntityId eid = packet->GetEntityId();
 
     auto iter = m_Entities.find(eid);
@@ -302,14 +454,17 @@ void EntityManager::HandlePacket(protocol::packets::in::EntityTeleportPacket* pa
         Vector3d newPos = packet->GetPosition();
 
         entity->SetPosition(newPos);
+        m_Grid.Update(entity, newPos);
         entity->SetYaw(packet->GetYaw() / 256.0f * TAU);
         entity->SetPitch(packet->GetPitch() / 256.0f * TAU);
 
-        NotifyListeners(&EntityListener::OnEntityMove, entity, oldPos, newPos);
+        NotifyEntityMove(entity, oldPos, newPos);
     }
 }
 
 void EntityManager::HandlePacket(protocol::packets::in::EntityLookPacket* packet) {
+    m_SnapshotDirty = true;
+
     EntityId eid = packet->GetEntityId();
 
     auto iter = m_Entities.find(eid);
@@ -323,6 +478,8 @@ void EntityManager::HandlePacket(protocol::packets::in::EntityLookPacket* packet
 }
 
 void EntityManager::HandlePacket(protocol::packets::in::EntityHeadLookPacket* packet) {
+    m_SnapshotDirty = true;
+
     EntityId eid = packet->GetEntityId();
 
     auto iter = m_Entities.find(eid);
@@ -341,7 +498,7 @@ void EntityManager::HandlePacket(protocol::packets::in::EntityMetadataPacket* pa
     
     auto entity = iter->second;
     if (entity) {
-        entity->SetMetadata(packet->GetMetadata());
+        entity->MergeMetadata(packet->GetMetadata());
     }
 }
 
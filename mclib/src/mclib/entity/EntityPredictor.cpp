@@ -0,0 +1,291 @@
+#include <mclib/entity/EntityPredictor.h>
+
+#include <mclib/util/Utility.h>
+
+#include <algorithm>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MCLIB_PREDICTOR_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace mc {
+namespace entity {
+
+namespace {
+
+// Relative moves can't go further than this, so anything longer was a teleport and the history before it doesn't help.
+const double MaxSampleDistance = 8.0;
+
+// How far along the velocity to go elapsed milliseconds after the last move. It goes out for limit and then
+// back to the last move over the same time, since an entity that stopped sending moves has most likely stopped.
+inline double GetExtrapolation(double elapsed, double limit) {
+    return std::max(std::min(elapsed, 2.0 * limit - elapsed), 0.0);
+}
+
+} // ns
+
+EntityPredictor::EntityPredictor(EntityManager* entityManager)
+    : m_EntityManager(entityManager),
+      m_MaxExtrapolation(150),
+      m_VelocityWindow(250),
+      m_LatestTime(std::numeric_limits<s64>::min())
+{
+    m_MoveSubscription = m_EntityManager->GetEntityMoveEvent().Subscribe<EntityPredictor, &EntityPredictor::OnMove>(this);
+    m_EntityManager->RegisterListener(this);
+}
+
+EntityPredictor::~EntityPredictor() {
+    m_EntityManager->UnregisterListener(this);
+    m_EntityManager->GetEntityMoveEvent().Unsubscribe(m_MoveSubscription);
+}
+
+void EntityPredictor::OnMove(const EntityPtr& entity, const Vector3d& oldPos, const Vector3d& newPos) {
+    AddSample(entity->GetEntityId(), newPos, util::GetTime());
+}
+
+void EntityPredictor::OnEntitySpawn(EntityPtr entity) {
+    // The id could have belonged to an entity that wasn't destroyed properly.
+    Remove(entity->GetEntityId());
+}
+
+void EntityPredictor::OnObjectSpawn(EntityPtr entity) {
+    Remove(entity->GetEntityId());
+}
+
+void EntityPredictor::OnEntityDestroy(EntityPtr entity) {
+    Remove(entity->GetEntityId());
+}
+
+void EntityPredictor::AddSample(EntityId eid, const Vector3d& position, s64 time) {
+    auto iter = m_Indices.find(eid);
+    std::size_t index;
+
+    if (iter == m_Indices.end()) {
+        index = m_Ids.size();
+        m_Indices.emplace(eid, (u32)index);
+
+        m_Ids.push_back(eid);
+        m_Times.push_back(0.0);
+        m_X.push_back(0.0);
+        m_Y.push_back(0.0);
+        m_Z.push_back(0.0);
+        m_VelocityX.push_back(0.0);
+        m_VelocityY.push_back(0.0);
+        m_VelocityZ.push_back(0.0);
+        m_History.resize(m_History.size() + HistorySize);
+        m_HistoryCount.push_back(0);
+        m_HistoryHead.push_back(0);
+    } else {
+        index = iter->second;
+    }
+
+    Sample* history = &m_History[index * HistorySize];
+    u8& count = m_HistoryCount[index];
+    u8& head = m_HistoryHead[index];
+
+    if (count > 0) {
+        const Sample& last = history[head];
+
+        // Start over after teleports and samples that go back in time
+        if (time < last.time || position.DistanceSq(last.position) > MaxSampleDistance * MaxSampleDistance)
+            count = 0;
+    }
+
+    head = count == 0 ? 0 : (u8)((head + 1) % HistorySize);
+    history[head] = Sample{ time, position };
+    count = (u8)std::min<u32>(count + 1, HistorySize);
+
+    m_Times[index] = (double)time;
+    m_X[index] = position.x;
+    m_Y[index] = position.y;
+    m_Z[index] = position.z;
+    m_LatestTime = std::max(m_LatestTime, time);
+
+    UpdateVelocity(index);
+}
+
+void EntityPredictor::UpdateVelocity(std::size_t index) {
+    const Sample* history = &m_History[index * HistorySize];
+    const Sample& newest = history[m_HistoryHead[index]];
+    const Sample* oldest = nullptr;
+
+    // Measure from the oldest sample in the window, which evens out packets that arrived close together.
+    for (u32 i = 1; i < m_HistoryCount[index]; ++i) {
+        const Sample& sample = history[(m_HistoryHead[index] + HistorySize - i) % HistorySize];
+
+        if (newest.time - sample.time > m_VelocityWindow) break;
+        if (sample.time < newest.time)
+            oldest = &sample;
+    }
+
+    if (!oldest) {
+        // Either it just started moving or every sample arrived at once. Only the first case is known to be still.
+        if (m_HistoryCount[index] <= 1 || newest.time - history[(m_HistoryHead[index] + HistorySize - 1) % HistorySize].time > m_VelocityWindow) {
+            m_VelocityX[index] = 0.0;
+            m_VelocityY[index] = 0.0;
+            m_VelocityZ[index] = 0.0;
+        }
+        return;
+    }
+
+    double dt = (double)(newest.time - oldest->time);
+    Vector3d velocity = (newest.position - oldest->position) / dt;
+
+    m_VelocityX[index] = velocity.x;
+    m_VelocityY[index] = velocity.y;
+    m_VelocityZ[index] = velocity.z;
+}
+
+void EntityPredictor::Remove(EntityId eid) {
+    auto iter = m_Indices.find(eid);
+    if (iter == m_Indices.end()) return;
+
+    std::size_t index = iter->second;
+    std::size_t last = m_Ids.size() - 1;
+
+    m_Indices.erase(iter);
+
+    if (index != last) {
+        m_Ids[index] = m_Ids[last];
+        m_Times[index] = m_Times[last];
+        m_X[index] = m_X[last];
+        m_Y[index] = m_Y[last];
+        m_Z[index] = m_Z[last];
+        m_VelocityX[index] = m_VelocityX[last];
+        m_VelocityY[index] = m_VelocityY[last];
+        m_VelocityZ[index] = m_VelocityZ[last];
+        std::copy_n(m_History.begin() + last * HistorySize, (std::size_t)HistorySize, m_History.begin() + index * HistorySize);
+        m_HistoryCount[index] = m_HistoryCount[last];
+        m_HistoryHead[index] = m_HistoryHead[last];
+
+        m_Indices[m_Ids[index]] = (u32)index;
+    }
+
+    m_Ids.pop_back();
+    m_Times.pop_back();
+    m_X.pop_back();
+    m_Y.pop_back();
+    m_Z.pop_back();
+    m_VelocityX.pop_back();
+    m_VelocityY.pop_back();
+    m_VelocityZ.pop_back();
+    m_History.resize(m_History.size() - HistorySize);
+    m_HistoryCount.pop_back();
+    m_HistoryHead.pop_back();
+}
+
+void EntityPredictor::Clear() {
+    m_Indices.clear();
+    m_Ids.clear();
+    m_Times.clear();
+    m_X.clear();
+    m_Y.clear();
+    m_Z.clear();
+    m_VelocityX.clear();
+    m_VelocityY.clear();
+    m_VelocityZ.clear();
+    m_History.clear();
+    m_HistoryCount.clear();
+    m_HistoryHead.clear();
+    m_LatestTime = std::numeric_limits<s64>::min();
+}
+
+Vector3d EntityPredictor::Predict(std::size_t index, s64 time) const {
+    if ((double)time >= m_Times[index]) {
+        double dt = GetExtrapolation((double)time - m_Times[index], (double)m_MaxExtrapolation);
+
+        return Vector3d(m_X[index] + m_VelocityX[index] * dt, m_Y[index] + m_VelocityY[index] * dt, m_Z[index] + m_VelocityZ[index] * dt);
+    }
+
+    const Sample* history = &m_History[index * HistorySize];
+    const Sample* newer = &history[m_HistoryHead[index]];
+
+    for (u32 i = 1; i < m_HistoryCount[index]; ++i) {
+        const Sample* older = &history[(m_HistoryHead[index] + HistorySize - i) % HistorySize];
+
+        if (older->time <= time) {
+            if (newer->time == older->time)
+                return newer->position;
+
+            double t = (double)(time - older->time) / (double)(newer->time - older->time);
+            return older->position + (newer->position - older->position) * t;
+        }
+
+        newer = older;
+    }
+
+    // Older than anything recorded
+    return newer->position;
+}
+
+bool EntityPredictor::PredictPosition(EntityId eid, s64 time, Vector3d* position) const {
+    auto iter = m_Indices.find(eid);
+
+    if (iter != m_Indices.end()) {
+        *position = Predict(iter->second, time);
+        return true;
+    }
+
+    EntityPtr entity = m_EntityManager->GetEntity(eid);
+    if (!entity) return false;
+
+    *position = entity->GetPosition();
+    return true;
+}
+
+void EntityPredictor::PredictAll(s64 time, std::vector<Vector3d>& positions) const {
+    const std::size_t count = m_Ids.size();
+    const double now = (double)time;
+    std::size_t i = 0;
+
+    positions.resize(count);
+
+#ifdef MCLIB_PREDICTOR_SSE2
+    const __m128d current = _mm_set1_pd(now);
+    const __m128d returned = _mm_set1_pd(2.0 * (double)m_MaxExtrapolation);
+    const __m128d zero = _mm_setzero_pd();
+
+    for (; i + 2 <= count; i += 2) {
+        // Same as GetExtrapolation. Entities with a newer sample than time get zero here and are interpolated below.
+        __m128d elapsed = _mm_sub_pd(current, _mm_loadu_pd(&m_Times[i]));
+        __m128d dt = _mm_max_pd(_mm_min_pd(elapsed, _mm_sub_pd(returned, elapsed)), zero);
+        __m128d x = _mm_add_pd(_mm_loadu_pd(&m_X[i]), _mm_mul_pd(_mm_loadu_pd(&m_VelocityX[i]), dt));
+        __m128d y = _mm_add_pd(_mm_loadu_pd(&m_Y[i]), _mm_mul_pd(_mm_loadu_pd(&m_VelocityY[i]), dt));
+        __m128d z = _mm_add_pd(_mm_loadu_pd(&m_Z[i]), _mm_mul_pd(_mm_loadu_pd(&m_VelocityZ[i]), dt));
+
+        _mm_storel_pd(&positions[i].x, x);
+        _mm_storeh_pd(&positions[i + 1].x, x);
+        _mm_storel_pd(&positions[i].y, y);
+        _mm_storeh_pd(&positions[i + 1].y, y);
+        _mm_storel_pd(&positions[i].z, z);
+        _mm_storeh_pd(&positions[i + 1].z, z);
+    }
+#endif
+
+    for (; i < count; ++i) {
+        double dt = GetExtrapolation(now - m_Times[i], (double)m_MaxExtrapolation);
+
+        positions[i] = Vector3d(m_X[i] + m_VelocityX[i] * dt, m_Y[i] + m_VelocityY[i] * dt, m_Z[i] + m_VelocityZ[i] * dt);
+    }
+
+    if (time >= m_LatestTime) return;
+
+    for (std::size_t j = 0; j < count; ++j) {
+        if (now < m_Times[j])
+            positions[j] = Predict(j, time);
+    }
+}
+
+Vector3d EntityPredictor::GetVelocity(EntityId eid) const {
+    auto iter = m_Indices.find(eid);
+    if (iter == m_Indices.end()) return Vector3d(0, 0, 0);
+
+    std::size_t index = iter->second;
+
+    return Vector3d(m_VelocityX[index], m_VelocityY[index], m_VelocityZ[index]) * 1000.0;
+}
+
+} // ns entity
+} // ns mc
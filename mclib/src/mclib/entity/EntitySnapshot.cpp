@@ -0,0 +1,23 @@
+#include <mclib/entity/EntitySnapshot.h>
+
+#include <algorithm>
+
+namespace mc {
+namespace entity {
+
+EntitySnapshot::EntitySnapshot() : m_PlayerId(-1), m_Version(0) {
+
+}
+
+const EntityState* EntitySnapshot::GetEntity(EntityId eid) const {
+    auto iter = std::lower_bound(m_Entities.begin(), m_Entities.end(), eid, [](const EntityState& state, EntityId id) {
+        return state.id < id;
+    });
+
+    if (iter == m_Entities.end() || iter->id != eid) return nullptr;
+
+    return &*iter;
+}
+
+} // ns entity
+} // ns mc
@@ -0,0 +1,151 @@
+#include <mclib/entity/EntityStore.h>
+
+#include <algorithm>
+#include <new>
+
+namespace mc {
+namespace entity {
+
+namespace {
+
+// Blocks allocated at once when a pool runs out
+const std::size_t ChunkBlocks = 64;
+
+} // ns
+
+EntityStore::EntityStore() {
+
+}
+
+EntityStore::~EntityStore() {
+    for (void* chunk : m_Chunks)
+        ::operator delete(chunk);
+}
+
+EntityHandle EntityStore::Create(EntityId id) {
+    u32 slot;
+
+    if (!m_FreeSlots.empty()) {
+        slot = m_FreeSlots.back();
+        m_FreeSlots.pop_back();
+    } else {
+        slot = (u32)m_Indices.size();
+        m_Indices.push_back(0);
+        m_Generations.push_back(0);
+    }
+
+    m_Indices[slot] = (u32)m_Ids.size();
+
+    m_Slots.push_back(slot);
+    m_Ids.push_back(id);
+    m_Positions.emplace_back(0, 0, 0);
+    m_Velocities.emplace_back(0, 0, 0);
+    m_Yaws.push_back(0.0f);
+    m_Pitches.push_back(0.0f);
+    m_HeadPitches.push_back(0.0f);
+    m_Types.push_back(EntityType::Unknown);
+    m_VehicleIds.push_back(-1);
+
+    return EntityHandle{ slot, m_Generations[slot] };
+}
+
+void EntityStore::Destroy(EntityHandle handle) {
+    if (!IsValid(handle)) return;
+
+    std::size_t index = GetIndex(handle);
+    std::size_t last = m_Ids.size() - 1;
+
+    if (index != last) {
+        m_Slots[index] = m_Slots[last];
+        m_Ids[index] = m_Ids[last];
+        m_Positions[index] = m_Positions[last];
+        m_Velocities[index] = m_Velocities[last];
+        m_Yaws[index] = m_Yaws[last];
+        m_Pitches[index] = m_Pitches[last];
+        m_HeadPitches[index] = m_HeadPitches[last];
+        m_Types[index] = m_Types[last];
+        m_VehicleIds[index] = m_VehicleIds[last];
+
+        m_Indices[m_Slots[index]] = (u32)index;
+    }
+
+    m_Slots.pop_back();
+    m_Ids.pop_back();
+    m_Positions.pop_back();
+    m_Velocities.pop_back();
+    m_Yaws.pop_back();
+    m_Pitches.pop_back();
+    m_HeadPitches.pop_back();
+    m_Types.pop_back();
+    m_VehicleIds.pop_back();
+
+    ++m_Generations[handle.slot];
+    m_FreeSlots.push_back(handle.slot);
+}
+
+void EntityStore::CopyState(EntityHandle handle, const EntityStore& from, EntityHandle fromHandle) {
+    std::size_t index = GetIndex(handle);
+    std::size_t fromIndex = from.GetIndex(fromHandle);
+
+    m_Positions[index] = from.m_Positions[fromIndex];
+    m_Velocities[index] = from.m_Velocities[fromIndex];
+    m_Yaws[index] = from.m_Yaws[fromIndex];
+    m_Pitches[index] = from.m_Pitches[fromIndex];
+    m_HeadPitches[index] = from.m_HeadPitches[fromIndex];
+    m_Types[index] = from.m_Types[fromIndex];
+    m_VehicleIds[index] = from.m_VehicleIds[fromIndex];
+}
+
+void* EntityStore::Allocate(std::size_t size) {
+    std::lock_guard<std::mutex> lock(m_PoolMutex);
+
+    BlockPool* pool = nullptr;
+
+    for (BlockPool& candidate : m_Pools) {
+        if (candidate.size == size) {
+            pool = &candidate;
+            break;
+        }
+    }
+
+    if (!pool) {
+        m_Pools.push_back(BlockPool{ size, 0, std::vector<void*>() });
+        pool = &m_Pools.back();
+    }
+
+    if (pool->free.empty()) {
+        // Keep every block aligned for any type
+        std::size_t stride = (size + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+        // Room for every block to come back, so Deallocate never has to grow the list
+        if (pool->free.capacity() < pool->blocks + ChunkBlocks)
+            pool->free.reserve(std::max(pool->free.capacity() * 2, pool->blocks + ChunkBlocks));
+
+        m_Chunks.push_back(nullptr);
+
+        char* chunk = static_cast<char*>(::operator new(stride * ChunkBlocks));
+
+        m_Chunks.back() = chunk;
+        pool->blocks += ChunkBlocks;
+
+        for (std::size_t i = ChunkBlocks; i > 0; --i)
+            pool->free.push_back(chunk + (i - 1) * stride);
+    }
+
+    void* block = pool->free.back();
+    pool->free.pop_back();
+    return block;
+}
+
+void EntityStore::Deallocate(void* block, std::size_t size) noexcept {
+    std::lock_guard<std::mutex> lock(m_PoolMutex);
+
+    for (BlockPool& pool : m_Pools) {
+        if (pool.size == size) {
+            pool.free.push_back(block);
+            return;
+        }
+    }
+}
+
+} // ns entity
+} // ns mc
@@ -2,6 +2,9 @@
 
 #include <mclib/common/DataBuffer.h>
 
+#include <algorithm>
+#include <new>
+
 namespace mc {
 namespace entity {
 
@@ -23,7 +26,7 @@ DataBuffer& operator<<(DataBuffer& out, const EntityMetadata::StringType& value)
     return out << str;
 }
 
-DataBuffer EntityMetadata::SlotType::Serialize(mc::protocol::Version protocolVersion) {
+DataBuffer EntityMetadata::SlotType::Serialize(mc::protocol::Version protocolVersion) const {
     return value.Serialize(protocolVersion);
 }
 
@@ -93,12 +96,216 @@ DataBuffer& operator>>(DataBuffer& in, EntityMetadata::NBTType& value) {
     return in >> value.value;
 }
 
+EntityMetadata::Kind EntityMetadata::GetKind(DataType type) noexcept {
+    switch (type) {
+    case DataType::Byte:
+        return Kind::Byte;
+    case DataType::VarInt:
+    case DataType::Direction:
+    case DataType::OptBlockID:
+        return Kind::VarInt;
+    case DataType::Float:
+        return Kind::Float;
+    case DataType::String:
+    case DataType::Chat:
+    case DataType::OptChat:
+        return Kind::String;
+    case DataType::Slot:
+        return Kind::Slot;
+    case DataType::Boolean:
+        return Kind::Boolean;
+    case DataType::Rotation:
+        return Kind::Rotation;
+    case DataType::Position:
+    case DataType::OptPosition:
+        return Kind::Position;
+    case DataType::OptUUID:
+        return Kind::UUID;
+    case DataType::NBT:
+        return Kind::NBT;
+    default:
+        return Kind::None;
+    }
+}
+
+EntityMetadata::Field::Field(const Field& other) : type(DataType::None), string(nullptr) {
+    *this = other;
+}
+
+EntityMetadata::Field::Field(Field&& other) noexcept : type(DataType::None), string(nullptr) {
+    *this = std::move(other);
+}
+
+EntityMetadata::Field& EntityMetadata::Field::operator=(const Field& other) {
+    if (this == &other) return *this;
+
+    SetType(other.type);
+
+    switch (GetKind(type)) {
+    case Kind::Byte: byte = other.byte; break;
+    case Kind::VarInt: varInt = other.varInt; break;
+    case Kind::Float: floatValue = other.floatValue; break;
+    case Kind::Boolean: boolean = other.boolean; break;
+    case Kind::Rotation: rotation = other.rotation; break;
+    case Kind::Position: position = other.position; break;
+    case Kind::UUID: uuid = other.uuid; break;
+    case Kind::String: *string = *other.string; break;
+    case Kind::Slot: *slot = *other.slot; break;
+    case Kind::NBT: *nbt = *other.nbt; break;
+    default: break;
+    }
+
+    return *this;
+}
+
+EntityMetadata::Field& EntityMetadata::Field::operator=(Field&& other) noexcept {
+    if (this == &other) return *this;
+
+    Reset();
+    type = other.type;
+
+    switch (GetKind(type)) {
+    case Kind::Byte: new (&byte) ByteType(other.byte); break;
+    case Kind::VarInt: new (&varInt) VarIntType(other.varInt); break;
+    case Kind::Float: new (&floatValue) FloatType(other.floatValue); break;
+    case Kind::Boolean: new (&boolean) BooleanType(other.boolean); break;
+    case Kind::Rotation: new (&rotation) RotationType(other.rotation); break;
+    case Kind::Position: new (&position) PositionType(other.position); break;
+    case Kind::UUID: new (&uuid) UUIDType(other.uuid); break;
+    // Out of line values change owner without copying.
+    case Kind::String: string = other.string; other.string = nullptr; break;
+    case Kind::Slot: slot = other.slot; other.slot = nullptr; break;
+    case Kind::NBT: nbt = other.nbt; other.nbt = nullptr; break;
+    default: break;
+    }
+
+    other.type = DataType::None;
+    return *this;
+}
+
+const void* EntityMetadata::Field::Get() const noexcept {
+    switch (GetKind(type)) {
+    case Kind::Byte: return &byte;
+    case Kind::VarInt: return &varInt;
+    case Kind::Float: return &floatValue;
+    case Kind::Boolean: return &boolean;
+    case Kind::Rotation: return &rotation;
+    case Kind::Position: return &position;
+    case Kind::UUID: return &uuid;
+    case Kind::String: return string;
+    case Kind::Slot: return slot;
+    case Kind::NBT: return nbt;
+    default: return nullptr;
+    }
+}
+
+void EntityMetadata::Field::Reset() noexcept {
+    switch (GetKind(type)) {
+    case Kind::String: delete string; break;
+    case Kind::Slot: delete slot; break;
+    case Kind::NBT: delete nbt; break;
+    default: break;
+    }
+
+    type = DataType::None;
+    string = nullptr;
+}
+
+void EntityMetadata::Field::SetType(DataType newType) {
+    Kind kind = GetKind(newType);
+
+    if (kind == GetKind(type)) {
+        type = newType;
+        return;
+    }
+
+    Reset();
+
+    switch (kind) {
+    case Kind::Byte: new (&byte) ByteType(0); break;
+    case Kind::VarInt: new (&varInt) VarIntType(); break;
+    case Kind::Float: new (&floatValue) FloatType(0.0f); break;
+    case Kind::Boolean: new (&boolean) BooleanType(false); break;
+    case Kind::Rotation: new (&rotation) RotationType(); break;
+    case Kind::Position: new (&position) PositionType(false, mc::Position()); break;
+    case Kind::UUID: new (&uuid) UUIDType(false, UUID()); break;
+    case Kind::String: string = new StringType(); break;
+    case Kind::Slot: slot = new SlotType(); break;
+    case Kind::NBT: nbt = new NBTType(); break;
+    default: return;
+    }
+
+    type = newType;
+}
+
+EntityMetadata::EntityMetadata(protocol::Version protocolVersion) 
+    : m_Present(0),
+      m_ProtocolVersion(protocolVersion)
+{
+
+}
+
+const EntityMetadata::Field* EntityMetadata::FindField(std::size_t index) const noexcept {
+    if (index < InlineCount) {
+        if (!(m_Present & (1u << index))) return nullptr;
+        return &m_Fields[index];
+    }
+
+    for (const auto& entry : m_Overflow) {
+        if (entry.first == index)
+            return &entry.second;
+    }
+
+    return nullptr;
+}
+
+EntityMetadata::Field& EntityMetadata::GetOrCreateField(std::size_t index) {
+    if (index < InlineCount) {
+        m_Present |= 1u << index;
+        return m_Fields[index];
+    }
+
+    // Kept sorted so they're written in index order, like the inline fields.
+    auto iter = std::lower_bound(m_Overflow.begin(), m_Overflow.end(), index, [](const std::pair<u8, Field>& entry, std::size_t index) {
+        return entry.first < index;
+    });
+
+    if (iter != m_Overflow.end() && iter->first == index)
+        return iter->second;
+
+    return m_Overflow.emplace(iter, (u8)index, Field())->second;
+}
+
+void EntityMetadata::Merge(const EntityMetadata& delta) {
+    u32 present = delta.m_Present;
+
+    while (present) {
+        std::size_t index = 0;
+        while (!(present & (1u << index))) ++index;
+        present &= ~(1u << index);
+
+        GetOrCreateField(index) = delta.m_Fields[index];
+    }
+
+    for (const auto& entry : delta.m_Overflow)
+        GetOrCreateField(entry.first) = entry.second;
+}
+
+void EntityMetadata::Clear() noexcept {
+    for (std::size_t i = 0; i < InlineCount; ++i) {
+        if (m_Present & (1u << i))
+            m_Fields[i].Reset();
+    }
+
+    m_Present = 0;
+    m_Overflow.clear();
+}
+
 DataBuffer& operator<<(DataBuffer& out, const EntityMetadata& md) {
-    for (std::size_t i = 0; i < md.MetadataCount; ++i) {
-        EntityMetadata::DataType type = md.m_Metadata[i].second;
-        EntityMetadata::Type* value = md.m_Metadata[i].first.get();
+    auto write = [&](std::size_t i, const EntityMetadata::Field& field) {
+        EntityMetadata::DataType type = field.type;
 
-        if (!value) continue;
+        if (!field.IsSet()) return;
 
         u8 item = ((type << 5) | (i & 0x1F)) & 0xFF;
 
@@ -110,57 +317,65 @@ DataBuffer& operator<<(DataBuffer& out, const EntityMetadata& md) {
 
         switch (type) {
         case EntityMetadata::DataType::Byte:
-            out << *((EntityMetadata::ByteType*)value);
+            out << field.byte;
             break;
         case EntityMetadata::DataType::VarInt:
         case EntityMetadata::DataType::Direction:
         case EntityMetadata::DataType::OptBlockID:
-            out << *((EntityMetadata::VarIntType*)value);
+            out << field.varInt;
             break;
         case EntityMetadata::DataType::Float:
-            out << *((EntityMetadata::FloatType*)value);
+            out << field.floatValue;
             break;
         case EntityMetadata::DataType::String:
         case EntityMetadata::DataType::Chat:
-            out << *((EntityMetadata::StringType*)value);
+            out << *field.string;
             break;
         case EntityMetadata::DataType::OptChat:
-            out << ((EntityMetadata::StringType*)value)->exists;
-            if (((EntityMetadata::StringType*)value)->exists) {
-                out << *((EntityMetadata::StringType*)value);
+            out << field.string->exists;
+            if (field.string->exists) {
+                out << *field.string;
             }
             break;
         case EntityMetadata::DataType::Slot:
         {
-            DataBuffer serializedSlot = ((EntityMetadata::SlotType*)value)->Serialize(md.m_ProtocolVersion);
+            DataBuffer serializedSlot = field.slot->Serialize(md.m_ProtocolVersion);
             out << serializedSlot;
         }
             break;
         case EntityMetadata::DataType::Boolean:
-            out << *((EntityMetadata::BooleanType*)value);
+            out << field.boolean;
             break;
         case EntityMetadata::DataType::Rotation:
-            out << *((EntityMetadata::RotationType*)value);
+            out << field.rotation;
             break;
         case EntityMetadata::DataType::Position:
-            out << *((EntityMetadata::PositionType*)value);
+            out << field.position;
             break;
         case EntityMetadata::DataType::OptPosition:
-            out << ((EntityMetadata::PositionType*)value)->exists;
-            out << *((EntityMetadata::PositionType*)value);
+            out << field.position.exists;
+            out << field.position;
             break;
         case EntityMetadata::DataType::OptUUID:
-            out << ((EntityMetadata::UUIDType*)value)->exists;
-            out << *((EntityMetadata::UUIDType*)value);
+            out << field.uuid.exists;
+            out << field.uuid;
             break;
         case EntityMetadata::DataType::NBT:
-            out << *((EntityMetadata::NBTType*)value);
+            out << *field.nbt;
             break;
         default:
             break;
         }
+    };
+
+    for (std::size_t i = 0; i < EntityMetadata::InlineCount; ++i) {
+        if (md.m_Present & (1u << i))
+            write(i, md.m_Fields[i]);
     }
 
+    for (const auto& entry : md.m_Overflow)
+        write(entry.first, entry.second);
+
     // End byte
     out << (u8)0x7F;
     return out;
@@ -184,181 +399,72 @@ DataBuffer& operator>>(DataBuffer& in, EntityMetadata& md) {
             type = static_cast<EntityMetadata::DataType>(static_cast<int>(type) + 1);
         }
 
-        md.m_Metadata[index].second = type;
+        if (EntityMetadata::GetKind(type) == EntityMetadata::Kind::None)
+            continue;
+
+        EntityMetadata::Field& field = md.GetOrCreateField(index);
+
+        field.SetType(type);
 
         switch (type) {
             case EntityMetadata::DataType::Byte:
-            {
-                std::unique_ptr<EntityMetadata::ByteType> value = std::make_unique<EntityMetadata::ByteType>();
-                in >> *value;
-                md.m_Metadata[index].first = std::move(value);
-            }
-            break;
+                in >> field.byte;
+                break;
             case EntityMetadata::DataType::VarInt:
             case EntityMetadata::DataType::Direction:
             case EntityMetadata::DataType::OptBlockID:
-            {
-                std::unique_ptr<EntityMetadata::VarIntType> value = std::make_unique<EntityMetadata::VarIntType>();
-                in >> *value;
-                md.m_Metadata[index].first = std::move(value);
-            }
-            break;
+                in >> field.varInt;
+                break;
             case EntityMetadata::DataType::Float:
-            {
-                std::unique_ptr<EntityMetadata::FloatType> value = std::make_unique<EntityMetadata::FloatType>();
-                in >> *value;
-                md.m_Metadata[index].first = std::move(value);
-            }
-            break;
+                in >> field.floatValue;
+                break;
             case EntityMetadata::DataType::Chat:
             case EntityMetadata::DataType::String:
-            {
-                std::unique_ptr<EntityMetadata::StringType> value = std::make_unique<EntityMetadata::StringType>();
-                in >> *value;
-                md.m_Metadata[index].first = std::move(value);
-            }
-            break;
+                field.string->exists = true;
+                in >> *field.string;
+                break;
             case EntityMetadata::DataType::OptChat:
-            {
-                std::unique_ptr<EntityMetadata::StringType> value = std::make_unique<EntityMetadata::StringType>();
-                in >> value->exists;
-                if (value->exists) {
-                    in >> *value;
+                in >> field.string->exists;
+                if (field.string->exists) {
+                    in >> *field.string;
                 }
-                md.m_Metadata[index].first = std::move(value);
-            }
-            break;
+                break;
             case EntityMetadata::DataType::Slot:
-            {
-                std::unique_ptr<EntityMetadata::SlotType> value = std::make_unique<EntityMetadata::SlotType>();
-                value->Deserialize(in, md.m_ProtocolVersion);
-                md.m_Metadata[index].first = std::move(value);
-            }
-            break;
+                *field.slot = EntityMetadata::SlotType();
+                field.slot->Deserialize(in, md.m_ProtocolVersion);
+                break;
             case EntityMetadata::DataType::Boolean:
-            {
-                std::unique_ptr<EntityMetadata::BooleanType> value = std::make_unique<EntityMetadata::BooleanType>();
-                in >> *value;
-                md.m_Metadata[index].first = std::move(value);
-            }
-            break;
+                in >> field.boolean;
+                break;
             case EntityMetadata::DataType::Rotation:
-            {
-                std::unique_ptr<EntityMetadata::RotationType> value = std::make_unique<EntityMetadata::RotationType>();
-                in >> *value;
-                md.m_Metadata[index].first = std::move(value);
-            }
-            break;
+                in >> field.rotation;
+                break;
             case EntityMetadata::DataType::Position:
-            {
-                std::unique_ptr<EntityMetadata::PositionType> value = std::make_unique<EntityMetadata::PositionType>();
-                in >> *value;
-                value->exists = true;
-                md.m_Metadata[index].first = std::move(value);
-            }
-            break;
+                in >> field.position;
+                field.position.exists = true;
+                break;
             case EntityMetadata::DataType::OptPosition:
-            {
-                std::unique_ptr<EntityMetadata::PositionType> value = std::make_unique<EntityMetadata::PositionType>();
-                in >> value->exists;
-                if (value->exists) {
-                    in >> *value;
+                in >> field.position.exists;
+                if (field.position.exists) {
+                    in >> field.position;
                 }
-                md.m_Metadata[index].first = std::move(value);
-            }
-            break;
+                break;
             case EntityMetadata::DataType::OptUUID:
-            {
-                std::unique_ptr<EntityMetadata::UUIDType> value = std::make_unique<EntityMetadata::UUIDType>();
-                in >> value->exists;
-                if (value->exists) {
-                    in >> *value;
+                in >> field.uuid.exists;
+                if (field.uuid.exists) {
+                    in >> field.uuid;
                 }
-                md.m_Metadata[index].first = std::move(value);
-            }
-            break;
-            case EntityMetadata::DataType::NBT:
-            {
-                std::unique_ptr<EntityMetadata::NBTType> value = std::make_unique<EntityMetadata::NBTType>();
-                in >> *value;
-                md.m_Metadata[index].first = std::move(value);
-            }
-            break;
-            default:
-                break;
-        }
-    }
-
-    return in;
-}
-
-void EntityMetadata::CopyOther(const EntityMetadata& other) {
-    m_ProtocolVersion = other.m_ProtocolVersion;
-
-    for (std::size_t i = 0; i < MetadataCount; ++i) {
-        auto type = m_Metadata[i].second = other.m_Metadata[i].second;
-
-        switch (type) {
-            case DataType::Byte:
-                m_Metadata[i].first = std::make_unique<ByteType>(dynamic_cast<ByteType*>(other.m_Metadata[i].first.get())->value);
-                break;
-            case DataType::Direction:
-            case DataType::OptBlockID:
-            case DataType::VarInt:
-                m_Metadata[i].first = std::make_unique<VarIntType>(dynamic_cast<VarIntType*>(other.m_Metadata[i].first.get())->value);
-                break;
-            case DataType::Float:
-                m_Metadata[i].first = std::make_unique<FloatType>(dynamic_cast<FloatType*>(other.m_Metadata[i].first.get())->value);
-                break;
-            case DataType::String:
-            case DataType::Chat:
-            case DataType::OptChat:
-                m_Metadata[i].first = std::make_unique<StringType>(dynamic_cast<StringType*>(other.m_Metadata[i].first.get())->exists,
-                                                                   dynamic_cast<StringType*>(other.m_Metadata[i].first.get())->value);
                 break;
-            case DataType::Slot:
-                m_Metadata[i].first = std::make_unique<SlotType>(dynamic_cast<SlotType*>(other.m_Metadata[i].first.get())->value);
-                break;
-            case DataType::Boolean:
-                m_Metadata[i].first = std::make_unique<BooleanType>(dynamic_cast<BooleanType*>(other.m_Metadata[i].first.get())->value);
-                break;
-            case DataType::Rotation:
-                m_Metadata[i].first = std::make_unique<RotationType>(dynamic_cast<RotationType*>(other.m_Metadata[i].first.get())->value);
-                break;
-            case DataType::OptPosition:
-            case DataType::Position:
-                m_Metadata[i].first = std::make_unique<PositionType>(dynamic_cast<PositionType*>(other.m_Metadata[i].first.get())->exists, 
-                                                                     dynamic_cast<PositionType*>(other.m_Metadata[i].first.get())->value);
-                break;
-            case DataType::OptUUID:
-                m_Metadata[i].first = std::make_unique<UUIDType>(dynamic_cast<UUIDType*>(other.m_Metadata[i].first.get())->exists,
-                                                                 dynamic_cast<UUIDType*>(other.m_Metadata[i].first.get())->value);
-                break;
-            case DataType::NBT:
-                m_Metadata[i].first = std::make_unique<NBTType>(dynamic_cast<NBTType*>(other.m_Metadata[i].first.get())->value);
+            case EntityMetadata::DataType::NBT:
+                *field.nbt = EntityMetadata::NBTType();
+                in >> *field.nbt;
                 break;
             default:
                 break;
         }
     }
-}
-
-EntityMetadata::EntityMetadata(protocol::Version protocolVersion) 
-    : m_ProtocolVersion(protocolVersion)
-{
-    for (std::size_t i = 0; i < MetadataCount; ++i) {
-        m_Metadata[i].first = nullptr;
-        m_Metadata[i].second = DataType::None;
-    }
-}
 
-EntityMetadata::EntityMetadata(const EntityMetadata& rhs) {
-    CopyOther(rhs);
-}
-
-EntityMetadata& EntityMetadata::operator=(const EntityMetadata& rhs) {
-    CopyOther(rhs);
-    return *this;
+    return in;
 }
 
 } // ns entity
@@ -1,6 +1,7 @@
 #include <mclib/inventory/Slot.h>
 
 #include <mclib/common/DataBuffer.h>
+#include <mclib/nbt/Builder.h>
 
 namespace mc {
 namespace inventory {
@@ -62,6 +63,28 @@ DataBuffer Slot::Serialize(protocol::Version version) const {
     return out;
 }
 
+void Slot::Serialize(DataBuffer& out, s32 itemId, u8 itemCount, s16 itemDamage, const nbt::Builder& nbt, protocol::Version version) {
+    if (version > protocol::Version::Minecraft_1_12_2) {
+        if (itemId < 0) {
+            out << false;
+            return;
+        }
+
+        out << true << VarInt(itemId) << itemCount;
+    } else {
+        out << (s16)itemId;
+        if (itemId == -1) return;
+
+        out << itemCount << itemDamage;
+    }
+
+    if (nbt.HasData()) {
+        nbt.Write(out);
+    } else {
+        out << (u8)0;
+    }
+}
+
 void Slot::Deserialize(DataBuffer& in, protocol::Version version) {
     m_ItemId = -1;
     m_ItemCount = 0;
@@ -0,0 +1,458 @@
+#include <mclib/nbt/Builder.h>
+
+#include <mclib/common/DataBuffer.h>
+#include <mclib/common/MCString.h>
+
+#include <cstring>
+#include <stdexcept>
+
+namespace mc {
+namespace nbt {
+
+namespace {
+
+inline void WriteU8(u8*& out, u8 value) {
+    *out++ = value;
+}
+
+inline void WriteU16(u8*& out, u16 value) {
+    out[0] = (u8)(value >> 8);
+    out[1] = (u8)value;
+    out += 2;
+}
+
+inline void WriteU32(u8*& out, u32 value) {
+    out[0] = (u8)(value >> 24);
+    out[1] = (u8)(value >> 16);
+    out[2] = (u8)(value >> 8);
+    out[3] = (u8)value;
+    out += 4;
+}
+
+inline void WriteU64(u8*& out, u64 value) {
+    WriteU32(out, (u32)(value >> 32));
+    WriteU32(out, (u32)value);
+}
+
+inline void WriteBytes(u8*& out, const void* data, std::size_t length) {
+    if (length > 0)
+        memcpy(out, data, length);
+    out += length;
+}
+
+std::size_t GetFixedPayloadSize(TagType type) {
+    switch (type) {
+    case TagType::Byte: return 1;
+    case TagType::Short: return 2;
+    case TagType::Int: return 4;
+    case TagType::Long: return 8;
+    case TagType::Float: return 4;
+    case TagType::Double: return 8;
+    default: return 0;
+    }
+}
+
+} // ns
+
+Arena::Arena(std::size_t blockSize)
+    : m_BlockSize(blockSize), m_CurrentBlock(0), m_Offset(0)
+{
+
+}
+
+void* Arena::Allocate(std::size_t size, std::size_t alignment) {
+    // Anything that can't share a block gets a dedicated one that is released on Reset.
+    if (size + alignment > m_BlockSize) {
+        m_LargeBlocks.emplace_back(new u8[size + alignment]);
+        std::uintptr_t address = (std::uintptr_t)m_LargeBlocks.back().get();
+        address = (address + alignment - 1) & ~(std::uintptr_t)(alignment - 1);
+        return (void*)address;
+    }
+
+    while (true) {
+        if (m_CurrentBlock >= m_Blocks.size()) {
+            m_Blocks.emplace_back(new u8[m_BlockSize]);
+            m_Offset = 0;
+        }
+
+        std::uintptr_t base = (std::uintptr_t)m_Blocks[m_CurrentBlock].get();
+        std::uintptr_t address = (base + m_Offset + alignment - 1) & ~(std::uintptr_t)(alignment - 1);
+        std::size_t end = (std::size_t)(address - base) + size;
+
+        if (end <= m_BlockSize) {
+            m_Offset = end;
+            return (void*)address;
+        }
+
+        ++m_CurrentBlock;
+        m_Offset = 0;
+    }
+}
+
+void Arena::Reset() {
+    m_LargeBlocks.clear();
+    m_CurrentBlock = 0;
+    m_Offset = 0;
+}
+
+std::size_t Arena::GetCapacity() const {
+    return m_Blocks.size() * m_BlockSize;
+}
+
+KeyTable::KeyTable() {
+    // Id 0 is always the empty name.
+    Intern(std::string());
+}
+
+Key KeyTable::Intern(const std::string& utf8) {
+    auto iter = m_Lookup.find(utf8);
+    if (iter != m_Lookup.end())
+        return Key(iter->second);
+
+    if (utf8.length() > 0xFFFF)
+        throw std::invalid_argument("NBT tag name is too long.");
+
+    std::string encoded;
+    encoded.reserve(utf8.length() + 2);
+    encoded.push_back((char)(utf8.length() >> 8));
+    encoded.push_back((char)(utf8.length() & 0xFF));
+    encoded.append(utf8);
+
+    u32 id = (u32)m_Encoded.size();
+    m_Encoded.push_back(std::move(encoded));
+    m_Lookup.insert(std::make_pair(utf8, id));
+    return Key(id);
+}
+
+Key KeyTable::Intern(const std::wstring& name) {
+    return Intern(utf16to8(name));
+}
+
+Key KeyTable::Find(const std::string& utf8) const {
+    auto iter = m_Lookup.find(utf8);
+    if (iter == m_Lookup.end())
+        return Key();
+    return Key(iter->second);
+}
+
+std::string KeyTable::GetName(Key key) const {
+    if (!key.IsValid()) return "";
+    return m_Encoded[key.GetId()].substr(2);
+}
+
+Builder::Builder(std::size_t blockSize)
+    : m_Arena(blockSize),
+      m_OwnedKeys(new KeyTable()),
+      m_Keys(m_OwnedKeys.get()),
+      m_Root(nullptr),
+      m_Size(0)
+{
+    Reset();
+}
+
+Builder::Builder(KeyTable& keys, std::size_t blockSize)
+    : m_Arena(blockSize),
+      m_Keys(&keys),
+      m_Root(nullptr),
+      m_Size(0)
+{
+    Reset();
+}
+
+void Builder::Reset() {
+    m_Arena.Reset();
+
+    m_Root = m_Arena.Allocate<BuilderNode>();
+    m_Root->type = TagType::Compound;
+    m_Root->listType = TagType::End;
+    m_Root->key = Key(0);
+    m_Root->next = nullptr;
+    m_Root->value.children.first = nullptr;
+    m_Root->value.children.last = nullptr;
+    m_Root->value.children.count = 0;
+
+    // Type, empty name and the end tag of the root compound
+    m_Size = 1 + 2 + 1;
+}
+
+void Builder::SetRootName(Key key) {
+    m_Size -= m_Keys->GetEncoded(m_Root->key).length();
+    m_Root->key = key;
+    m_Size += m_Keys->GetEncoded(m_Root->key).length();
+}
+
+BuilderNode* Builder::CreateNode(BuilderNode* parent, TagType type, Key key) {
+    if (parent->type == TagType::List) {
+        if (type != parent->listType) {
+            std::string message = "Tried to add " + to_string(type) + " to list containing " + to_string(parent->listType) + ".";
+            throw std::invalid_argument(message.c_str());
+        }
+        key = Key();
+    } else if (parent->type == TagType::Compound) {
+        if (!key.IsValid())
+            throw std::invalid_argument("Tags in a compound need a name.");
+        m_Size += 1 + m_Keys->GetEncoded(key).length();
+    } else {
+        throw std::invalid_argument("Tried to add a child to a " + to_string(parent->type) + " tag.");
+    }
+
+    BuilderNode* node = m_Arena.Allocate<BuilderNode>();
+    node->type = type;
+    node->listType = TagType::End;
+    node->key = key;
+    node->next = nullptr;
+
+    auto& children = parent->value.children;
+    if (children.last)
+        children.last->next = node;
+    else
+        children.first = node;
+    children.last = node;
+    ++children.count;
+
+    m_Size += GetFixedPayloadSize(type);
+    return node;
+}
+
+BuilderNode* Builder::AddByte(BuilderNode* parent, Key key, u8 value) {
+    BuilderNode* node = CreateNode(parent, TagType::Byte, key);
+    node->value.integer = value;
+    return node;
+}
+
+BuilderNode* Builder::AddShort(BuilderNode* parent, Key key, s16 value) {
+    BuilderNode* node = CreateNode(parent, TagType::Short, key);
+    node->value.integer = value;
+    return node;
+}
+
+BuilderNode* Builder::AddInt(BuilderNode* parent, Key key, s32 value) {
+    BuilderNode* node = CreateNode(parent, TagType::Int, key);
+    node->value.integer = value;
+    return node;
+}
+
+BuilderNode* Builder::AddLong(BuilderNode* parent, Key key, s64 value) {
+    BuilderNode* node = CreateNode(parent, TagType::Long, key);
+    node->value.integer = value;
+    return node;
+}
+
+BuilderNode* Builder::AddFloat(BuilderNode* parent, Key key, float value) {
+    BuilderNode* node = CreateNode(parent, TagType::Float, key);
+    node->value.f = value;
+    return node;
+}
+
+BuilderNode* Builder::AddDouble(BuilderNode* parent, Key key, double value) {
+    BuilderNode* node = CreateNode(parent, TagType::Double, key);
+    node->value.d = value;
+    return node;
+}
+
+BuilderNode* Builder::AddString(BuilderNode* parent, Key key, const std::string& utf8) {
+    if (utf8.length() > 0xFFFF)
+        throw std::invalid_argument("NBT string is too long.");
+
+    BuilderNode* node = CreateNode(parent, TagType::String, key);
+    char* data = m_Arena.Allocate<char>(utf8.length());
+    memcpy(data, utf8.data(), utf8.length());
+
+    node->value.array.data = data;
+    node->value.array.length = (u32)utf8.length();
+    m_Size += 2 + utf8.length();
+    return node;
+}
+
+BuilderNode* Builder::AddByteArray(BuilderNode* parent, Key key, const u8* data, std::size_t length) {
+    BuilderNode* node = CreateNode(parent, TagType::ByteArray, key);
+    u8* copy = m_Arena.Allocate<u8>(length);
+    if (length > 0)
+        memcpy(copy, data, length);
+
+    node->value.array.data = copy;
+    node->value.array.length = (u32)length;
+    m_Size += 4 + length;
+    return node;
+}
+
+BuilderNode* Builder::AddIntArray(BuilderNode* parent, Key key, const s32* data, std::size_t length) {
+    BuilderNode* node = CreateNode(parent, TagType::IntArray, key);
+    s32* copy = m_Arena.Allocate<s32>(length);
+    if (length > 0)
+        memcpy(copy, data, length * sizeof(s32));
+
+    node->value.array.data = copy;
+    node->value.array.length = (u32)length;
+    m_Size += 4 + length * sizeof(s32);
+    return node;
+}
+
+BuilderNode* Builder::AddList(BuilderNode* parent, Key key, TagType listType) {
+    BuilderNode* node = CreateNode(parent, TagType::List, key);
+    node->listType = listType;
+    node->value.children.first = nullptr;
+    node->value.children.last = nullptr;
+    node->value.children.count = 0;
+    // List type and size
+    m_Size += 1 + 4;
+    return node;
+}
+
+BuilderNode* Builder::AddCompound(BuilderNode* parent, Key key) {
+    BuilderNode* node = CreateNode(parent, TagType::Compound, key);
+    node->value.children.first = nullptr;
+    node->value.children.last = nullptr;
+    node->value.children.count = 0;
+    // End tag
+    m_Size += 1;
+    return node;
+}
+
+void Builder::WriteNode(u8*& out, const BuilderNode* node, bool named) const {
+    if (named) {
+        const std::string& name = m_Keys->GetEncoded(node->key);
+        WriteU8(out, (u8)node->type);
+        WriteBytes(out, name.data(), name.length());
+    }
+
+    switch (node->type) {
+    case TagType::Byte:
+        WriteU8(out, (u8)node->value.integer);
+        break;
+    case TagType::Short:
+        WriteU16(out, (u16)node->value.integer);
+        break;
+    case TagType::Int:
+        WriteU32(out, (u32)node->value.integer);
+        break;
+    case TagType::Long:
+        WriteU64(out, (u64)node->value.integer);
+        break;
+    case TagType::Float:
+    {
+        u32 bits;
+        memcpy(&bits, &node->value.f, sizeof(bits));
+        WriteU32(out, bits);
+    }
+    break;
+    case TagType::Double:
+    {
+        u64 bits;
+        memcpy(&bits, &node->value.d, sizeof(bits));
+        WriteU64(out, bits);
+    }
+    break;
+    case TagType::String:
+        WriteU16(out, (u16)node->value.array.length);
+        WriteBytes(out, node->value.array.data, node->value.array.length);
+        break;
+    case TagType::ByteArray:
+        WriteU32(out, node->value.array.length);
+        WriteBytes(out, node->value.array.data, node->value.array.length);
+        break;
+    case TagType::IntArray:
+    {
+        const s32* values = (const s32*)node->value.array.data;
+
+        WriteU32(out, node->value.array.length);
+        for (u32 i = 0; i < node->value.array.length; ++i)
+            WriteU32(out, (u32)values[i]);
+    }
+    break;
+    case TagType::List:
+        WriteU8(out, (u8)node->listType);
+        WriteU32(out, node->value.children.count);
+        for (const BuilderNode* child = node->value.children.first; child; child = child->next)
+            WriteNode(out, child, false);
+        break;
+    case TagType::Compound:
+        for (const BuilderNode* child = node->value.children.first; child; child = child->next)
+            WriteNode(out, child, true);
+        WriteU8(out, 0);
+        break;
+    default:
+        break;
+    }
+}
+
+std::size_t Builder::Write(u8* buffer, std::size_t capacity) const {
+    if (capacity < m_Size) return 0;
+
+    u8* out = buffer;
+    WriteNode(out, m_Root, true);
+    return (std::size_t)(out - buffer);
+}
+
+void Builder::Write(DataBuffer& out) const {
+    std::size_t offset = out.GetSize();
+
+    out.Resize(offset + m_Size);
+    Write(&out[offset], m_Size);
+}
+
+TagPtr Builder::ToTag(const BuilderNode* node) const {
+    std::string name = m_Keys->GetName(node->key);
+
+    switch (node->type) {
+    case TagType::Byte:
+        return std::make_shared<TagByte>(name, (u8)node->value.integer);
+    case TagType::Short:
+        return std::make_shared<TagShort>(name, (s16)node->value.integer);
+    case TagType::Int:
+        return std::make_shared<TagInt>(name, (s32)node->value.integer);
+    case TagType::Long:
+        return std::make_shared<TagLong>(name, node->value.integer);
+    case TagType::Float:
+        return std::make_shared<TagFloat>(name, node->value.f);
+    case TagType::Double:
+        return std::make_shared<TagDouble>(name, node->value.d);
+    case TagType::String:
+    {
+        const char* data = (const char*)node->value.array.data;
+        std::wstring value = utf8to16(std::string(data, data + node->value.array.length));
+        return std::make_shared<TagString>(utf8to16(name), value);
+    }
+    case TagType::ByteArray:
+    {
+        const char* data = (const char*)node->value.array.data;
+        return std::make_shared<TagByteArray>(name, std::string(data, data + node->value.array.length));
+    }
+    case TagType::IntArray:
+    {
+        const s32* data = (const s32*)node->value.array.data;
+        return std::make_shared<TagIntArray>(name, std::vector<s32>(data, data + node->value.array.length));
+    }
+    case TagType::List:
+    {
+        auto list = std::make_shared<TagList>(name, node->listType);
+        for (const BuilderNode* child = node->value.children.first; child; child = child->next)
+            list->AddItem(ToTag(child));
+        return list;
+    }
+    case TagType::Compound:
+    {
+        auto compound = std::make_shared<TagCompound>(name);
+        for (const BuilderNode* child = node->value.children.first; child; child = child->next)
+            compound->AddItem(child->type, ToTag(child));
+        return compound;
+    }
+    default:
+        break;
+    }
+
+    return nullptr;
+}
+
+TagCompound Builder::ToCompound() const {
+    TagPtr root = ToTag(m_Root);
+    return *static_cast<TagCompound*>(root.get());
+}
+
+DataBuffer& operator<<(DataBuffer& out, const Builder& builder) {
+    builder.Write(out);
+    return out;
+}
+
+} // ns nbt
+} // ns mc
@@ -28,9 +28,11 @@ DataBuffer& operator<<(DataBuffer& out, const Tag& tag) {
     u8 type = (u8)tag.GetType();
     out << type;
 
-    std::wstring name = tag.GetName();
-    TagString stringTag(L"", name);
-    stringTag.Write(out);
+    // Write the name directly instead of going through a temporary TagString.
+    std::string name = utf16to8(tag.m_Name);
+    out << (u16)name.length();
+    out << name;
+
     tag.Write(out);
     return out;
 }
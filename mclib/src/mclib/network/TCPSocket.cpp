@@ -85,7 +85,8 @@ std::size_t TCPSocket::Receive(DataBuffer& buffer, std::size_t amount) {
 #else
         int err = errno;
 #endif
-        if (err == WOULDBLOCK) {
+        // Zero means the peer closed the connection, errno is only meaningful on failure.
+        if (recvAmount < 0 && err == WOULDBLOCK) {
             buffer.Clear();
             return 0;
         }
@@ -109,7 +110,7 @@ DataBuffer TCPSocket::Receive(std::size_t amount) {
 #else
         int err = errno;
 #endif
-        if (err == WOULDBLOCK)
+        if (received < 0 && err == WOULDBLOCK)
             return DataBuffer();
 
         Disconnect();
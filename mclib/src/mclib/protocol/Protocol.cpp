@@ -720,10 +720,13 @@ const std::unordered_map<Version, std::shared_ptr<Protocol>> protocolMap = {
 };
 
 bool Protocol::GetAgnosticId(State state, s32 protocolId, s32& agnosticId) {
-    auto& packetMap = m_InboundMap[state];
-    auto iter = packetMap.find(protocolId);
+    auto stateIter = m_InboundMap.find(state);
+    if (stateIter == m_InboundMap.end())
+        return false;
+
+    auto iter = stateIter->second.find(protocolId);
 
-    if (iter == packetMap.end()) 
+    if (iter == stateIter->second.end()) 
         return false;
 
     agnosticId = iter->second;
@@ -739,9 +742,13 @@ packets::InboundPacket* Protocol::CreateInboundPacket(State state, s32 protocolI
     
     packets::InboundPacket* packet = nullptr;
 
-    auto stateMap = agnosticStateMap[state];
-    auto iter = stateMap.find(agnosticId);
-    if (iter != stateMap.end()) {
+    // Packets are created from the pipeline's decode thread too, so only look things up here.
+    auto stateIter = agnosticStateMap.find(state);
+    if (stateIter == agnosticStateMap.end())
+        return nullptr;
+
+    auto iter = stateIter->second.find(agnosticId);
+    if (iter != stateIter->second.end()) {
         packet = iter->second();
 
         if (packet) {
@@ -655,7 +655,7 @@ void TabCompletePacket::Dispatch(PacketHandler* handler) {
     handler->HandlePacket(this);
 }
 
-ChatPacket::ChatPacket() {
+ChatPacket::ChatPacket() : m_ChatDataParsed(false) {
     
 }
 
@@ -667,14 +667,33 @@ bool ChatPacket::Deserialize(DataBuffer& data, std::size_t packetLength) {
     data >> position;
 
     m_Position = (ChatPosition)position;
+    m_RawChatData = chatData.GetUTF8();
+    m_ChatData = json();
+    m_ChatDataParsed = false;
+    
+    return true;
+}
+
+const json& ChatPacket::GetChatData() const {
+    if (!m_ChatDataParsed) {
+        m_ChatDataParsed = true;
 
-    try {
-        m_ChatData = json::parse(chatData.GetUTF8());
-    } catch (json::parse_error&) {
+        try {
+            m_ChatData = json::parse(m_RawChatData);
+        } catch (json::parse_error&) {
 
+        }
     }
-    
-    return true;
+
+    return m_ChatData;
+}
+
+util::ChatMessage ChatPacket::GetChatMessage() const {
+    return util::ParseChat(m_RawChatData);
+}
+
+std::string ChatPacket::GetText() const {
+    return util::GetChatText(m_RawChatData);
 }
 
 void ChatPacket::Dispatch(PacketHandler* handler) {
@@ -985,52 +1004,36 @@ ChunkDataPacket::ChunkDataPacket() {
 }
 
 bool ChunkDataPacket::Deserialize(DataBuffer& data, std::size_t packetLength) {
-    world::ChunkColumnMetadata metadata;
-
-    data >> metadata.x;
-    data >> metadata.z;
-    data >> metadata.continuous;
+    data >> m_Metadata.x;
+    data >> m_Metadata.z;
+    data >> m_Metadata.continuous;
     VarInt mask;
     data >> mask;
 
-    metadata.sectionmask = mask.GetInt();
+    m_Metadata.sectionmask = mask.GetInt();
 
     if (m_Connection)
-        metadata.skylight = m_Connection->GetDimension() == 0;
+        m_Metadata.skylight = m_Connection->GetDimension() == 0;
     else
-        metadata.skylight = true;
+        m_Metadata.skylight = true;
 
     VarInt size;
 
     data >> size;
 
-    m_ChunkColumn = std::make_shared<world::ChunkColumn>(metadata);
-
-    data >> *m_ChunkColumn;
-
-    // Skip biome information
-    if (metadata.continuous)
-        data.SetReadOffset(data.GetReadOffset() + 256);
-
-    VarInt entities;
-    data >> entities;
+    data.ReadSome(m_ColumnData, data.GetRemaining());
 
-    s32 entityCount = entities.GetInt();
-
-    for (s32 i = 0; i < entities.GetInt(); ++i) {
-        nbt::NBT nbt;
-
-        data >> nbt;
-
-        block::BlockEntityPtr blockEntity = block::BlockEntity::CreateFromNBT(&nbt);
+    return true;
+}
 
-        if (blockEntity == nullptr) continue;
+void ChunkDataPacket::Decode(const block::BlockRegistry* registry) const {
+    if (m_ChunkColumn) return;
 
-        m_BlockEntities.push_back(blockEntity);
-        m_ChunkColumn->AddBlockEntity(blockEntity);
-    }
+    m_ColumnData.SetReadOffset(0);
 
-    return true;
+    m_ChunkColumn = std::make_shared<world::ChunkColumn>(m_Metadata, registry);
+    m_ChunkColumn->Load(m_ColumnData);
+    m_BlockEntities = m_ChunkColumn->GetBlockEntities();
 }
 
 void ChunkDataPacket::Dispatch(PacketHandler* handler) {
@@ -2893,17 +2896,31 @@ DataBuffer HeldItemChangePacket::Serialize() const {
 
 CreativeInventoryActionPacket::CreativeInventoryActionPacket(s16 slot, inventory::Slot item)
     : m_Slot(slot),
-    m_Item(item)
+    m_Item(item),
+    m_ItemNBT(nullptr)
 {
     
 }
 
+CreativeInventoryActionPacket::CreativeInventoryActionPacket(s16 slot, s32 itemId, u8 itemCount, s16 itemDamage, const nbt::Builder& nbt)
+    : m_Slot(slot),
+    m_Item(itemId, itemCount, itemDamage),
+    m_ItemNBT(&nbt)
+{
+
+}
+
 DataBuffer CreativeInventoryActionPacket::Serialize() const {
     DataBuffer buffer;
 
     buffer << m_Id;
     buffer << m_Slot;
-    buffer << m_Item.Serialize(m_ProtocolVersion);
+
+    if (m_ItemNBT) {
+        inventory::Slot::Serialize(buffer, m_Item.GetItemId(), m_Item.GetItemCount(), m_Item.GetItemDamage(), *m_ItemNBT, m_ProtocolVersion);
+    } else {
+        buffer << m_Item.Serialize(m_ProtocolVersion);
+    }
 
     return buffer;
 }
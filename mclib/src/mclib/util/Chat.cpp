@@ -0,0 +1,523 @@
+#include <mclib/util/Chat.h>
+
+#include <mclib/common/Json.h>
+
+#include <cstring>
+
+namespace mc {
+namespace util {
+
+namespace {
+
+struct ChatColorName {
+    const char* name;
+    ChatColor color;
+};
+
+const ChatColorName ColorNames[] = {
+    { "black", ChatColor::Black },
+    { "dark_blue", ChatColor::DarkBlue },
+    { "dark_green", ChatColor::DarkGreen },
+    { "dark_aqua", ChatColor::DarkAqua },
+    { "dark_red", ChatColor::DarkRed },
+    { "dark_purple", ChatColor::DarkPurple },
+    { "gold", ChatColor::Gold },
+    { "gray", ChatColor::Gray },
+    { "dark_gray", ChatColor::DarkGray },
+    { "blue", ChatColor::Blue },
+    { "green", ChatColor::Green },
+    { "aqua", ChatColor::Aqua },
+    { "red", ChatColor::Red },
+    { "light_purple", ChatColor::LightPurple },
+    { "yellow", ChatColor::Yellow },
+    { "white", ChatColor::White },
+    { "reset", ChatColor::Reset },
+};
+
+struct TranslationFormat {
+    const char* key;
+    const char* format;
+};
+
+// The translations that servers commonly send for player chat.
+// Anything else is rendered as its arguments separated by spaces.
+const TranslationFormat TranslationFormats[] = {
+    { "chat.type.text", "<%s> %s" },
+    { "chat.type.announcement", "[%s] %s" },
+    { "chat.type.emote", "* %s %s" },
+    { "chat.type.admin", "[%s: %s]" },
+    { "commands.message.display.incoming", "%s whispers to you: %s" },
+    { "commands.message.display.outgoing", "You whisper to %s: %s" },
+    { "multiplayer.player.joined", "%s joined the game" },
+    { "multiplayer.player.left", "%s left the game" },
+};
+
+enum class ChatKey { Text, Translate, Color, Bold, Italic, Underlined, Strikethrough, Obfuscated, Extra, With, Other };
+
+ChatKey GetChatKey(const std::string& key) {
+    if (key == "text") return ChatKey::Text;
+    if (key == "translate") return ChatKey::Translate;
+    if (key == "color") return ChatKey::Color;
+    if (key == "bold") return ChatKey::Bold;
+    if (key == "italic") return ChatKey::Italic;
+    if (key == "underlined") return ChatKey::Underlined;
+    if (key == "strikethrough") return ChatKey::Strikethrough;
+    if (key == "obfuscated") return ChatKey::Obfuscated;
+    if (key == "extra") return ChatKey::Extra;
+    if (key == "with") return ChatKey::With;
+    return ChatKey::Other;
+}
+
+u8 GetFormatFlag(ChatKey key) {
+    switch (key) {
+    case ChatKey::Bold: return ChatFormat::Bold;
+    case ChatKey::Italic: return ChatFormat::Italic;
+    case ChatKey::Underlined: return ChatFormat::Underlined;
+    case ChatKey::Strikethrough: return ChatFormat::Strikethrough;
+    case ChatKey::Obfuscated: return ChatFormat::Obfuscated;
+    default: return 0;
+    }
+}
+
+// Builds the flat component list straight from the parser events.
+class ChatSaxHandler {
+private:
+    using Component = ChatParser::Component;
+
+    struct Frame {
+        s32 component;
+        // Set for arrays: the list of the owning component that the elements are appended to
+        bool isArray;
+        bool withList;
+        ChatKey key;
+    };
+
+    std::vector<Component>& m_Components;
+    std::string& m_Strings;
+    std::vector<Frame> m_Stack;
+    // Depth inside a value that isn't part of the chat text, such as hoverEvent
+    std::size_t m_SkipDepth;
+
+    s32 CreateComponent() {
+        Component component;
+
+        component.textOffset = 0;
+        component.textLength = 0;
+        component.translate = false;
+        component.color = -1;
+        component.formatMask = 0;
+        component.format = 0;
+        component.firstExtra = component.lastExtra = -1;
+        component.firstWith = component.lastWith = -1;
+        component.next = -1;
+
+        m_Components.push_back(component);
+        return (s32)m_Components.size() - 1;
+    }
+
+    void Append(s32 owner, bool withList, s32 child) {
+        Component& parent = m_Components[owner];
+        s32& first = withList ? parent.firstWith : parent.firstExtra;
+        s32& last = withList ? parent.lastWith : parent.lastExtra;
+
+        if (last == -1)
+            first = child;
+        else
+            m_Components[last].next = child;
+        last = child;
+    }
+
+    // Creates the component for a value that appears inside an array, or the root.
+    s32 CreateElement() {
+        s32 index = CreateComponent();
+
+        if (!m_Stack.empty()) {
+            const Frame& top = m_Stack.back();
+            Append(top.component, top.withList, index);
+        }
+
+        return index;
+    }
+
+    void SetText(s32 index, const std::string& value) {
+        Component& component = m_Components[index];
+
+        component.textOffset = (u32)m_Strings.size();
+        component.textLength = (u32)value.size();
+        m_Strings.append(value);
+    }
+
+    bool InArray() const {
+        return !m_Stack.empty() && m_Stack.back().isArray;
+    }
+
+    bool AddScalar(const std::string& text) {
+        if (m_SkipDepth > 0) return true;
+
+        if (m_Stack.empty() || InArray())
+            SetText(CreateElement(), text);
+
+        return true;
+    }
+
+public:
+    ChatSaxHandler(std::vector<Component>& components, std::string& strings)
+        : m_Components(components), m_Strings(strings), m_SkipDepth(0)
+    {
+
+    }
+
+    bool null() {
+        return true;
+    }
+
+    bool boolean(bool val) {
+        if (m_SkipDepth > 0) return true;
+
+        if (!m_Stack.empty() && !m_Stack.back().isArray) {
+            u8 flag = GetFormatFlag(m_Stack.back().key);
+
+            if (flag) {
+                Component& component = m_Components[m_Stack.back().component];
+
+                component.formatMask |= flag;
+                if (val)
+                    component.format |= flag;
+                else
+                    component.format &= ~flag;
+            }
+        } else {
+            return AddScalar(val ? "true" : "false");
+        }
+
+        return true;
+    }
+
+    bool number_integer(json::number_integer_t val) {
+        return AddScalar(std::to_string(val));
+    }
+
+    bool number_unsigned(json::number_unsigned_t val) {
+        return AddScalar(std::to_string(val));
+    }
+
+    bool number_float(json::number_float_t val, const std::string& s) {
+        return AddScalar(s);
+    }
+
+    bool string(std::string& val) {
+        if (m_SkipDepth > 0) return true;
+
+        if (m_Stack.empty() || InArray()) {
+            SetText(CreateElement(), val);
+            return true;
+        }
+
+        Frame& top = m_Stack.back();
+
+        switch (top.key) {
+        case ChatKey::Text:
+            // A translation key wins over text when both are present.
+            if (!m_Components[top.component].translate)
+                SetText(top.component, val);
+            break;
+        case ChatKey::Translate:
+            SetText(top.component, val);
+            m_Components[top.component].translate = true;
+            break;
+        case ChatKey::Color:
+            for (const auto& entry : ColorNames) {
+                if (val == entry.name) {
+                    m_Components[top.component].color = (s8)entry.color;
+                    break;
+                }
+            }
+            break;
+        default:
+            break;
+        }
+
+        return true;
+    }
+
+    bool start_object(std::size_t) {
+        if (m_SkipDepth > 0 || (!m_Stack.empty() && !m_Stack.back().isArray)) {
+            ++m_SkipDepth;
+            return true;
+        }
+
+        Frame frame;
+        frame.component = CreateElement();
+        frame.isArray = false;
+        frame.withList = false;
+        frame.key = ChatKey::Other;
+
+        m_Stack.push_back(frame);
+        return true;
+    }
+
+    bool key(std::string& val) {
+        if (m_SkipDepth == 0 && !m_Stack.empty())
+            m_Stack.back().key = GetChatKey(val);
+        return true;
+    }
+
+    bool end_object() {
+        if (m_SkipDepth > 0) {
+            --m_SkipDepth;
+            return true;
+        }
+
+        m_Stack.pop_back();
+        return true;
+    }
+
+    bool start_array(std::size_t) {
+        if (m_SkipDepth > 0) {
+            ++m_SkipDepth;
+            return true;
+        }
+
+        Frame frame;
+        frame.isArray = true;
+        frame.withList = false;
+        frame.key = ChatKey::Other;
+
+        if (m_Stack.empty() || InArray()) {
+            // A bare array is treated as a component whose extra list holds the elements.
+            frame.component = CreateElement();
+        } else {
+            const Frame& owner = m_Stack.back();
+
+            if (owner.key != ChatKey::Extra && owner.key != ChatKey::With) {
+                ++m_SkipDepth;
+                return true;
+            }
+
+            frame.component = owner.component;
+            frame.withList = owner.key == ChatKey::With;
+        }
+
+        m_Stack.push_back(frame);
+        return true;
+    }
+
+    bool end_array() {
+        if (m_SkipDepth > 0) {
+            --m_SkipDepth;
+            return true;
+        }
+
+        m_Stack.pop_back();
+        return true;
+    }
+
+    bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception&) {
+        return false;
+    }
+};
+
+} // ns
+
+ChatParser::ChatParser() {
+
+}
+
+bool ChatParser::ParseComponents(const std::string& json) {
+    m_Components.clear();
+    m_Strings.clear();
+
+    ChatSaxHandler handler(m_Components, m_Strings);
+
+    try {
+        return json::sax_parse(json.begin(), json.end(), &handler);
+    } catch (json::exception&) {
+        return false;
+    }
+}
+
+void ChatParser::EmitText(const char* text, std::size_t length, ChatColor& color, u8& format, ChatMessage* message, std::string* out) const {
+    std::size_t start = 0;
+
+    auto flush = [&](std::size_t end) {
+        if (end <= start) return;
+
+        std::size_t count = end - start;
+
+        if (message) {
+            u32 offset = (u32)message->m_Text.size();
+
+            message->m_Text.append(text + start, count);
+
+            if (!message->m_Runs.empty()) {
+                ChatRun& last = message->m_Runs.back();
+
+                if (last.color == color && last.format == format && last.offset + last.length == offset) {
+                    last.length += (u32)count;
+                    return;
+                }
+            }
+
+            ChatRun run;
+            run.offset = offset;
+            run.length = (u32)count;
+            run.color = color;
+            run.format = format;
+            message->m_Runs.push_back(run);
+        } else {
+            out->append(text + start, count);
+        }
+    };
+
+    // Legacy formatting codes are a section sign (0xC2 0xA7 in utf-8) followed by the code character.
+    for (std::size_t i = 0; i + 2 < length; ++i) {
+        if ((u8)text[i] != 0xC2 || (u8)text[i + 1] != 0xA7) continue;
+
+        flush(i);
+
+        char code = text[i + 2];
+        if (code >= 'A' && code <= 'Z') code += 'a' - 'A';
+
+        if (code >= '0' && code <= '9') {
+            color = (ChatColor)(code - '0');
+            format = 0;
+        } else if (code >= 'a' && code <= 'f') {
+            color = (ChatColor)(code - 'a' + 10);
+            format = 0;
+        } else if (code == 'k') {
+            format |= ChatFormat::Obfuscated;
+        } else if (code == 'l') {
+            format |= ChatFormat::Bold;
+        } else if (code == 'm') {
+            format |= ChatFormat::Strikethrough;
+        } else if (code == 'n') {
+            format |= ChatFormat::Underlined;
+        } else if (code == 'o') {
+            format |= ChatFormat::Italic;
+        } else if (code == 'r') {
+            color = ChatColor::Reset;
+            format = 0;
+        }
+
+        i += 2;
+        start = i + 1;
+    }
+
+    flush(length);
+}
+
+void ChatParser::Emit(s32 index, ChatColor color, u8 format, ChatMessage* message, std::string* text) const {
+    const Component& component = m_Components[index];
+
+    if (component.color != -1)
+        color = (ChatColor)component.color;
+    format = (format & ~component.formatMask) | component.format;
+
+    const char* data = m_Strings.data() + component.textOffset;
+
+    if (component.translate) {
+        const char* translation = nullptr;
+
+        for (const auto& entry : TranslationFormats) {
+            if (component.textLength == strlen(entry.key) && strncmp(data, entry.key, component.textLength) == 0) {
+                translation = entry.format;
+                break;
+            }
+        }
+
+        if (translation) {
+            s32 nextArg = component.firstWith;
+            const char* literal = translation;
+            const char* current = translation;
+
+            while (*current) {
+                if (current[0] != '%' || current[1] != 's') {
+                    ++current;
+                    continue;
+                }
+
+                ChatColor literalColor = color;
+                u8 literalFormat = format;
+                EmitText(literal, current - literal, literalColor, literalFormat, message, text);
+
+                if (nextArg != -1) {
+                    Emit(nextArg, color, format, message, text);
+                    nextArg = m_Components[nextArg].next;
+                }
+
+                current += 2;
+                literal = current;
+            }
+
+            ChatColor literalColor = color;
+            u8 literalFormat = format;
+            EmitText(literal, current - literal, literalColor, literalFormat, message, text);
+        } else {
+            for (s32 arg = component.firstWith; arg != -1; arg = m_Components[arg].next) {
+                if (arg != component.firstWith) {
+                    ChatColor spaceColor = color;
+                    u8 spaceFormat = format;
+                    EmitText(" ", 1, spaceColor, spaceFormat, message, text);
+                }
+
+                Emit(arg, color, format, message, text);
+            }
+        }
+    } else {
+        // Legacy codes carry on into the extra components, like they do in the vanilla client.
+        EmitText(data, component.textLength, color, format, message, text);
+    }
+
+    for (s32 extra = component.firstExtra; extra != -1; extra = m_Components[extra].next)
+        Emit(extra, color, format, message, text);
+}
+
+bool ChatParser::Parse(const std::string& json, ChatMessage* message) {
+    bool result = ParseComponents(json);
+
+    message->Clear();
+
+    if (!m_Components.empty())
+        Emit(0, ChatColor::Reset, 0, message, nullptr);
+
+    return result;
+}
+
+bool ChatParser::ParseText(const std::string& json, std::string* text) {
+    bool result = ParseComponents(json);
+
+    text->clear();
+
+    if (!m_Components.empty())
+        Emit(0, ChatColor::Reset, 0, nullptr, text);
+
+    return result;
+}
+
+namespace {
+
+// Every chat packet goes through here, so each thread keeps one parser and its buffers.
+ChatParser& GetThreadParser() {
+    thread_local ChatParser parser;
+
+    return parser;
+}
+
+} // ns
+
+ChatMessage ParseChat(const std::string& json) {
+    ChatMessage message;
+
+    GetThreadParser().Parse(json, &message);
+    return message;
+}
+
+std::string GetChatText(const std::string& json) {
+    std::string text;
+
+    GetThreadParser().ParseText(json, &text);
+    return text;
+}
+
+} // ns util
+} // ns mc
@@ -0,0 +1,67 @@
+#include <mclib/util/LatencyTracker.h>
+
+#include <algorithm>
+#include <chrono>
+
+namespace mc {
+namespace util {
+
+LatencyTracker::LatencyTracker(std::size_t capacity)
+    : m_Samples(std::max<std::size_t>(capacity, 1)),
+      m_Next(0),
+      m_Count(0)
+{
+
+}
+
+void LatencyTracker::Record(u64 latency) {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    m_Samples[m_Next] = latency;
+    m_Next = (m_Next + 1) % m_Samples.size();
+    m_Count = std::min(m_Count + 1, m_Samples.size());
+}
+
+void LatencyTracker::Clear() {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    m_Next = 0;
+    m_Count = 0;
+}
+
+LatencyPercentiles LatencyTracker::GetPercentiles() const {
+    std::vector<u64> samples;
+
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        samples.assign(m_Samples.begin(), m_Samples.begin() + m_Count);
+    }
+
+    LatencyPercentiles result = {};
+
+    result.samples = samples.size();
+    if (samples.empty()) return result;
+
+    std::sort(samples.begin(), samples.end());
+
+    auto at = [&samples](double percentile) {
+        std::size_t index = (std::size_t)(percentile * (samples.size() - 1) + 0.5);
+        return samples[index];
+    };
+
+    result.p50 = at(0.50);
+    result.p90 = at(0.90);
+    result.p99 = at(0.99);
+    result.max = samples.back();
+
+    return result;
+}
+
+s64 LatencyTracker::Now() {
+    using namespace std::chrono;
+
+    return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+} // ns util
+} // ns mc
@@ -0,0 +1,106 @@
+#include <mclib/util/ThreadPool.h>
+
+#include <algorithm>
+
+namespace mc {
+namespace util {
+
+ThreadPool::ThreadPool(std::size_t threadCount)
+    : m_Queued(0), m_NextQueue(0), m_Running(true)
+{
+    if (threadCount == 0)
+        threadCount = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+
+    for (std::size_t i = 0; i < threadCount; ++i)
+        m_Queues.push_back(std::make_unique<WorkQueue>());
+
+    for (std::size_t i = 0; i < threadCount; ++i)
+        m_Threads.emplace_back(&ThreadPool::WorkerThread, this, i);
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_WakeMutex);
+        m_Running = false;
+    }
+    m_Wake.notify_all();
+
+    for (auto& thread : m_Threads)
+        thread.join();
+}
+
+void ThreadPool::Submit(Task task) {
+    std::size_t index = m_NextQueue.fetch_add(1, std::memory_order_relaxed) % m_Queues.size();
+    WorkQueue& queue = *m_Queues[index];
+
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back(std::move(task));
+        ++m_Queued;
+    }
+
+    {
+        // Keeps a worker from missing the notification between checking m_Queued and starting to wait.
+        std::lock_guard<std::mutex> lock(m_WakeMutex);
+    }
+    m_Wake.notify_one();
+}
+
+bool ThreadPool::PopTask(std::size_t index, Task& task) {
+    // Own queue first, oldest task first so work finishes roughly in submission order.
+    {
+        WorkQueue& own = *m_Queues[index];
+        std::lock_guard<std::mutex> lock(own.mutex);
+
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.front());
+            own.tasks.pop_front();
+            --m_Queued;
+            return true;
+        }
+    }
+
+    for (std::size_t i = 1; i < m_Queues.size(); ++i) {
+        WorkQueue& victim = *m_Queues[(index + i) % m_Queues.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.back());
+            victim.tasks.pop_back();
+            --m_Queued;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void ThreadPool::WorkerThread(std::size_t index) {
+    while (true) {
+        Task task;
+
+        if (PopTask(index, task)) {
+            task();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_WakeMutex);
+
+        m_Wake.wait(lock, [this]() { return !m_Running || m_Queued > 0; });
+
+        if (!m_Running) break;
+    }
+}
+
+bool ThreadPool::RunPendingTask() {
+    Task task;
+
+    if (!PopTask(m_NextQueue.load(std::memory_order_relaxed) % m_Queues.size(), task))
+        return false;
+
+    task();
+    return true;
+}
+
+} // ns util
+} // ns mc
@@ -296,12 +296,22 @@ PlayerController::PlayerController(core::Connection* connection, world::World& w
       m_World(world),
       m_Position(0, 0, 0),
       m_BoundingBox(Vector3d(-0.3, 0, -0.3), Vector3d(0.3, 1.8, 0.3)),
+      m_Collider(world),
+      m_NavigationGrid(world),
+      m_Pathfinder(m_NavigationGrid),
+      m_PathPlanner(m_Pathfinder),
+      m_PathIndex(0),
+      m_PathVersion(0),
+      m_Replan(false),
+      m_PhysicsBatch(nullptr),
+      m_Body(0),
       m_EntityId(-1),
       m_LastUpdate(GetTime()),
       m_Sprinting(false),
       m_LoadedIn(false),
       m_MoveSpeed(4.3),
-      m_HandleFall(true)
+      m_HandleFall(true),
+      m_OnGround(true)
 {
     m_PlayerManager.RegisterListener(this);
 
@@ -310,6 +320,7 @@ PlayerController::PlayerController(core::Connection* connection, world::World& w
 }
 
 PlayerController::~PlayerController() {
+    SetPhysicsBatch(nullptr);
     m_PlayerManager.UnregisterListener(this);
 }
 
@@ -318,60 +329,30 @@ AABB PlayerController::GetBoundingBox() const {
 }
 
 bool PlayerController::ClearPath(Vector3d target) {
-    return true;
-    Vector3d position = m_Position;
-
-    double dist = target.Distance(position);
-
-    Vector3d toTarget = target - position;
-    Vector3d n = Vector3Normalize(toTarget);
-
-    Vector3d side = n.Cross(Vector3d(0, 1, 0));
-
-    const double CheckWidth = 0.3;
-
-    auto check = [&](Vector3d start, Vector3d delta) {
-        Vector3d checkAbove = start + delta + Vector3d(0, 1, 0);
-        Vector3d checkBelow = start + delta + Vector3d(0, 0, 0);
-        block::BlockPtr aboveBlock = m_World.GetBlock(checkAbove);
-        block::BlockPtr belowBlock = m_World.GetBlock(checkBelow);
-
-        if (aboveBlock && aboveBlock->IsSolid())
-            return false;
-
-        if (belowBlock && belowBlock->IsSolid()) {
-            block::BlockPtr twoAboveBlock = m_World.GetBlock(checkAbove + Vector3d(0, 1, 0));
-            // Bad path if there isn't a two high gap in it
-            if (twoAboveBlock && twoAboveBlock->IsSolid())
-                return false;
-
-            // Jump up 1 block to keep searching
-            position += Vector3d(0, 1, 0);
-        }
-        return true;
-    };
-
-    for (s32 i = 0; i < (int)std::ceil(dist); ++i) {
-        Vector3d delta(i * n.x, 0, i * n.z);
+    return m_Pathfinder.FindPath(GetFeetPosition(), ToVector3i(target)).complete;
+}
 
-        // Check right side
-        if (!check(position + side * CheckWidth, delta)) return false;
-        if (!check(position - side * CheckWidth, delta)) return false;
+Vector3i PlayerController::GetFeetPosition() const {
+    return ToVector3i(m_Position);
+}
 
-        Vector3d checkFloor = position + delta + Vector3d(0, -1, 0);
-        block::BlockPtr floorBlock = m_World.GetBlock(checkFloor);
-        if (floorBlock && !floorBlock->IsSolid()) {
-            block::BlockPtr belowFloorBlock = m_World.GetBlock(checkFloor - Vector3d(0, 1, 0));
+void PlayerController::UpdatePath() {
+    const u64 version = m_NavigationGrid.GetVersion();
 
-            // Fail if there is a two block drop
-            if (belowFloorBlock && !belowFloorBlock->IsSolid())
-                return false;
+    if (!m_Replan) {
+        if (version == m_PathVersion) return;
 
-            position.y--;
-        }
+        // A path that can't reach the target is only searched again once it's been walked.
+        if (!m_Path.complete && m_PathIndex < m_Path.nodes.size()) return;
     }
 
-    return true;
+    // The planner only repairs the part of its search that the changes touched.
+    m_PathPlanner.SetGoal(ToVector3i(m_TargetPos));
+    m_Path = m_PathPlanner.FindPath(GetFeetPosition());
+    // The first node is where the player already is.
+    m_PathIndex = 1;
+    m_PathVersion = version;
+    m_Replan = false;
 }
 
 void PlayerController::SetMoveSpeed(double speed) { m_MoveSpeed = speed; }
@@ -380,8 +361,11 @@ void PlayerController::OnClientSpawn(core::PlayerPtr player) {
     m_Yaw = player->GetEntity()->GetYaw();
     m_Pitch = player->GetEntity()->GetPitch();
     m_Position = player->GetEntity()->GetPosition();
+    if (m_PhysicsBatch)
+        m_PhysicsBatch->SetPosition(m_Body, m_Position);
     m_LoadedIn = true;
     m_TargetPos = m_Position;
+    m_Replan = true;
     auto entity = player->GetEntity();
     if (entity) {
         EntityId eid = entity->GetEntityId();
@@ -420,87 +404,68 @@ void PlayerController::UpdateDigging() {
 
 }
 
-std::vector<std::pair<block::BlockPtr, Vector3i>> PlayerController::GetNearbyBlocks(const s32 radius) {
-    using BlockPos = std::pair<block::BlockPtr, Vector3i>;
-
-    std::vector<BlockPos> nearbyBlocks;
-
-    for (s32 x = -radius; x < radius; ++x) {
-        for (s32 y = -radius; y < radius; ++y) {
-            for (s32 z = -radius; z < radius; ++z) {
-                Vector3d checkPos = m_Position + Vector3d(x, y, z);
-
-                auto state = m_World.GetBlock(checkPos);
-
-                if (state && state->IsSolid())
-                    nearbyBlocks.push_back(std::make_pair<>(state, mc::ToVector3i(checkPos)));
-            }
-        }
-    }
-
-    std::sort(nearbyBlocks.begin(), nearbyBlocks.end(), [](const BlockPos& a, const BlockPos& b) {
-        return a.second < b.second;
-    });
-
-    nearbyBlocks.erase(std::unique(nearbyBlocks.begin(), nearbyBlocks.end()), nearbyBlocks.end());
+bool PlayerController::HandleJump() {
+    AABB box = m_BoundingBox + m_Position;
 
-    return nearbyBlocks;
-}
+    // Walking into a block can leave the player a rounding error inside of it.
+    box.min.x += world::StuckTolerance;
+    box.min.z += world::StuckTolerance;
+    box.max.x -= world::StuckTolerance;
+    box.max.z -= world::StuckTolerance;
 
-bool PlayerController::HandleJump() {
-    AABB playerBounds = m_BoundingBox + m_Position;
+    const std::vector<AABB>& boxes = m_Collider.GetCollisionBoxes(box);
 
-    for (const auto& state : GetNearbyBlocks(2)) {
-        auto checkBlock = state.first;
-        auto pos = state.second;
+    if (boxes.empty())
+        return false;
 
-        auto result = checkBlock->CollidesWith(pos, playerBounds);
-        if (result.first) {
-            m_Position.y = result.second.max.y;
-            return true;
-        }
-    }
+    // Climb onto the highest block the player is stuck in.
+    double top = boxes.front().max.y;
+    for (const AABB& bounds : boxes)
+        top = std::max(top, bounds.max.y);
 
-    return false;
+    m_Position.y = top;
+    return true;
 }
 
 bool PlayerController::HandleFall() {
-    double bestDist = FallSpeed;
-    block::BlockPtr bestBlock = nullptr;
-
     if (!InLoadedChunk())
         return false;
 
-    AABB playerBounds = m_BoundingBox + (m_Position - Vector3d(0, FallSpeed, 0));
-
-    for (const auto& state : GetNearbyBlocks(2)) {
-        auto checkBlock = state.first;
-
-        auto boundingBoxes = checkBlock->GetBoundingBoxes();
-        for (auto blockBounds : boundingBoxes) {
-            AABB checkBounds = blockBounds + state.second;
-
-            if (checkBounds.Intersects(playerBounds)) {
-                double penetration = checkBounds.max.y - playerBounds.min.y;
-                double dist = FallSpeed - penetration;
-
-                if (dist < bestDist)
-                    bestDist = dist;
-            }
-        }
-    }
+    world::MoveResult result = m_Collider.Move(m_BoundingBox + m_Position, Vector3d(0.0, -FallSpeed, 0.0));
 
-    m_Position -= Vector3d(0.0, bestDist, 0.0);
+    m_Position.y += result.motion.y;
 
-    return bestDist == FallSpeed;
+    return !result.collidedVertically;
 }
 
 void PlayerController::SetTargetPosition(Vector3d target) {
+    if (ToVector3i(target) != ToVector3i(m_TargetPos))
+        m_Replan = true;
+
     m_TargetPos = target;
 }
 
 void PlayerController::SetHandleFall(bool handle) {
     m_HandleFall = handle;
+
+    if (m_PhysicsBatch)
+        m_PhysicsBatch->SetFalls(m_Body, handle);
+}
+
+void PlayerController::SetPhysicsBatch(world::PhysicsBatch* batch) {
+    if (batch == m_PhysicsBatch) return;
+
+    if (m_PhysicsBatch) {
+        m_Position = m_PhysicsBatch->GetPosition(m_Body);
+        m_PhysicsBatch->RemoveBody(m_Body);
+    }
+
+    m_PhysicsBatch = batch;
+
+    if (m_PhysicsBatch) {
+        m_Body = m_PhysicsBatch->AddBody(m_World, m_Position);
+        m_PhysicsBatch->SetFalls(m_Body, m_HandleFall);
+    }
 }
 
 void PlayerController::UpdatePosition() {
@@ -522,12 +487,53 @@ void PlayerController::UpdatePosition() {
         counter = 0;
     }
 
+    UpdatePath();
+
     Vector3d target = m_TargetPos;
+    // Paths go up whole blocks, which takes a jump instead of a step.
+    double stepHeight = StepHeight;
+
+    while (m_PathIndex < m_Path.nodes.size()) {
+        const Vector3i& node = m_Path.nodes[m_PathIndex];
+        Vector3d center(node.x + 0.5, m_Position.y, node.z + 0.5);
+        double distance = (center - m_Position).Length();
+
+        if (distance > 3.0) {
+            // Knocked off of the path, so search again next tick.
+            m_Replan = true;
+            if (m_PhysicsBatch)
+                m_PhysicsBatch->Stop(m_Body);
+            return;
+        }
+
+        if (distance > 0.15) {
+            target = center;
+            if (node.y > (s64)std::floor(m_Position.y))
+                stepHeight = JumpHeight;
+            break;
+        }
+
+        ++m_PathIndex;
+    }
+
+    // Wait at the end of the path if the target can't be reached.
+    if ((m_PathIndex >= m_Path.nodes.size() && !m_Path.complete) || (m_PhysicsBatch && IsInVehicle())) {
+        if (m_PhysicsBatch)
+            m_PhysicsBatch->Stop(m_Body);
+        return;
+    }
+
+    if (m_PhysicsBatch) {
+        // The batch walks the rest of the way in its steps.
+        m_PhysicsBatch->SetTarget(m_Body, target, m_MoveSpeed, stepHeight);
+        return;
+    }
+
     Vector3d toTarget = target - GetPosition();
     toTarget.y = 0;
     double dist = toTarget.Length();
 
-    if (!ClearPath(target))
+    if (dist < 0.001)
         return;
 
     Vector3d n = Vector3Normalize(toTarget);
@@ -538,17 +544,25 @@ void PlayerController::UpdatePosition() {
     if (n.Length() > dist)
         n = Vector3Normalize(n) * dist;
 
-    Move(n);
+    if (IsInVehicle()) return;
+
+    Walk(n, stepHeight);
 }
 
 void PlayerController::Update() {
     if (!m_LoadedIn) return;
 
+    if (m_PhysicsBatch)
+        m_Position = m_PhysicsBatch->GetPosition(m_Body);
+
     UpdatePosition();
 
     bool onGround = true;
 
-    if (HandleJump()) {
+    if (m_PhysicsBatch) {
+        // Already climbed and fell in the last step of the batch.
+        onGround = m_PhysicsBatch->IsOnGround(m_Body);
+    } else if (HandleJump()) {
         console << "Jumping\n";
     } else {
         if (!m_HandleFall) {
@@ -571,6 +585,8 @@ void PlayerController::Update() {
             
     }
 
+    m_OnGround = onGround;
+
     protocol::packets::out::PlayerPositionAndLookPacket response(m_Position,
         m_Yaw * 180.0f / 3.14159f, m_Pitch * 180.0f / 3.14159f, onGround);
 
@@ -580,7 +596,7 @@ void PlayerController::Update() {
 }
 
 bool PlayerController::InLoadedChunk() const {
-    return m_World.GetChunk(ToVector3i(m_Position)) != nullptr;
+    return static_cast<const world::World&>(m_World).GetChunk(ToVector3i(m_Position)) != nullptr;
 }
 
 Vector3d PlayerController::GetPosition() const { return m_Position; }
@@ -594,22 +610,31 @@ Vector3d PlayerController::GetHeading() const {
 float PlayerController::GetYaw() const { return m_Yaw; }
 float PlayerController::GetPitch() const { return m_Pitch; }
 
+bool PlayerController::IsInVehicle() const {
+    if (m_EntityId == -1) return false;
+
+    core::PlayerPtr player = m_PlayerManager.GetPlayerByEntityId(m_EntityId);
+    if (!player) return false;
+
+    entity::EntityPtr entity = player->GetEntity();
+
+    return entity && entity->GetVehicleId() != -1;
+}
+
 void PlayerController::Move(Vector3d delta) {
-    //delta.y = 0;
+    // Don't move if player is in a vehicle
+    if (IsInVehicle()) return;
 
-    if (m_EntityId != -1) {
-        core::PlayerPtr player = m_PlayerManager.GetPlayerByEntityId(m_EntityId);
-        if (player) {
-            entity::EntityPtr entity = player->GetEntity();
+    Walk(delta, StepHeight);
+}
 
-            if (entity) {
-                if (entity->GetVehicleId() != -1)
-                    return; // Don't move if player is in a vehicle
-            }
-        }
-    }
+void PlayerController::Walk(Vector3d delta, double stepHeight) {
+    world::MoveResult result = m_Collider.Move(m_BoundingBox + m_Position, delta, m_OnGround, stepHeight);
+
+    m_Position += result.motion;
 
-    m_Position += delta;
+    if (m_PhysicsBatch)
+        m_PhysicsBatch->SetPosition(m_Body, m_Position);
 }
 
 void PlayerController::SetYaw(float yaw) { m_Yaw = yaw; }
@@ -717,39 +742,9 @@ public:
         console << "Set experience. Level: " << packet->GetLevel() << "\n";
     }
 
-    std::string ParseChatNode(const json& node) {
-        if (node.is_null()) return "";
-        if (node.is_string()) return node.get<std::string>();
-        if (node.is_object()) {
-            std::string result;
-
-            if (!node["extra"].is_null())
-                result += ParseChatNode(node["extra"]);
-            if (node["text"].is_string())
-                result += node["text"].get<std::string>();
-            return result;
-        }
-        if (node.is_array()) {
-            std::string result;
-
-            for (auto arrayNode : node)
-                result += ParseChatNode(arrayNode);
-            return result;
-        }
-        return "";
-    }
-
     void HandlePacket(protocol::packets::in::ChatPacket* packet) {
-        const json& root = packet->GetChatData();
+        std::string message = packet->GetText();
 
-        std::string message = ParseChatNode(root);
-        std::size_t pos = message.find((char)0xA7);
-        
-        while (pos != std::string::npos) {
-            message.erase(pos - 1, 3);
-            pos = message.find((char)0xA7);
-        }
-        
         message.erase(std::remove_if(message.begin(), message.end(), [](char c) {
             return c < 32 || c > 126;
         }), message.end());
@@ -881,7 +876,8 @@ PlayerFollower::PlayerFollower(protocol::packets::PacketDispatcher* dispatcher,
       m_PlayerManager(*client->GetPlayerManager()),
       m_EntityManager(*client->GetEntityManager()),
       m_PlayerController(*client->GetPlayerController()),
-      m_Target(L"")
+      m_Target(L""),
+      m_Predictor(nullptr)
 {
     client->RegisterListener(this);
     m_PlayerManager.RegisterListener(this);
@@ -892,10 +888,33 @@ PlayerFollower::~PlayerFollower() {
     m_PlayerManager.UnregisterListener(this);
 }
 
+Vector3d PlayerFollower::GetTargetPosition(const entity::EntityPtr& entity) const {
+    entity::EntityPtr target = entity;
+    EntityId vid = entity->GetVehicleId();
+
+    if (vid != -1) {
+        entity::EntityPtr vehicle = m_EntityManager.GetEntity(vid);
+        if (vehicle)
+            target = vehicle;
+    }
+
+    Vector3d position = target->GetPosition();
+
+    if (m_Predictor)
+        m_Predictor->PredictPosition(target->GetEntityId(), GetTime(), &position);
+
+    return position;
+}
+
 void PlayerFollower::UpdateRotation() {
     if (!m_Following || !m_Following->GetEntity()) return;
 
-    m_PlayerController.LookAt(m_Following->GetEntity()->GetPosition());
+    Vector3d position = m_Following->GetEntity()->GetPosition();
+
+    if (m_Predictor)
+        m_Predictor->PredictPosition(m_Following->GetEntity()->GetEntityId(), GetTime(), &position);
+
+    m_PlayerController.LookAt(position);
     /*static u64 lastUpdate = GetTime();
     u64 ticks = GetTime();
     float dt = (ticks - lastUpdate) / 1000.0f;
@@ -926,11 +945,7 @@ void PlayerFollower::OnTick() {
     }
 
     auto entity = m_Following->GetEntity();
-    EntityId vid = entity->GetVehicleId();
-    Vector3d targetPosition = entity->GetPosition();
-
-    if (vid != -1)
-        targetPosition = m_EntityManager.GetEntity(vid)->GetPosition();
+    Vector3d targetPosition = GetTargetPosition(entity);
 
     float yaw = (entity->GetYaw() / 256.0f) * 360.0f;
     float pitch = (entity->GetPitch() / 256.0f) * 360.0f;
@@ -961,9 +976,6 @@ bool PlayerFollower::IsIgnored(const std::wstring& name) {
 }
 
 void PlayerFollower::FindClosestPlayer() {
-    double closest = std::numeric_limits<double>::max();
-        
-
     m_Following = nullptr;
 
     if (!m_Target.empty()) {
@@ -977,33 +989,17 @@ void PlayerFollower::FindClosestPlayer() {
     }
 
     if (!m_Following) {
-        for (auto& kv : m_PlayerManager) {
-            core::PlayerPtr player = kv.second;
-
-            if (IsIgnored(player->GetName())) continue;
-
-            auto entity = player->GetEntity();
+        EntityId peid = m_EntityManager.GetPlayerEntity()->GetEntityId();
 
-            if (!entity) continue;
+        entity::EntityPtr closest = m_EntityManager.Nearest(m_PlayerController.GetPosition(), [&](const entity::EntityPtr& entity) {
+            if (entity->GetType() != entity::EntityType::Player || entity->GetEntityId() == peid) return false;
 
-            EntityId peid = m_EntityManager.GetPlayerEntity()->GetEntityId();
-            if (entity->GetEntityId() == peid) continue;
-
-            Vector3d pos = entity->GetPosition();
-            EntityId vid = entity->GetVehicleId();
-            if (vid != -1) {
-                entity::EntityPtr vehicle = m_EntityManager.GetEntity(vid);
-                if (vehicle)
-                    pos = vehicle->GetPosition();
-            }
-
-            double dist = pos.Distance(m_PlayerController.GetPosition());
+            core::PlayerPtr player = m_PlayerManager.GetPlayerByEntityId(entity->GetEntityId());
+            return player && !IsIgnored(player->GetName());
+        });
 
-            if (dist < closest) {
-                closest = dist;
-                m_Following = player;
-            }
-        }
+        if (closest)
+            m_Following = m_PlayerManager.GetPlayerByEntityId(closest->GetEntityId());
     }
 
     static u64 lastOutput = 0;
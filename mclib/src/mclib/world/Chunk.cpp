@@ -3,23 +3,33 @@
 #include <mclib/common/DataBuffer.h>
 
 #include <algorithm>
+#include <mutex>
+#include <string>
 
 namespace mc {
 namespace world {
 
 Chunk::Chunk()
+    : m_Shared(false)
 {
     m_BitsPerBlock = 4;
 }
 
-Chunk::Chunk(const Chunk& other) {
+Chunk::Chunk(const Chunk& other)
+    : m_Shared(false)
+{
+    m_Palette = other.m_Palette;
     m_Data = other.m_Data;
     m_BitsPerBlock = other.m_BitsPerBlock;
 }
 
 Chunk& Chunk::operator=(const Chunk& other) {
+    m_Palette = other.m_Palette;
     m_Data = other.m_Data;
+    // Built for the old palette, so it's rebuilt on the next SetBlock.
+    m_PaletteIndex.clear();
     m_BitsPerBlock = other.m_BitsPerBlock;
+    m_Shared = false;
     return *this;
 }
 
@@ -29,6 +39,8 @@ void Chunk::Load(DataBuffer& in, ChunkColumnMetadata* meta, s32 chunkIndex) {
     VarInt paletteLength;
     in >> paletteLength;
 
+    m_Palette.clear();
+    m_PaletteIndex.clear();
     m_Palette.reserve(paletteLength.GetInt());
 
     for (s32 i = 0; i < paletteLength.GetInt(); ++i) {
@@ -59,98 +71,513 @@ void Chunk::Load(DataBuffer& in, ChunkColumnMetadata* meta, s32 chunkIndex) {
     }
 }
 
-block::BlockPtr Chunk::GetBlock(Vector3i chunkPosition) const {
-    if (chunkPosition.x < 0 || chunkPosition.x > 15 || chunkPosition.y < 0 || chunkPosition.y > 15 || chunkPosition.z < 0 || chunkPosition.z > 15) {
-        return block::BlockRegistry::GetInstance()->GetBlock(0);
+std::size_t Chunk::GetMemoryUsage() const {
+    return sizeof(Chunk) + m_Palette.capacity() * sizeof(u32) + m_Data.capacity() * sizeof(u64) + m_PaletteIndex.capacity() * sizeof(u16);
+}
+
+void Chunk::Serialize(DataBuffer& out) const {
+    out << m_BitsPerBlock;
+    out << VarInt((s32)m_Palette.size());
+
+    for (u32 value : m_Palette)
+        out << value;
+
+    out << VarInt((s32)m_Data.size());
+
+    for (u64 value : m_Data)
+        out << value;
+}
+
+void Chunk::Deserialize(DataBuffer& in) {
+    VarInt paletteLength;
+    VarInt dataLength;
+
+    in >> m_BitsPerBlock;
+    in >> paletteLength;
+
+    m_PaletteIndex.clear();
+    m_Palette.resize(paletteLength.GetInt());
+
+    for (u32& value : m_Palette)
+        in >> value;
+
+    in >> dataLength;
+
+    m_Data.resize(dataLength.GetInt());
+
+    for (u64& value : m_Data)
+        in >> value;
+}
+
+namespace {
+
+const std::size_t BlocksPerChunk = 16 * 16 * 16;
+const u8 MinBitsPerBlock = 4;
+
+inline std::size_t HashPaletteValue(u32 value) {
+    // Block data is mostly type << 4, so mix the low bits in before masking.
+    return (std::size_t)((value * 2654435761u) >> 16);
+}
+
+// At least bits, and enough to store value directly
+u8 FitBits(u8 bits, u32 value) {
+    while (value >> bits)
+        ++bits;
+
+    return bits;
+}
+
+// Blocks that stop motion without being solid
+const char* const FluidNames[] = {
+    "minecraft:water", "minecraft:flowing_water", "minecraft:lava", "minecraft:flowing_lava", "minecraft:bubble_column"
+};
+
+// Bit 1 << HeightmapType for every heightmap the block counts towards
+u8 ComputeHeightmapFlags(const block::BlockRegistry* registry, u32 blockData) {
+    if (blockData == 0) return 0;
+
+    u8 flags = 1 << (u8)HeightmapType::NonAir;
+    block::BlockPtr block = registry->GetBlock(blockData);
+
+    if (!block) return flags;
+
+    if (block->IsSolid())
+        flags |= (1 << (u8)HeightmapType::Solid) | (1 << (u8)HeightmapType::MotionBlocking);
+
+    // Water and lava, flowing and still. The flattened registries have them under the same names.
+    std::string name = block->GetName();
+
+    for (const char* fluid : FluidNames) {
+        if (name == fluid)
+            flags |= 1 << (u8)HeightmapType::MotionBlocking;
+    }
+
+    return flags;
+}
+
+// Flags of every state in the registry, shared by the columns using it. Built again if blocks were registered since the last one.
+std::shared_ptr<const std::vector<u8>> GetHeightmapFlagTable(const block::BlockRegistry* registry) {
+    static std::mutex mutex;
+    static std::map<const block::BlockRegistry*, std::shared_ptr<const std::vector<u8>>> tables;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& result = tables[registry];
+
+    if (!result || result->size() != registry->GetStateCount()) {
+        auto table = std::make_shared<std::vector<u8>>(registry->GetStateCount());
+
+        for (u32 data = 0; data < table->size(); ++data)
+            (*table)[data] = ComputeHeightmapFlags(registry, data);
+
+        result = table;
     }
 
-    const std::size_t index = (std::size_t)(chunkPosition.y * 16 * 16 + chunkPosition.z * 16 + chunkPosition.x);
-    const s32 bitIndex = index * m_BitsPerBlock;
-    const s32 startIndex = bitIndex / 64;
-    const s32 endIndex = (((index + 1) * m_BitsPerBlock) - 1) / 64;
-    const s32 startSubIndex = bitIndex % 64;
+    return result;
+}
+
+// States the registry doesn't know are only counted as not air.
+inline u8 GetHeightmapFlags(const std::vector<u8>& table, u32 blockData) {
+    if (blockData < table.size()) return table[blockData];
+
+    return blockData ? 1 << (u8)HeightmapType::NonAir : 0;
+}
+
+} // ns
 
-    const s64 maxValue = (1 << m_BitsPerBlock) - 1;
-    u32 value;
+u32 Chunk::GetValue(std::size_t index) const {
+    const std::size_t bitIndex = index * m_BitsPerBlock;
+    const std::size_t startIndex = bitIndex / 64;
+    const std::size_t endIndex = (bitIndex + m_BitsPerBlock - 1) / 64;
+    const std::size_t startSubIndex = bitIndex % 64;
+    const u64 maxValue = (1ULL << m_BitsPerBlock) - 1;
 
-    if (startIndex == endIndex) {
-        value = (u32)((m_Data[startIndex] >> startSubIndex) & maxValue);
-    } else {
-        const s32 endSubIndex = 64 - startSubIndex;
+    if (startIndex == endIndex)
+        return (u32)((m_Data[startIndex] >> startSubIndex) & maxValue);
 
-        value = (u32)(((m_Data[startIndex] >> startSubIndex) | (m_Data[endIndex] << endSubIndex)) & maxValue);
+    const std::size_t endSubIndex = 64 - startSubIndex;
+
+    return (u32)(((m_Data[startIndex] >> startSubIndex) | (m_Data[endIndex] << endSubIndex)) & maxValue);
+}
+
+void Chunk::SetValue(std::size_t index, u32 value) {
+    const std::size_t bitIndex = index * m_BitsPerBlock;
+    const std::size_t startIndex = bitIndex / 64;
+    const std::size_t endIndex = (bitIndex + m_BitsPerBlock - 1) / 64;
+    const std::size_t startSubIndex = bitIndex % 64;
+    const u64 maxValue = (1ULL << m_BitsPerBlock) - 1;
+    const u64 data = value & maxValue;
+
+    // Erase old value in data entry and OR with new data
+    m_Data[startIndex] = (m_Data[startIndex] & ~(maxValue << startSubIndex)) | (data << startSubIndex);
+
+    if (startIndex != endIndex) {
+        // The bits that didn't fit in the first entry go at the start of the next one.
+        const std::size_t endSubIndex = 64 - startSubIndex;
+
+        m_Data[endIndex] = (m_Data[endIndex] & ~(maxValue >> endSubIndex)) | (data >> endSubIndex);
+    }
+}
+
+void Chunk::IndexPaletteEntry(std::size_t paletteIndex) {
+    const std::size_t mask = m_PaletteIndex.size() - 1;
+    const u32 blockData = m_Palette[paletteIndex];
+
+    for (std::size_t slot = HashPaletteValue(blockData) & mask;; slot = (slot + 1) & mask) {
+        u16 entry = m_PaletteIndex[slot];
+
+        if (entry == 0) {
+            m_PaletteIndex[slot] = (u16)(paletteIndex + 1);
+            return;
+        }
+
+        // Keep the first index if the palette has duplicates.
+        if (m_Palette[entry - 1] == blockData) return;
+    }
+}
+
+s32 Chunk::FindPaletteEntry(u32 blockData) {
+    if (m_PaletteIndex.empty()) {
+        // Twice the largest palette for these bits keeps the probe sequences short.
+        m_PaletteIndex.assign((std::size_t)2 << m_BitsPerBlock, 0);
+
+        for (std::size_t i = 0; i < m_Palette.size(); ++i)
+            IndexPaletteEntry(i);
+    }
+
+    const std::size_t mask = m_PaletteIndex.size() - 1;
+
+    for (std::size_t slot = HashPaletteValue(blockData) & mask;; slot = (slot + 1) & mask) {
+        u16 entry = m_PaletteIndex[slot];
+
+        if (entry == 0) return -1;
+        if (m_Palette[entry - 1] == blockData) return entry - 1;
     }
+}
+
+u32 Chunk::AddPaletteEntry(u32 blockData, u8 directBits) {
+    if (m_Palette.size() >= ((std::size_t)1 << m_BitsPerBlock))
+        Compact();
+
+    // Compacting can shrink the bits per block too, so the palette can still be full.
+    if (m_Palette.size() >= ((std::size_t)1 << m_BitsPerBlock)) {
+        if (m_BitsPerBlock < MaxPaletteBits) {
+            std::vector<u32> identity(m_Palette.size());
+            for (std::size_t i = 0; i < identity.size(); ++i)
+                identity[i] = (u32)i;
+
+            Repack(m_BitsPerBlock + 1, identity);
+        } else {
+            // Out of palette bits, so switch to the global palette.
+            std::vector<u32> palette;
+            palette.swap(m_Palette);
+
+            Repack(directBits, palette);
+            return blockData;
+        }
+    }
+
+    m_Palette.push_back(blockData);
 
-    const u16 blockType = m_BitsPerBlock < 9 ? m_Palette[value] : value;
+    if (!m_PaletteIndex.empty())
+        IndexPaletteEntry(m_Palette.size() - 1);
 
-    return block::BlockRegistry::GetInstance()->GetBlock(blockType);
+    return (u32)(m_Palette.size() - 1);
 }
 
-void Chunk::SetBlock(Vector3i chunkPosition, block::BlockPtr block) {
-    std::size_t index = (std::size_t)(chunkPosition.y * 16 * 16 + chunkPosition.z * 16 + chunkPosition.x);
-    s32 bitIndex = index * m_BitsPerBlock;
-    s32 startIndex = bitIndex / 64;
-    s32 endIndex = (((index + 1) * m_BitsPerBlock) - 1) / 64;
-    s32 startSubIndex = bitIndex % 64;
+void Chunk::Repack(u8 bitsPerBlock, const std::vector<u32>& remap) {
+    std::vector<u32> values(BlocksPerChunk);
 
-    s64 maxValue = (1 << m_BitsPerBlock) - 1;
-    u32 blockType = block->GetType();
+    for (std::size_t i = 0; i < BlocksPerChunk; ++i) {
+        u32 value = GetValue(i);
 
-    if (m_BitsPerBlock == 0) {
-        m_BitsPerBlock = 4;
+        values[i] = value < remap.size() ? remap[value] : 0;
     }
 
+    m_BitsPerBlock = bitsPerBlock;
+    m_Data.assign(BlocksPerChunk * bitsPerBlock / 64, 0);
+    m_PaletteIndex.clear();
+
+    for (std::size_t i = 0; i < BlocksPerChunk; ++i)
+        SetValue(i, values[i]);
+}
+
+void Chunk::Widen(u8 bitsPerBlock) {
+    // Direct values stay the same, the remap only has to cover the old bits.
+    std::vector<u32> identity((std::size_t)1 << m_BitsPerBlock);
+    for (std::size_t i = 0; i < identity.size(); ++i)
+        identity[i] = (u32)i;
+
+    Repack(bitsPerBlock, identity);
+}
+
+u8 Chunk::GetDirectBits(const block::BlockRegistry* registry) {
+    if (!registry)
+        registry = block::BlockRegistry::GetInstance();
+
+    u8 bits = GlobalPaletteBits;
+    while (((std::size_t)1 << bits) < registry->GetStateCount())
+        ++bits;
+
+    return bits;
+}
+
+bool Chunk::Compact() {
+    if (IsDirect() || m_Data.empty()) return false;
+
+    std::vector<u8> used(m_Palette.size(), 0);
+
+    for (std::size_t i = 0; i < BlocksPerChunk; ++i) {
+        u32 value = GetValue(i);
+
+        if (value < used.size())
+            used[value] = 1;
+    }
+
+    if (std::find(used.begin(), used.end(), 0) == used.end()) return false;
+
+    std::vector<u32> palette;
+    std::vector<u32> remap(m_Palette.size(), 0);
+
+    for (std::size_t i = 0; i < m_Palette.size(); ++i) {
+        if (!used[i]) continue;
+
+        remap[i] = (u32)palette.size();
+        palette.push_back(m_Palette[i]);
+    }
+
+    u8 bitsPerBlock = MinBitsPerBlock;
+    while (((std::size_t)1 << bitsPerBlock) < palette.size())
+        ++bitsPerBlock;
+
+    m_Palette.swap(palette);
+    Repack(bitsPerBlock, remap);
+
+    return true;
+}
+
+u32 Chunk::GetBlockData(Vector3i chunkPosition) const {
+    if (chunkPosition.x < 0 || chunkPosition.x > 15 || chunkPosition.y < 0 || chunkPosition.y > 15 || chunkPosition.z < 0 || chunkPosition.z > 15 || m_Data.empty()) {
+        return 0;
+    }
+
+    const std::size_t index = (std::size_t)(chunkPosition.y * 16 * 16 + chunkPosition.z * 16 + chunkPosition.x);
+    const u32 value = GetValue(index);
+
+    if (IsDirect())
+        return value;
+
+    return value < m_Palette.size() ? m_Palette[value] : 0;
+}
+
+block::BlockPtr Chunk::GetBlock(Vector3i chunkPosition, const block::BlockRegistry* registry) const {
+    return registry->GetBlock(GetBlockData(chunkPosition));
+}
+
+void Chunk::MapBlocks(const std::function<u8(u32)>& map, std::array<u8, BlocksPerChunk>& out) const {
+    const u8 air = map(0);
+
     if (m_Data.empty()) {
-        m_Palette.push_back(0);
-        u32 size = (16 * 16 * 16) * m_BitsPerBlock / 64;
+        out.fill(air);
+        return;
+    }
+
+    if (IsDirect()) {
+        u32 previous = 0;
+        u8 mapped = air;
+
+        // Neighbors are usually the same block, so only map when it changes.
+        for (std::size_t i = 0; i < BlocksPerChunk; ++i) {
+            u32 value = GetValue(i);
 
-        m_Data.resize(size);
-        memset(&m_Data[0], 0, size * sizeof(m_Data[0]));
+            if (value != previous) {
+                previous = value;
+                mapped = map(value);
+            }
+
+            out[i] = mapped;
+        }
+        return;
     }
 
-    auto iter = std::find_if(m_Palette.begin(), m_Palette.end(), [blockType](u32 ptype) {
-        return ptype == blockType;
-    });
+    std::vector<u8> palette(m_Palette.size());
+    for (std::size_t i = 0; i < m_Palette.size(); ++i)
+        palette[i] = map(m_Palette[i]);
 
-    if (iter == m_Palette.end())
-        iter = m_Palette.insert(m_Palette.end(), blockType);
+    for (std::size_t i = 0; i < BlocksPerChunk; ++i) {
+        u32 value = GetValue(i);
+        out[i] = value < palette.size() ? palette[value] : air;
+    }
+}
 
-    s32 value = std::distance(m_Palette.begin(), iter);
+bool Chunk::MayContain(const BlockTypeSet& states) const {
+    if (m_Data.empty()) return states.Contains(0);
+    if (IsDirect()) return true;
 
-    // Erase old value in data entry and OR with new data
-    m_Data[startIndex] = (m_Data[startIndex] & ~(maxValue << startSubIndex)) | (((s64)value & maxValue) << startSubIndex);
+    for (u32 data : m_Palette) {
+        if (states.Contains(data))
+            return true;
+    }
 
-    if (startIndex != endIndex) {
-        s32 endSubIndex = 64 - startSubIndex;
+    return false;
+}
+
+void Chunk::SetBlock(Vector3i chunkPosition, block::BlockPtr block, const block::BlockRegistry* registry) {
+    const std::size_t index = (std::size_t)(chunkPosition.y * 16 * 16 + chunkPosition.z * 16 + chunkPosition.x);
+    const u32 blockType = block->GetType();
+
+    if (m_BitsPerBlock < MinBitsPerBlock)
+        m_BitsPerBlock = MinBitsPerBlock;
 
-        // Erase beginning of data and then OR with new data
-        m_Data[endIndex] = (m_Data[endIndex] >> endSubIndex << endSubIndex) | ((s64)value & maxValue) >> endSubIndex;
+    if (m_Data.empty()) {
+        // An empty section is all air.
+        m_Palette.assign(1, 0);
+        m_PaletteIndex.clear();
+        m_Data.assign(BlocksPerChunk * m_BitsPerBlock / 64, 0);
     }
+
+    if (IsDirect()) {
+        // Loaded with fewer bits than the registry needs, or the block is from a larger registry.
+        if (blockType >> m_BitsPerBlock)
+            Widen(FitBits(std::max(GetDirectBits(registry), m_BitsPerBlock), blockType));
+
+        SetValue(index, blockType);
+        return;
+    }
+
+    s32 value = FindPaletteEntry(blockType);
+
+    if (value < 0) {
+        value = (s32)AddPaletteEntry(blockType, FitBits(GetDirectBits(registry), blockType));
+
+        // Adding the entry might have switched to direct mode.
+        if (IsDirect()) {
+            SetValue(index, blockType);
+            return;
+        }
+    }
+
+    SetValue(index, (u32)value);
 }
 
-ChunkColumn::ChunkColumn(ChunkColumnMetadata metadata)
-    : m_Metadata(metadata)
+ChunkColumn::ChunkColumn(ChunkColumnMetadata metadata, const block::BlockRegistry* registry)
+    : m_Metadata(metadata),
+      m_Registry(registry ? registry : block::BlockRegistry::GetInstance()),
+      m_HeightmapFlags(GetHeightmapFlagTable(m_Registry))
 {
     for (std::size_t i = 0; i < m_Chunks.size(); ++i)
         m_Chunks[i] = nullptr;
+
+    for (auto& heightmap : m_Heightmaps)
+        heightmap.fill(0);
 }
 
-block::BlockPtr ChunkColumn::GetBlock(Vector3i position) {
+void ChunkColumn::SetRegistry(const block::BlockRegistry* registry) {
+    m_Registry = registry ? registry : block::BlockRegistry::GetInstance();
+    m_HeightmapFlags = GetHeightmapFlagTable(m_Registry);
+    ComputeHeightmaps();
+}
+
+void ChunkColumn::ComputeHeightmaps() {
+    if (m_HeightmapFlags->size() != m_Registry->GetStateCount())
+        m_HeightmapFlags = GetHeightmapFlagTable(m_Registry);
+
+    const std::vector<u8>& table = *m_HeightmapFlags;
+    const u8 all = (1 << m_Heightmaps.size()) - 1;
+
+    // Heightmaps still looking for their highest block, per x, z
+    std::array<u8, 16 * 16> unresolved;
+    std::size_t remaining = unresolved.size();
+    std::array<u8, BlocksPerChunk> flags;
+
+    unresolved.fill(all);
+
+    for (auto& heightmap : m_Heightmaps)
+        heightmap.fill(0);
+
+    for (s32 section = ChunksPerColumn - 1; section >= 0 && remaining > 0; --section) {
+        if (!m_Chunks[section]) continue;
+
+        m_Chunks[section]->MapBlocks([&table](u32 data) { return GetHeightmapFlags(table, data); }, flags);
+
+        for (std::size_t xz = 0; xz < unresolved.size(); ++xz) {
+            if (!unresolved[xz]) continue;
+
+            for (s32 y = 15; y >= 0; --y) {
+                u8 found = flags[(y << 8) | xz] & unresolved[xz];
+                if (!found) continue;
+
+                for (std::size_t type = 0; type < m_Heightmaps.size(); ++type) {
+                    if (found & (1 << type))
+                        m_Heightmaps[type][xz] = (u16)(section * 16 + y + 1);
+                }
+
+                unresolved[xz] &= ~found;
+
+                if (!unresolved[xz]) {
+                    --remaining;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+void ChunkColumn::UpdateHeightmaps(Vector3i position, u32 blockData) {
+    if (position.y < 0 || position.y > 255) return;
+
+    const std::size_t xz = (std::size_t)((position.z << 4) | position.x);
+    const u16 height = (u16)(position.y + 1);
+    if (m_HeightmapFlags->size() != m_Registry->GetStateCount())
+        m_HeightmapFlags = GetHeightmapFlagTable(m_Registry);
+
+    const std::vector<u8>& table = *m_HeightmapFlags;
+    const u8 flags = GetHeightmapFlags(table, blockData);
+
+    for (std::size_t type = 0; type < m_Heightmaps.size(); ++type) {
+        u16& current = m_Heightmaps[type][xz];
+
+        if (flags & (1 << type)) {
+            current = std::max(current, height);
+            continue;
+        }
+
+        if (current != height) continue;
+
+        // The highest block was removed, look down for the next one.
+        current = 0;
+
+        for (s32 y = (s32)position.y - 1; y >= 0; --y) {
+            const ChunkPtr& section = m_Chunks[y / 16];
+
+            if (!section) {
+                y -= y % 16;
+                continue;
+            }
+
+            if (GetHeightmapFlags(table, section->GetBlockData(Vector3i(position.x, y % 16, position.z))) & (1 << type)) {
+                current = (u16)(y + 1);
+                break;
+            }
+        }
+    }
+}
+
+block::BlockPtr ChunkColumn::GetBlock(Vector3i position) const {
     s32 chunkIndex = (s32)(position.y / 16);
     Vector3i relativePosition(position.x, position.y % 16, position.z);
 
-    if (chunkIndex < 0 || chunkIndex > 15 || !m_Chunks[chunkIndex]) return block::BlockRegistry::GetInstance()->GetBlock(0);
+    if (chunkIndex < 0 || chunkIndex > 15 || !m_Chunks[chunkIndex]) return m_Registry->GetBlock(0);
 
-    return m_Chunks[chunkIndex]->GetBlock(relativePosition);
+    return m_Registry->GetBlock(m_Chunks[chunkIndex]->GetBlockData(relativePosition));
 }
 
-block::BlockEntityPtr ChunkColumn::GetBlockEntity(Vector3i worldPos) {
+block::BlockEntityPtr ChunkColumn::GetBlockEntity(Vector3i worldPos) const {
     auto iter = m_BlockEntities.find(worldPos);
     if (iter == m_BlockEntities.end()) return nullptr;
     return iter->second;
 }
 
-std::vector<block::BlockEntityPtr> ChunkColumn::GetBlockEntities() {
+std::vector<block::BlockEntityPtr> ChunkColumn::GetBlockEntities() const {
     std::vector<block::BlockEntityPtr> blockEntities;
 
     for (auto iter = m_BlockEntities.begin(); iter != m_BlockEntities.end(); ++iter)
@@ -159,6 +586,40 @@ std::vector<block::BlockEntityPtr> ChunkColumn::GetBlockEntities() {
     return blockEntities;
 }
 
+std::size_t ChunkColumn::GetMemoryUsage() const {
+    std::size_t usage = sizeof(ChunkColumn);
+
+    for (const ChunkPtr& chunk : m_Chunks) {
+        if (chunk)
+            usage += chunk->GetMemoryUsage();
+    }
+
+    return usage;
+}
+
+void ChunkColumn::Load(DataBuffer& in) {
+    in >> *this;
+
+    // Skip biome information
+    if (m_Metadata.continuous)
+        in.SetReadOffset(in.GetReadOffset() + 256);
+
+    VarInt entities;
+    in >> entities;
+
+    for (s32 i = 0; i < entities.GetInt(); ++i) {
+        nbt::NBT nbt;
+
+        in >> nbt;
+
+        block::BlockEntityPtr blockEntity = block::BlockEntity::CreateFromNBT(&nbt);
+
+        if (blockEntity == nullptr) continue;
+
+        AddBlockEntity(blockEntity);
+    }
+}
+
 DataBuffer& operator>>(DataBuffer& in, ChunkColumn& column) {
     ChunkColumnMetadata* meta = &column.m_Metadata;
 
@@ -174,6 +635,7 @@ DataBuffer& operator>>(DataBuffer& in, ChunkColumn& column) {
         }
     }
 
+    column.ComputeHeightmaps();
     return in;
 }
 
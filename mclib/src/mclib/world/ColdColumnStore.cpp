@@ -0,0 +1,192 @@
+#include <mclib/world/ColdColumnStore.h>
+
+#include <mclib/common/DataBuffer.h>
+
+#include <stdexcept>
+#include <zlib.h>
+
+namespace mc {
+namespace world {
+
+ColdColumnStore::ColdColumnStore(std::size_t cacheBudget)
+    : m_CacheBudget(cacheBudget),
+      m_CacheBytes(0),
+      m_CompressedBytes(0),
+      m_Hits(0),
+      m_Misses(0)
+{
+
+}
+
+void ColdColumnStore::Store(const ColumnCoord& coord, const ChunkColumn& column) {
+    Remove(coord);
+
+    ColdColumn cold;
+    DataBuffer raw;
+
+    cold.metadata = column.GetMetadata();
+    cold.registry = column.GetRegistry();
+    cold.sectionMask = 0;
+
+    for (std::size_t i = 0; i < ChunkColumn::ChunksPerColumn; ++i) {
+        if (!column[i]) continue;
+
+        cold.sectionMask |= 1 << i;
+        column[i]->Serialize(raw);
+    }
+
+    cold.rawSize = raw.GetSize();
+
+    if (cold.rawSize > 0) {
+        uLongf size = compressBound((uLong)cold.rawSize);
+
+        cold.data.resize(size);
+
+        if (compress2(&cold.data[0], &size, (const Bytef*)&raw[0], (uLong)cold.rawSize, Z_BEST_SPEED) != Z_OK)
+            throw std::runtime_error("Failed to compress chunk column.");
+
+        cold.data.resize(size);
+        cold.data.shrink_to_fit();
+    }
+
+    cold.blockEntities = column.GetBlockEntities();
+
+    m_CompressedBytes += cold.data.size();
+    m_Columns.emplace(coord, std::move(cold));
+}
+
+ChunkColumnPtr ColdColumnStore::Decompress(const ColdColumn& cold) const {
+    auto column = std::make_shared<ChunkColumn>(cold.metadata, cold.registry);
+
+    if (cold.rawSize > 0) {
+        std::string raw;
+        uLongf size = (uLongf)cold.rawSize;
+
+        raw.resize(cold.rawSize);
+
+        if (uncompress((Bytef*)&raw[0], &size, cold.data.data(), (uLong)cold.data.size()) != Z_OK || size != cold.rawSize)
+            throw std::runtime_error("Failed to decompress chunk column.");
+
+        DataBuffer buffer(raw);
+
+        for (std::size_t i = 0; i < ChunkColumn::ChunksPerColumn; ++i) {
+            if (!(cold.sectionMask & (1 << i))) continue;
+
+            auto chunk = std::make_shared<Chunk>();
+            chunk->Deserialize(buffer);
+            (*column)[i] = chunk;
+        }
+    }
+
+    column->ComputeHeightmaps();
+
+    for (const auto& blockEntity : cold.blockEntities)
+        column->AddBlockEntity(blockEntity);
+
+    return column;
+}
+
+ChunkColumnPtr ColdColumnStore::Get(const ColumnCoord& coord) {
+    auto cached = m_CacheIndex.find(coord);
+
+    if (cached != m_CacheIndex.end()) {
+        ++m_Hits;
+        m_Cache.splice(m_Cache.begin(), m_Cache, cached->second);
+        return cached->second->second;
+    }
+
+    auto iter = m_Columns.find(coord);
+    if (iter == m_Columns.end()) return nullptr;
+
+    ++m_Misses;
+
+    ChunkColumnPtr column = Decompress(iter->second);
+
+    m_Cache.emplace_front(coord, column);
+    m_CacheIndex[coord] = m_Cache.begin();
+    m_CacheBytes += column->GetMemoryUsage();
+
+    TrimCache();
+
+    return column;
+}
+
+ChunkColumnPtr ColdColumnStore::Read(const ColumnCoord& coord) const {
+    auto cached = m_CacheIndex.find(coord);
+    if (cached != m_CacheIndex.end()) return cached->second->second;
+
+    auto iter = m_Columns.find(coord);
+    if (iter == m_Columns.end()) return nullptr;
+
+    return Decompress(iter->second);
+}
+
+ChunkColumnPtr ColdColumnStore::Take(const ColumnCoord& coord) {
+    auto iter = m_Columns.find(coord);
+    if (iter == m_Columns.end()) return nullptr;
+
+    // The cached copy is only for reading, so always start from the stored data.
+    ChunkColumnPtr column = Decompress(iter->second);
+
+    Remove(coord);
+
+    return column;
+}
+
+void ColdColumnStore::EvictCached(const ColumnCoord& coord) {
+    auto cached = m_CacheIndex.find(coord);
+    if (cached == m_CacheIndex.end()) return;
+
+    m_CacheBytes -= cached->second->second->GetMemoryUsage();
+    m_Cache.erase(cached->second);
+    m_CacheIndex.erase(cached);
+}
+
+void ColdColumnStore::TrimCache() {
+    // The most recent column stays even when it's over budget by itself, so reading it again doesn't decompress it again.
+    while (m_CacheBytes > m_CacheBudget && m_Cache.size() > 1)
+        EvictCached(m_Cache.back().first);
+}
+
+void ColdColumnStore::Remove(const ColumnCoord& coord) {
+    EvictCached(coord);
+
+    auto iter = m_Columns.find(coord);
+    if (iter == m_Columns.end()) return;
+
+    m_CompressedBytes -= iter->second.data.size();
+    m_Columns.erase(iter);
+}
+
+void ColdColumnStore::Clear() {
+    m_Columns.clear();
+    m_Cache.clear();
+    m_CacheIndex.clear();
+    m_CacheBytes = 0;
+    m_CompressedBytes = 0;
+}
+
+std::vector<block::BlockEntityPtr> ColdColumnStore::GetBlockEntities() const {
+    std::vector<block::BlockEntityPtr> blockEntities;
+
+    for (const auto& entry : m_Columns)
+        blockEntities.insert(blockEntities.end(), entry.second.blockEntities.begin(), entry.second.blockEntities.end());
+
+    return blockEntities;
+}
+
+ColdColumnStats ColdColumnStore::GetStats() const {
+    ColdColumnStats stats;
+
+    stats.columns = m_Columns.size();
+    stats.compressedBytes = m_CompressedBytes;
+    stats.cachedColumns = m_Cache.size();
+    stats.cachedBytes = m_CacheBytes;
+    stats.hits = m_Hits;
+    stats.misses = m_Misses;
+
+    return stats;
+}
+
+} // ns world
+} // ns mc
@@ -0,0 +1,203 @@
+#include <mclib/world/Collision.h>
+
+#include <mclib/world/World.h>
+
+#include <cmath>
+#include <map>
+#include <mutex>
+
+namespace mc {
+namespace world {
+
+namespace {
+
+// How far other can move along the axis before hitting box. Vanilla's AxisAlignedBB::calculateXOffset and friends.
+double ClipAxis(const AABB& box, const AABB& other, double offset, std::size_t axis) {
+    std::size_t a = (axis + 1) % 3;
+    std::size_t b = (axis + 2) % 3;
+
+    if (other.max[a] <= box.min[a] || other.min[a] >= box.max[a]) return offset;
+    if (other.max[b] <= box.min[b] || other.min[b] >= box.max[b]) return offset;
+
+    if (offset > 0.0 && other.max[axis] <= box.min[axis]) {
+        double distance = box.min[axis] - other.max[axis];
+
+        if (distance < offset)
+            offset = distance;
+    } else if (offset < 0.0 && other.min[axis] >= box.max[axis]) {
+        double distance = box.max[axis] - other.min[axis];
+
+        if (distance > offset)
+            offset = distance;
+    }
+
+    return offset;
+}
+
+AABB Expand(const AABB& box, const Vector3d& motion) {
+    AABB result = box;
+
+    for (std::size_t i = 0; i < 3; ++i) {
+        if (motion[i] < 0)
+            result.min[i] += motion[i];
+        else
+            result.max[i] += motion[i];
+    }
+
+    return result;
+}
+
+} // ns
+
+CollisionShapes::CollisionShapes(const block::BlockRegistry& registry) {
+    m_Ranges.resize(registry.GetStateCount());
+
+    for (u32 data = 0; data < m_Ranges.size(); ++data) {
+        u32 first = (u32)m_Boxes.size();
+        block::BlockPtr block = registry.GetBlock(data);
+
+        if (block && block->IsSolid()) {
+            for (const AABB& bounds : block->GetBoundingBoxes()) {
+                if (bounds.min != bounds.max)
+                    m_Boxes.push_back(bounds);
+            }
+        }
+
+        m_Ranges[data] = std::make_pair(first, (u32)m_Boxes.size());
+    }
+}
+
+std::shared_ptr<const CollisionShapes> CollisionShapes::Get(const block::BlockRegistry* registry) {
+    static std::mutex mutex;
+    static std::map<const block::BlockRegistry*, std::shared_ptr<const CollisionShapes>> shapes;
+
+    if (!registry)
+        registry = block::BlockRegistry::GetInstance();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& result = shapes[registry];
+
+    if (!result || result->GetStateCount() != registry->GetStateCount())
+        result = std::make_shared<const CollisionShapes>(*registry);
+
+    return result;
+}
+
+Collider::Collider(const World& world)
+    : m_World(world)
+{
+
+}
+
+const std::vector<AABB>& Collider::GetCollisionBoxes(const AABB& area) {
+    const block::BlockRegistry* registry = m_World.GetRegistry();
+
+    if (!m_Shapes || m_Shapes->GetStateCount() != registry->GetStateCount())
+        m_Shapes = CollisionShapes::Get(registry);
+
+    m_Boxes.clear();
+
+    s64 minX = (s64)std::floor(area.min.x);
+    s64 maxX = (s64)std::floor(area.max.x);
+    s64 minZ = (s64)std::floor(area.min.z);
+    s64 maxZ = (s64)std::floor(area.max.z);
+    // Fences and walls stick out into the block above them.
+    s64 minY = std::max<s64>((s64)std::floor(area.min.y) - 1, 0);
+    s64 maxY = std::min<s64>((s64)std::floor(area.max.y), 255);
+
+    if (minY > maxY) return m_Boxes;
+
+    for (s64 columnX = minX >> 4; columnX <= maxX >> 4; ++columnX) {
+        for (s64 columnZ = minZ >> 4; columnZ <= maxZ >> 4; ++columnZ) {
+            ConstChunkColumnPtr column = m_World.GetChunk(Vector3i(columnX * 16, 0, columnZ * 16));
+            if (!column) continue;
+
+            s64 startX = std::max(minX, columnX * 16);
+            s64 endX = std::min(maxX, columnX * 16 + 15);
+            s64 startZ = std::max(minZ, columnZ * 16);
+            s64 endZ = std::min(maxZ, columnZ * 16 + 15);
+
+            for (s64 y = minY; y <= maxY; ++y) {
+                const ChunkPtr& section = (*column)[(std::size_t)(y >> 4)];
+                if (!section) continue;
+
+                for (s64 x = startX; x <= endX; ++x) {
+                    for (s64 z = startZ; z <= endZ; ++z) {
+                        u32 data = section->GetBlockData(Vector3i(x & 15, y & 15, z & 15));
+                        const AABB* end = m_Shapes->end(data);
+                        Vector3d offset((double)x, (double)y, (double)z);
+
+                        for (const AABB* bounds = m_Shapes->begin(data); bounds != end; ++bounds) {
+                            AABB box(bounds->min + offset, bounds->max + offset);
+
+                            if (box.Intersects(area))
+                                m_Boxes.push_back(box);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    return m_Boxes;
+}
+
+Vector3d Collider::Clip(AABB& box, Vector3d motion, const AABB* begin, const AABB* end) noexcept {
+    static const std::size_t Order[] = { 1, 0, 2 };
+
+    for (std::size_t axis : Order) {
+        if (motion[axis] == 0.0) continue;
+
+        for (const AABB* other = begin; other != end; ++other)
+            motion[axis] = ClipAxis(*other, box, motion[axis], axis);
+
+        box.min[axis] += motion[axis];
+        box.max[axis] += motion[axis];
+    }
+
+    return motion;
+}
+
+MoveResult Collider::Move(const AABB& box, Vector3d motion, bool onGround, double stepHeight) {
+    AABB area = Expand(box, motion);
+    area.max.y += stepHeight;
+
+    GetCollisionBoxes(area);
+
+    return MoveAgainst(box, motion, m_Boxes.data(), m_Boxes.data() + m_Boxes.size(), onGround, stepHeight);
+}
+
+MoveResult Collider::MoveAgainst(const AABB& box, Vector3d motion, const AABB* begin, const AABB* end, bool onGround, double stepHeight) {
+    MoveResult result;
+
+    AABB moved = box;
+    result.motion = Clip(moved, motion, begin, end);
+
+    result.collidedHorizontally = result.motion.x != motion.x || result.motion.z != motion.z;
+    result.collidedVertically = result.motion.y != motion.y;
+    result.onGround = result.collidedVertically && motion.y < 0;
+
+    if (stepHeight > 0.0 && result.collidedHorizontally && (onGround || result.onGround)) {
+        // Move up, across and back down, and keep it if that got further than sliding along the wall.
+        AABB stepped = box;
+        Vector3d stepMotion = Clip(stepped, Vector3d(motion.x, stepHeight, motion.z), begin, end);
+        Vector3d down = Clip(stepped, Vector3d(0, -stepMotion.y, 0), begin, end);
+
+        stepMotion.y += down.y;
+
+        double steppedDistance = stepMotion.x * stepMotion.x + stepMotion.z * stepMotion.z;
+        double slidDistance = result.motion.x * result.motion.x + result.motion.z * result.motion.z;
+
+        if (steppedDistance > slidDistance) {
+            result.motion = stepMotion;
+            result.collidedHorizontally = stepMotion.x != motion.x || stepMotion.z != motion.z;
+            result.collidedVertically = true;
+            result.onGround = true;
+        }
+    }
+
+    return result;
+}
+
+} // ns world
+} // ns mc
@@ -0,0 +1,290 @@
+#include <mclib/world/IncrementalPathfinder.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+
+namespace mc {
+namespace world {
+
+namespace {
+
+const double Infinity = std::numeric_limits<double>::infinity();
+// Keys are rounded to this fraction of a block, so costs that add up the same moves in a different order still tie.
+const double KeyScale = 1048576.0;
+
+} // ns
+
+IncrementalPathfinder::IncrementalPathfinder(Pathfinder& pathfinder)
+    : m_Pathfinder(pathfinder),
+      m_HasGoal(false),
+      m_KeyModifier(0.0),
+      m_GridVersion(0)
+{
+
+}
+
+void IncrementalPathfinder::SetGoal(const Vector3i& goal) {
+    if (m_HasGoal && goal == m_Goal) return;
+
+    m_Goal = goal;
+    m_HasGoal = true;
+    m_Nodes.clear();
+    m_Open.clear();
+}
+
+IncrementalPathfinder::Node& IncrementalPathfinder::GetNode(const Vector3i& position) {
+    auto result = m_Nodes.emplace(Pathfinder::GetKey(position), Node());
+    Node& node = result.first->second;
+
+    if (result.second) {
+        node.position = position;
+        node.g = Infinity;
+        node.rhs = Infinity;
+        node.open = false;
+
+        // A change can affect moves that start one block away from it and end a block further.
+        for (std::size_t i = 0; i < 3; ++i) {
+            m_Min[i] = std::min(m_Min[i], position[i] - 2);
+            m_Max[i] = std::max(m_Max[i], position[i] + 2);
+        }
+    }
+
+    return node;
+}
+
+double IncrementalPathfinder::GetCost(const Vector3i& position) const {
+    auto iter = m_Nodes.find(Pathfinder::GetKey(position));
+
+    return iter != m_Nodes.end() ? iter->second.g : Infinity;
+}
+
+IncrementalPathfinder::Key IncrementalPathfinder::CalculateKey(const Node& node) const {
+    double cost = std::min(node.g, node.rhs);
+
+    double estimate = cost + Pathfinder::EstimateCost(m_Start, node.position) + m_KeyModifier;
+
+    return Key(std::round(estimate * KeyScale) / KeyScale, cost);
+}
+
+void IncrementalPathfinder::Reset(const Vector3i& start) {
+    m_Nodes.clear();
+    m_Open.clear();
+    m_KeyModifier = 0.0;
+    m_GridVersion = m_Pathfinder.GetGrid().GetVersion();
+    m_Start = start;
+    m_Min = m_Max = m_Goal;
+
+    Node& goal = GetNode(m_Goal);
+
+    goal.rhs = 0.0;
+    UpdateVertex(goal);
+}
+
+void IncrementalPathfinder::UpdateVertex(Node& node) {
+    if (node.position != m_Goal) {
+        node.rhs = Infinity;
+
+        if (m_Pathfinder.GetGrid().IsStandable(node.position)) {
+            m_Successors.clear();
+            m_Pathfinder.GetNeighbors(node.position, m_Successors);
+
+            for (const PathEdge& edge : m_Successors)
+                node.rhs = std::min(node.rhs, edge.cost + GetCost(edge.to));
+        }
+    }
+
+    if (node.g != node.rhs) {
+        node.key = CalculateKey(node);
+        node.open = true;
+
+        m_Open.emplace_back(node.key, Pathfinder::GetKey(node.position));
+        std::push_heap(m_Open.begin(), m_Open.end(), std::greater<OpenEntry>());
+    } else {
+        node.open = false;
+    }
+}
+
+bool IncrementalPathfinder::ApplyChanges(bool* changed) {
+    NavigationGrid& grid = m_Pathfinder.GetGrid();
+    const u64 version = grid.GetVersion();
+
+    *changed = false;
+
+    if (version == m_GridVersion) return true;
+
+    m_Changes.clear();
+    if (!grid.GetChangesSince(m_GridVersion, m_Changes)) return false;
+
+    m_GridVersion = version;
+
+    const s64 maxDrop = m_Pathfinder.GetMaxDrop();
+
+    for (const NavigationChange& change : m_Changes) {
+        const Vector3i& position = change.position;
+
+        if (change.column) {
+            bool overlaps = position.x <= m_Max.x && position.x + 15 >= m_Min.x && position.z <= m_Max.z && position.z + 15 >= m_Min.z;
+
+            if (overlaps) return false;
+            continue;
+        }
+
+        if (position.x < m_Min.x || position.x > m_Max.x || position.z < m_Min.z || position.z > m_Max.z) continue;
+
+        // Every move reads blocks within one block of where it starts, from a drop below it to a jump above it.
+        for (s64 x = position.x - 1; x <= position.x + 1; ++x) {
+            for (s64 z = position.z - 1; z <= position.z + 1; ++z) {
+                for (s64 y = position.y - 2; y <= position.y + maxDrop + 1; ++y) {
+                    Vector3i affected(x, y, z);
+                    auto iter = m_Nodes.find(Pathfinder::GetKey(affected));
+
+                    if (iter != m_Nodes.end()) {
+                        UpdateVertex(iter->second);
+                        *changed = true;
+                    } else if (grid.IsStandable(affected)) {
+                        UpdateVertex(GetNode(affected));
+                        *changed = true;
+                    }
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+std::size_t IncrementalPathfinder::ComputeShortestPath() {
+    std::size_t expanded = 0;
+
+    while (true) {
+        // Skip entries that were superseded by a later UpdateVertex.
+        Node* top = nullptr;
+
+        while (!m_Open.empty()) {
+            auto iter = m_Nodes.find(m_Open.front().second);
+
+            if (iter != m_Nodes.end() && iter->second.open && iter->second.key == m_Open.front().first) {
+                top = &iter->second;
+                break;
+            }
+
+            std::pop_heap(m_Open.begin(), m_Open.end(), std::greater<OpenEntry>());
+            m_Open.pop_back();
+        }
+
+        Node& start = GetNode(m_Start);
+
+        if (!top || (!(top->key < CalculateKey(start)) && start.rhs == start.g)) break;
+        if (expanded >= m_Pathfinder.GetMaxNodes()) break;
+
+        Key oldKey = m_Open.front().first;
+        std::pop_heap(m_Open.begin(), m_Open.end(), std::greater<OpenEntry>());
+        m_Open.pop_back();
+
+        Node& node = *top;
+        Key newKey = CalculateKey(node);
+
+        ++expanded;
+        node.open = false;
+
+        if (oldKey < newKey) {
+            node.key = newKey;
+            node.open = true;
+            m_Open.emplace_back(newKey, Pathfinder::GetKey(node.position));
+            std::push_heap(m_Open.begin(), m_Open.end(), std::greater<OpenEntry>());
+            continue;
+        }
+
+        if (node.g > node.rhs) {
+            node.g = node.rhs;
+        } else {
+            node.g = Infinity;
+            UpdateVertex(node);
+        }
+
+        m_Predecessors.clear();
+        m_Pathfinder.GetPredecessors(node.position, m_Predecessors);
+
+        for (const PathEdge& edge : m_Predecessors)
+            UpdateVertex(GetNode(edge.to));
+    }
+
+    return expanded;
+}
+
+Path IncrementalPathfinder::FindPath(const Vector3i& start) {
+    Path path;
+    Vector3i from = m_Pathfinder.FindStandable(start);
+
+    if (!m_HasGoal) {
+        path.nodes.push_back(from);
+        return path;
+    }
+
+    bool changed = false;
+    bool repair = !m_Nodes.empty();
+
+    if (repair) {
+        if (from != m_Start) {
+            m_KeyModifier += Pathfinder::EstimateCost(m_Start, from);
+            m_Start = from;
+        }
+
+        repair = ApplyChanges(&changed);
+    }
+
+    if (!repair)
+        Reset(from);
+
+    path.expanded = ComputeShortestPath();
+
+    if (!repair) {
+        ++m_Stats.searches;
+        m_Stats.searchExpanded += path.expanded;
+    } else if (changed) {
+        ++m_Stats.repairs;
+        m_Stats.repairExpanded += path.expanded;
+    }
+
+    if (GetNode(from).rhs == Infinity) {
+        // Unreachable, so fall back to a plain search for the closest position.
+        Path closest = m_Pathfinder.FindPath(from, m_Goal);
+
+        closest.expanded += path.expanded;
+        return closest;
+    }
+
+    Vector3i current = from;
+    path.nodes.push_back(current);
+
+    // The costs lead down to the goal, the length limit only guards against a search that was cut short.
+    while (current != m_Goal && path.nodes.size() <= m_Nodes.size()) {
+        double best = Infinity;
+        Vector3i next;
+
+        m_Successors.clear();
+        m_Pathfinder.GetNeighbors(current, m_Successors);
+
+        for (const PathEdge& edge : m_Successors) {
+            double cost = edge.cost + GetCost(edge.to);
+
+            if (cost < best) {
+                best = cost;
+                next = edge.to;
+            }
+        }
+
+        if (best == Infinity) break;
+
+        current = next;
+        path.nodes.push_back(current);
+    }
+
+    path.complete = current == m_Goal;
+    return path;
+}
+
+} // ns world
+} // ns mc
@@ -0,0 +1,185 @@
+#include <mclib/world/NavigationGrid.h>
+
+#include <string>
+
+namespace mc {
+namespace world {
+
+namespace {
+
+const char* const HazardNames[] = {
+    "minecraft:water", "minecraft:flowing_water", "minecraft:lava", "minecraft:flowing_lava",
+    "minecraft:fire", "minecraft:cactus", "minecraft:magma", "minecraft:magma_block",
+    "minecraft:web", "minecraft:cobweb"
+};
+
+} // ns
+
+NavigationGrid::NavigationGrid(World& world)
+    : m_World(world),
+      m_LastKey(0),
+      m_LastSection(nullptr),
+      m_Version(0)
+{
+    m_AirSection.fill(0);
+    m_UnloadedSection.fill(Unloaded);
+
+    UpdateStateFlags();
+    m_World.RegisterListener(this);
+}
+
+NavigationGrid::~NavigationGrid() {
+    m_World.UnregisterListener(this);
+}
+
+void NavigationGrid::UpdateStateFlags() {
+    const block::BlockRegistry* registry = m_World.GetRegistry();
+
+    m_Shapes = CollisionShapes::Get(registry);
+    m_StateFlags.assign(m_Shapes->GetStateCount(), 0);
+
+    for (u32 data = 0; data < m_StateFlags.size(); ++data) {
+        u8 flags = 0;
+
+        for (const AABB* bounds = m_Shapes->begin(data); bounds != m_Shapes->end(data); ++bounds) {
+            flags |= Blocking;
+
+            if (bounds->max.y > 1.0)
+                flags |= Tall;
+        }
+
+        block::BlockPtr block = registry->GetBlock(data);
+
+        if (block) {
+            std::string name = block->GetName();
+
+            for (const char* hazard : HazardNames) {
+                if (name == hazard)
+                    flags |= Hazard;
+            }
+        }
+
+        m_StateFlags[data] = flags;
+    }
+}
+
+const NavigationGrid::Section* NavigationGrid::BuildSection(s64 sectionX, s64 sectionY, s64 sectionZ) {
+    u64 key = GetSectionKey(sectionX, sectionY, sectionZ);
+    // Read through a const World so cold columns stay cold.
+    ConstChunkColumnPtr column = static_cast<const World&>(m_World).GetChunk(Vector3i(sectionX * 16, 0, sectionZ * 16));
+
+    if (!column)
+        return m_Sections[key] = &m_UnloadedSection;
+
+    const ChunkPtr& chunk = (*column)[(std::size_t)sectionY];
+
+    if (!chunk)
+        return m_Sections[key] = &m_AirSection;
+
+    if (m_StateFlags.size() != m_World.GetRegistry()->GetStateCount())
+        UpdateStateFlags();
+
+    Section* section;
+
+    if (!m_Free.empty()) {
+        section = m_Free.back();
+        m_Free.pop_back();
+    } else {
+        m_Owned.emplace_back(new Section());
+        section = m_Owned.back().get();
+    }
+
+    chunk->MapBlocks([this](u32 data) {
+        return data < m_StateFlags.size() ? m_StateFlags[data] : (u8)0;
+    }, *section);
+
+    return m_Sections[key] = section;
+}
+
+void NavigationGrid::Release(std::unordered_map<u64, const Section*>::iterator iter) {
+    if (iter->second != &m_AirSection && iter->second != &m_UnloadedSection)
+        m_Free.push_back(const_cast<Section*>(iter->second));
+
+    m_Sections.erase(iter);
+    m_LastSection = nullptr;
+}
+
+void NavigationGrid::AddChange(const Vector3i& position, bool column) {
+    if (m_Changes.size() >= MaxChanges)
+        m_Changes.pop_front();
+
+    m_Changes.push_back(NavigationChange{ position, column });
+    ++m_Version;
+}
+
+bool NavigationGrid::GetChangesSince(u64 version, std::vector<NavigationChange>& changes) const {
+    if (version > m_Version) return false;
+
+    u64 count = m_Version - version;
+    if (count > m_Changes.size()) return false;
+
+    changes.insert(changes.end(), m_Changes.end() - (std::ptrdiff_t)count, m_Changes.end());
+    return true;
+}
+
+void NavigationGrid::Invalidate(const Vector3i& position) {
+    if (position.y < 0 || position.y > 255) return;
+
+    // Logged even if the section isn't cached, since searches remember what they saw before it was dropped.
+    AddChange(position, false);
+
+    auto iter = m_Sections.find(GetSectionKey(position.x >> 4, position.y >> 4, position.z >> 4));
+
+    if (iter != m_Sections.end())
+        Release(iter);
+}
+
+void NavigationGrid::InvalidateColumn(s32 chunkX, s32 chunkZ) {
+    AddChange(Vector3i((s64)chunkX * 16, 0, (s64)chunkZ * 16), true);
+
+    for (s64 y = 0; y < ChunkColumn::ChunksPerColumn; ++y) {
+        auto iter = m_Sections.find(GetSectionKey(chunkX, y, chunkZ));
+
+        if (iter != m_Sections.end())
+            Release(iter);
+    }
+}
+
+void NavigationGrid::Clear() {
+    m_Sections.clear();
+    m_Free.clear();
+
+    for (auto& section : m_Owned)
+        m_Free.push_back(section.get());
+
+    m_LastSection = nullptr;
+    m_Changes.clear();
+    ++m_Version;
+}
+
+void NavigationGrid::OnChunkLoad(ChunkPtr chunk, const ChunkColumnMetadata& meta, u16 yIndex) {
+    // Every section of the column is announced, so only drop them once.
+    if (yIndex == 0)
+        InvalidateColumn(meta.x, meta.z);
+}
+
+void NavigationGrid::OnChunkUnload(ChunkColumnPtr chunk) {
+    if (!chunk) {
+        Clear();
+        return;
+    }
+
+    InvalidateColumn(chunk->GetMetadata().x, chunk->GetMetadata().z);
+}
+
+void NavigationGrid::OnBlockChange(Vector3i position, block::BlockPtr newBlock, block::BlockPtr oldBlock) {
+    Invalidate(position);
+}
+
+void NavigationGrid::OnBlockChanges(const std::vector<BlockChange>& changes) {
+    for (const BlockChange& change : changes)
+        Invalidate(change.position);
+}
+
+} // ns world
+} // ns mc
@@ -0,0 +1,239 @@
+#include <mclib/world/Pathfinder.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+
+namespace mc {
+namespace world {
+
+namespace {
+
+const s32 Directions[8][2] = {
+    { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 },
+    { 1, 1 }, { 1, -1 }, { -1, 1 }, { -1, -1 }
+};
+
+typedef std::pair<double, u32> OpenEntry;
+
+} // ns
+
+constexpr double Pathfinder::WalkCost;
+constexpr double Pathfinder::DiagonalCost;
+constexpr double Pathfinder::JumpCost;
+constexpr double Pathfinder::DropCost;
+
+Pathfinder::Pathfinder(NavigationGrid& grid)
+    : m_Grid(grid),
+      m_MaxDrop(3),
+      m_MaxNodes(100000)
+{
+
+}
+
+double Pathfinder::EstimateCost(const Vector3i& from, const Vector3i& to) {
+    double dx = (double)std::abs(to.x - from.x);
+    double dz = (double)std::abs(to.z - from.z);
+    double horizontal = std::max(dx, dz) * WalkCost + std::min(dx, dz) * (DiagonalCost - WalkCost);
+    s64 dy = to.y - from.y;
+
+    // Every block up takes a jump and every block down costs at least DropCost.
+    double vertical = dy > 0 ? dy * JumpCost : -dy * DropCost;
+
+    return std::max(horizontal, vertical);
+}
+
+void Pathfinder::GetNeighbors(const Vector3i& from, std::vector<PathEdge>& edges) {
+    const s64 x = from.x;
+    const s64 y = from.y;
+    const s64 z = from.z;
+    const bool canJump = m_Grid.IsPassable(x, y + 2, z);
+
+    for (std::size_t i = 0; i < 4; ++i) {
+        const s64 toX = x + Directions[i][0];
+        const s64 toZ = z + Directions[i][1];
+
+        if (m_Grid.IsStandable(toX, y, toZ)) {
+            edges.push_back(PathEdge{ Vector3i(toX, y, toZ), WalkCost });
+            continue;
+        }
+
+        if (!m_Grid.IsPassable(toX, y + 1, toZ)) continue;
+
+        if (m_Grid.IsPassable(toX, y, toZ)) {
+            // Walk off the edge and fall until landing.
+            for (s32 drop = 1; drop <= m_MaxDrop; ++drop) {
+                if (m_Grid.IsStandable(toX, y - drop, toZ)) {
+                    edges.push_back(PathEdge{ Vector3i(toX, y - drop, toZ), WalkCost + drop * DropCost });
+                    break;
+                }
+
+                if (!m_Grid.IsPassable(toX, y - drop, toZ)) break;
+            }
+        } else if (canJump && m_Grid.IsStandable(toX, y + 1, toZ)) {
+            edges.push_back(PathEdge{ Vector3i(toX, y + 1, toZ), JumpCost });
+        }
+    }
+
+    for (std::size_t i = 4; i < 8; ++i) {
+        const s64 toX = x + Directions[i][0];
+        const s64 toZ = z + Directions[i][1];
+
+        if (!m_Grid.IsStandable(toX, y, toZ)) continue;
+        if (!m_Grid.IsPassable(toX, y, z) || !m_Grid.IsPassable(toX, y + 1, z)) continue;
+        if (!m_Grid.IsPassable(x, y, toZ) || !m_Grid.IsPassable(x, y + 1, toZ)) continue;
+
+        edges.push_back(PathEdge{ Vector3i(toX, y, toZ), DiagonalCost });
+    }
+}
+
+void Pathfinder::GetPredecessors(const Vector3i& to, std::vector<PathEdge>& edges) {
+    for (std::size_t i = 0; i < 8; ++i) {
+        const s64 fromX = to.x - Directions[i][0];
+        const s64 fromZ = to.z - Directions[i][1];
+        // Diagonal moves stay level, the others can also come from a jump below or a drop above.
+        const s64 minY = i < 4 ? to.y - 1 : to.y;
+        const s64 maxY = i < 4 ? to.y + m_MaxDrop : to.y;
+
+        for (s64 y = minY; y <= maxY; ++y) {
+            Vector3i from(fromX, y, fromZ);
+            double cost = GetMoveCost(from, to);
+
+            if (cost != std::numeric_limits<double>::infinity())
+                edges.push_back(PathEdge{ from, cost });
+        }
+    }
+}
+
+double Pathfinder::GetMoveCost(const Vector3i& from, const Vector3i& to) {
+    const double Unreachable = std::numeric_limits<double>::infinity();
+    const s64 dx = to.x - from.x;
+    const s64 dz = to.z - from.z;
+    const s64 dy = to.y - from.y;
+
+    if (dx < -1 || dx > 1 || dz < -1 || dz > 1 || (dx == 0 && dz == 0)) return Unreachable;
+    if (!m_Grid.IsStandable(from) || !m_Grid.IsStandable(to)) return Unreachable;
+
+    if (dx != 0 && dz != 0) {
+        if (dy != 0) return Unreachable;
+        if (!m_Grid.IsPassable(to.x, from.y, from.z) || !m_Grid.IsPassable(to.x, from.y + 1, from.z)) return Unreachable;
+        if (!m_Grid.IsPassable(from.x, from.y, to.z) || !m_Grid.IsPassable(from.x, from.y + 1, to.z)) return Unreachable;
+
+        return DiagonalCost;
+    }
+
+    if (dy == 0) return WalkCost;
+
+    if (m_Grid.IsStandable(to.x, from.y, to.z) || !m_Grid.IsPassable(to.x, from.y + 1, to.z)) return Unreachable;
+
+    if (dy == 1) {
+        if (m_Grid.IsPassable(to.x, from.y, to.z) || !m_Grid.IsPassable(from.x, from.y + 2, from.z)) return Unreachable;
+
+        return JumpCost;
+    }
+
+    if (dy > 0 || -dy > m_MaxDrop) return Unreachable;
+
+    // It has to be the first place to land when falling.
+    for (s64 y = from.y; y > to.y; --y) {
+        if (!m_Grid.IsPassable(to.x, y, to.z)) return Unreachable;
+        if (y != from.y && m_Grid.IsStandable(to.x, y, to.z)) return Unreachable;
+    }
+
+    return WalkCost - dy * DropCost;
+}
+
+Vector3i Pathfinder::FindStandable(const Vector3i& position) {
+    if (m_Grid.IsStandable(position)) return position;
+
+    // Standing on a block that's shorter than a full block, like a slab, puts the feet inside of it.
+    if (m_Grid.IsStandable(position.x, position.y + 1, position.z))
+        return Vector3i(position.x, position.y + 1, position.z);
+
+    for (s32 drop = 1; drop <= m_MaxDrop; ++drop) {
+        Vector3i below(position.x, position.y - drop, position.z);
+
+        if (m_Grid.IsStandable(below)) return below;
+        if (!m_Grid.IsPassable(below)) break;
+    }
+
+    return position;
+}
+
+Path Pathfinder::FindPath(const Vector3i& start, const Vector3i& goal) {
+    Path path;
+
+    m_Nodes.clear();
+    m_NodeIndex.clear();
+    m_Open.clear();
+
+    Vector3i from = FindStandable(start);
+
+    m_Nodes.push_back(Node{ from, 0.0, (std::numeric_limits<u32>::max)(), false });
+    m_NodeIndex[GetKey(from)] = 0;
+    m_Open.emplace_back(EstimateCost(from, goal), 0);
+
+    u32 closest = 0;
+    double closestEstimate = EstimateCost(from, goal);
+
+    while (!m_Open.empty() && path.expanded < m_MaxNodes) {
+        std::pop_heap(m_Open.begin(), m_Open.end(), std::greater<OpenEntry>());
+        u32 current = m_Open.back().second;
+        m_Open.pop_back();
+
+        if (m_Nodes[current].closed) continue;
+
+        m_Nodes[current].closed = true;
+        ++path.expanded;
+
+        Vector3i position = m_Nodes[current].position;
+        double cost = m_Nodes[current].cost;
+
+        if (position == goal) {
+            closest = current;
+            path.complete = true;
+            break;
+        }
+
+        m_Edges.clear();
+        GetNeighbors(position, m_Edges);
+
+        for (const PathEdge& edge : m_Edges) {
+            double newCost = cost + edge.cost;
+            auto result = m_NodeIndex.emplace(GetKey(edge.to), (u32)m_Nodes.size());
+            u32 index = result.first->second;
+
+            if (result.second) {
+                m_Nodes.push_back(Node{ edge.to, newCost, current, false });
+            } else {
+                Node& node = m_Nodes[index];
+
+                if (node.closed || newCost >= node.cost) continue;
+
+                node.cost = newCost;
+                node.parent = current;
+            }
+
+            double estimate = EstimateCost(edge.to, goal);
+
+            if (estimate < closestEstimate) {
+                closestEstimate = estimate;
+                closest = index;
+            }
+
+            m_Open.emplace_back(newCost + estimate, index);
+            std::push_heap(m_Open.begin(), m_Open.end(), std::greater<OpenEntry>());
+        }
+    }
+
+    for (u32 index = closest; index != (std::numeric_limits<u32>::max)(); index = m_Nodes[index].parent)
+        path.nodes.push_back(m_Nodes[index].position);
+
+    std::reverse(path.nodes.begin(), path.nodes.end());
+
+    return path;
+}
+
+} // ns world
+} // ns mc
@@ -0,0 +1,416 @@
+#include <mclib/world/PhysicsBatch.h>
+
+#include <mclib/world/World.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MCLIB_PHYSICS_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace mc {
+namespace world {
+
+namespace {
+
+// Closer than this to the target counts as being there.
+const double ArriveDistance = 0.001;
+
+// std::floor is a library call without SSE4.1, and the batch needs several per body.
+inline s64 FloorToInt(double value) {
+    s64 truncated = (s64)value;
+
+    return truncated - (value < (double)truncated);
+}
+
+/**
+ * Finds the top of the highest box that the body is inside of, and how far the body can fall onto the others.
+ * Offset starts at the full fall, the same as the motion that Collider::Move clips.
+ */
+void Touch(const AABB& body, const AABB* begin, const AABB* end, double& top, double& offset) {
+    for (const AABB* box = begin; box != end; ++box) {
+        if (box->max.x <= body.min.x || box->min.x >= body.max.x) continue;
+        if (box->max.z <= body.min.z || box->min.z >= body.max.z) continue;
+
+        if (box->max.y > body.min.y && box->min.y < body.max.y) {
+            bool stuck = box->max.x - body.min.x > StuckTolerance && body.max.x - box->min.x > StuckTolerance &&
+                box->max.z - body.min.z > StuckTolerance && body.max.z - box->min.z > StuckTolerance;
+
+            if (stuck)
+                top = std::max(top, box->max.y);
+        } else if (body.min.y >= box->max.y) {
+            offset = std::max(offset, box->max.y - body.min.y);
+        }
+    }
+}
+
+} // ns
+
+PhysicsBatch::PhysicsBatch()
+    : m_Bounds(Vector3d(-0.3, 0, -0.3), Vector3d(0.3, 1.8, 0.3)),
+      m_FallSpeed(8.3),
+      m_OrderChanged(false),
+      m_LastWorld(nullptr),
+      m_LastColumnX(0),
+      m_LastColumnZ(0),
+      m_LastLoaded(false)
+{
+
+}
+
+PhysicsBatch::BodyId PhysicsBatch::AddBody(const World& world, const Vector3d& position) {
+    u32 worldIndex = (u32)m_Worlds.size();
+
+    for (u32 i = 0; i < m_Worlds.size(); ++i) {
+        if (m_Worlds[i].world == &world) {
+            worldIndex = i;
+            break;
+        }
+
+        if (!m_Worlds[i].world && worldIndex == m_Worlds.size())
+            worldIndex = i;
+    }
+
+    if (worldIndex == m_Worlds.size())
+        m_Worlds.emplace_back();
+
+    WorldEntry& entry = m_Worlds[worldIndex];
+
+    if (entry.world != &world) {
+        entry.world = &world;
+        entry.collider.reset(new Collider(world));
+        entry.bodies = 0;
+    }
+
+    ++entry.bodies;
+
+    BodyId body;
+
+    if (m_FreeBodies.empty()) {
+        body = (BodyId)m_X.size();
+
+        m_X.push_back(0.0);
+        m_Y.push_back(0.0);
+        m_Z.push_back(0.0);
+        m_TargetX.push_back(0.0);
+        m_TargetZ.push_back(0.0);
+        m_Speed.push_back(0.0);
+        m_StepHeight.push_back(0.0);
+        m_MotionX.push_back(0.0);
+        m_MotionZ.push_back(0.0);
+        m_World.push_back(0);
+        m_Flags.push_back(0);
+    } else {
+        body = m_FreeBodies.back();
+        m_FreeBodies.pop_back();
+    }
+
+    m_World[body] = worldIndex;
+    m_Flags[body] = Alive | Falls | OnGround;
+    m_OrderChanged = true;
+    SetPosition(body, position);
+
+    return body;
+}
+
+void PhysicsBatch::RemoveBody(BodyId body) {
+    if (body >= m_Flags.size() || !(m_Flags[body] & Alive)) return;
+
+    WorldEntry& entry = m_Worlds[m_World[body]];
+
+    if (--entry.bodies == 0) {
+        entry.world = nullptr;
+        entry.collider.reset();
+    }
+
+    m_Flags[body] = 0;
+    m_OrderChanged = true;
+    Stop(body);
+    m_FreeBodies.push_back(body);
+}
+
+void PhysicsBatch::SetPosition(BodyId body, const Vector3d& position) {
+    m_X[body] = position.x;
+    m_Y[body] = position.y;
+    m_Z[body] = position.z;
+
+    Stop(body);
+}
+
+void PhysicsBatch::SetFalls(BodyId body, bool falls) {
+    if (falls)
+        m_Flags[body] |= Falls;
+    else
+        m_Flags[body] &= ~Falls;
+}
+
+void PhysicsBatch::Walk(double dt) {
+    const std::size_t count = m_X.size();
+    std::size_t i = 0;
+
+#ifdef MCLIB_PHYSICS_SSE2
+    const __m128d time = _mm_set1_pd(dt);
+    const __m128d arrive = _mm_set1_pd(ArriveDistance);
+
+    for (; i + 2 <= count; i += 2) {
+        __m128d x = _mm_loadu_pd(&m_X[i]);
+        __m128d z = _mm_loadu_pd(&m_Z[i]);
+        __m128d dx = _mm_sub_pd(_mm_loadu_pd(&m_TargetX[i]), x);
+        __m128d dz = _mm_sub_pd(_mm_loadu_pd(&m_TargetZ[i]), z);
+        __m128d distance = _mm_sqrt_pd(_mm_add_pd(_mm_mul_pd(dx, dx), _mm_mul_pd(dz, dz)));
+        __m128d step = _mm_min_pd(_mm_mul_pd(_mm_loadu_pd(&m_Speed[i]), time), distance);
+        // Zero for the bodies that are already there, so they don't divide by a tiny distance.
+        __m128d moving = _mm_cmpge_pd(distance, arrive);
+        __m128d scale = _mm_and_pd(moving, _mm_div_pd(step, _mm_max_pd(distance, arrive)));
+
+        _mm_storeu_pd(&m_MotionX[i], _mm_mul_pd(dx, scale));
+        _mm_storeu_pd(&m_MotionZ[i], _mm_mul_pd(dz, scale));
+    }
+#endif
+
+    for (; i < count; ++i) {
+        double dx = m_TargetX[i] - m_X[i];
+        double dz = m_TargetZ[i] - m_Z[i];
+        double distance = std::sqrt(dx * dx + dz * dz);
+        double scale = 0.0;
+
+        if (distance >= ArriveDistance)
+            scale = std::min(m_Speed[i] * dt, distance) / distance;
+
+        m_MotionX[i] = dx * scale;
+        m_MotionZ[i] = dz * scale;
+    }
+}
+
+bool PhysicsBatch::IsLoaded(BodyId body) {
+    const World* world = m_Worlds[m_World[body]].world;
+    s64 columnX = FloorToInt(m_X[body]) >> 4;
+    s64 columnZ = FloorToInt(m_Z[body]) >> 4;
+
+    // The bodies are sorted by section, so this is mostly the same column as last time.
+    if (world != m_LastWorld || columnX != m_LastColumnX || columnZ != m_LastColumnZ) {
+        m_LastWorld = world;
+        m_LastColumnX = columnX;
+        m_LastColumnZ = columnZ;
+        m_LastLoaded = world->GetChunk(Vector3i(columnX * 16, 0, columnZ * 16)) != nullptr;
+    }
+
+    return m_LastLoaded;
+}
+
+void PhysicsBatch::SortBodies(double fall) {
+    const std::size_t count = m_Flags.size();
+
+    m_Areas.resize(count);
+    m_BlockAreas.resize(count);
+
+    const bool rebuild = m_OrderChanged;
+
+    if (rebuild) {
+        m_Order.clear();
+
+        for (BodyId body = 0; body < count; ++body) {
+            if (m_Flags[body] & Alive)
+                m_Order.push_back(SortEntry{ 0, m_World[body], body });
+        }
+
+        m_OrderChanged = false;
+    }
+
+    // Bodies rarely leave their section in one step. The ones that stayed are still in order,
+    // so only the ones that moved are sorted and then merged back in.
+    std::size_t kept = 0;
+
+    m_Moved.clear();
+
+    for (std::size_t i = 0; i < m_Order.size(); ++i) {
+        SortEntry entry = m_Order[i];
+        const BodyId body = entry.body;
+        AABB& area = m_Areas[body];
+        BlockArea& blocks = m_BlockAreas[body];
+
+        area = m_Bounds + Vector3d(m_X[body], m_Y[body], m_Z[body]);
+
+        // Everything the walk could run into, including stepping up, and then the fall from wherever it ends.
+        if (m_MotionX[body] != 0.0 || m_MotionZ[body] != 0.0) {
+            area.min.x += std::min(m_MotionX[body], 0.0);
+            area.max.x += std::max(m_MotionX[body], 0.0);
+            area.min.z += std::min(m_MotionZ[body], 0.0);
+            area.max.z += std::max(m_MotionZ[body], 0.0);
+            area.max.y += m_StepHeight[body];
+        }
+
+        if (m_Flags[body] & Falls)
+            area.min.y -= fall;
+
+        // Same blocks as Collider::GetCollisionBoxes reads, which includes the block below for fences and walls.
+        blocks.minX = FloorToInt(area.min.x);
+        blocks.minY = FloorToInt(area.min.y) - 1;
+        blocks.minZ = FloorToInt(area.min.z);
+        blocks.maxX = FloorToInt(area.max.x);
+        blocks.maxY = FloorToInt(area.max.y);
+        blocks.maxZ = FloorToInt(area.max.z);
+
+        s64 x = FloorToInt(m_X[body]);
+        s64 y = FloorToInt(m_Y[body]);
+        s64 z = FloorToInt(m_Z[body]);
+        u64 section = ((u64)((x >> 4) & 0xFFFFFFF) << 36) | ((u64)((z >> 4) & 0xFFFFFFF) << 8) | (u64)((y >> 4) & 0xFF);
+
+        if (section == entry.section && !rebuild) {
+            m_Order[kept++] = entry;
+        } else {
+            entry.section = section;
+            m_Moved.push_back(entry);
+        }
+    }
+
+    if (m_Moved.empty()) return;
+
+    m_Order.resize(kept);
+    std::sort(m_Moved.begin(), m_Moved.end());
+
+    m_Merged.resize(m_Order.size() + m_Moved.size());
+    std::merge(m_Order.begin(), m_Order.end(), m_Moved.begin(), m_Moved.end(), m_Merged.begin());
+    m_Order.swap(m_Merged);
+}
+
+void PhysicsBatch::Resolve(BodyId body, double fall, const AABB* begin, const AABB* end) {
+    if (m_MotionX[body] != 0.0 || m_MotionZ[body] != 0.0) {
+        AABB box = m_Bounds + Vector3d(m_X[body], m_Y[body], m_Z[body]);
+        Vector3d motion(m_MotionX[body], 0.0, m_MotionZ[body]);
+        MoveResult result = Collider::MoveAgainst(box, motion, begin, end, (m_Flags[body] & OnGround) != 0, m_StepHeight[body]);
+
+        m_X[body] += result.motion.x;
+        m_Y[body] += result.motion.y;
+        m_Z[body] += result.motion.z;
+    }
+
+    AABB box = m_Bounds + Vector3d(m_X[body], m_Y[body], m_Z[body]);
+    double top = -std::numeric_limits<double>::infinity();
+    double offset = -fall;
+
+    Touch(box, begin, end, top, offset);
+
+    m_Flags[body] |= OnGround;
+
+    if (top != -std::numeric_limits<double>::infinity()) {
+        // Climb onto the highest block the body is stuck in.
+        m_Y[body] = top;
+        return;
+    }
+
+    // Bodies hang in the air above chunks that aren't loaded yet.
+    if (!(m_Flags[body] & Falls) || !IsLoaded(body)) return;
+
+    m_Y[body] += offset;
+
+    if (offset == -fall)
+        m_Flags[body] &= ~OnGround;
+}
+
+void PhysicsBatch::Collide(double fall) {
+    SortBodies(fall);
+    m_LastWorld = nullptr;
+
+    for (std::size_t first = 0; first < m_Order.size();) {
+        const u64 section = m_Order[first].section;
+        const u32 worldIndex = m_Order[first].world;
+        Collider& collider = *m_Worlds[worldIndex].collider;
+        AABB area = m_Areas[m_Order[first].body];
+        BlockArea blocks = m_BlockAreas[m_Order[first].body];
+        s64 separateBlocks = blocks.GetVolume();
+        std::size_t last = first + 1;
+
+        for (; last < m_Order.size() && m_Order[last].section == section && m_Order[last].world == worldIndex; ++last) {
+            const BodyId body = m_Order[last].body;
+            const BlockArea& next = m_BlockAreas[body];
+
+            for (std::size_t i = 0; i < 3; ++i) {
+                area.min[i] = std::min(area.min[i], m_Areas[body].min[i]);
+                area.max[i] = std::max(area.max[i], m_Areas[body].max[i]);
+            }
+
+            blocks.minX = std::min(blocks.minX, next.minX);
+            blocks.minY = std::min(blocks.minY, next.minY);
+            blocks.minZ = std::min(blocks.minZ, next.minZ);
+            blocks.maxX = std::max(blocks.maxX, next.maxX);
+            blocks.maxY = std::max(blocks.maxY, next.maxY);
+            blocks.maxZ = std::max(blocks.maxZ, next.maxZ);
+            separateBlocks += next.GetVolume();
+        }
+
+        if (last - first == 1 || blocks.GetVolume() > separateBlocks) {
+            // Too spread out to share a gather.
+            for (std::size_t i = first; i < last; ++i) {
+                const BodyId body = m_Order[i].body;
+                const std::vector<AABB>& boxes = collider.GetCollisionBoxes(m_Areas[body]);
+
+                Resolve(body, fall, boxes.data(), boxes.data() + boxes.size());
+            }
+
+            first = last;
+            continue;
+        }
+
+        const std::vector<AABB>& boxes = collider.GetCollisionBoxes(area);
+        const s64 width = blocks.maxZ - blocks.minZ + 1;
+
+        // Block boxes don't stick out of their block sideways, so a box belongs to the column of its lowest corner.
+        auto getCell = [&blocks, width](const AABB& box) {
+            s64 x = std::min(std::max(FloorToInt(box.min.x), blocks.minX), blocks.maxX);
+            s64 z = std::min(std::max(FloorToInt(box.min.z), blocks.minZ), blocks.maxZ);
+
+            return (std::size_t)((x - blocks.minX) * width + (z - blocks.minZ));
+        };
+
+        // Counting sort of the boxes by block column.
+        m_CellStarts.assign((std::size_t)((blocks.maxX - blocks.minX + 1) * width + 1), 0);
+
+        for (const AABB& box : boxes)
+            ++m_CellStarts[getCell(box) + 1];
+
+        for (std::size_t i = 1; i < m_CellStarts.size(); ++i)
+            m_CellStarts[i] += m_CellStarts[i - 1];
+
+        m_CellBoxes.resize(boxes.size());
+
+        for (const AABB& box : boxes)
+            m_CellBoxes[m_CellStarts[getCell(box)]++] = box;
+
+        // Filling moved every start to the end of its column, so shift them back.
+        for (std::size_t i = m_CellStarts.size() - 1; i > 0; --i)
+            m_CellStarts[i] = m_CellStarts[i - 1];
+        m_CellStarts[0] = 0;
+
+        for (std::size_t i = first; i < last; ++i) {
+            const BodyId body = m_Order[i].body;
+            const BlockArea& bodyBlocks = m_BlockAreas[body];
+
+            // The columns under the body are a run of boxes for each x.
+            m_BodyBoxes.clear();
+
+            for (s64 x = bodyBlocks.minX; x <= bodyBlocks.maxX; ++x) {
+                std::size_t row = (std::size_t)((x - blocks.minX) * width);
+                const AABB* begin = m_CellBoxes.data() + m_CellStarts[row + (std::size_t)(bodyBlocks.minZ - blocks.minZ)];
+                const AABB* end = m_CellBoxes.data() + m_CellStarts[row + (std::size_t)(bodyBlocks.maxZ - blocks.minZ) + 1];
+
+                m_BodyBoxes.insert(m_BodyBoxes.end(), begin, end);
+            }
+
+            Resolve(body, fall, m_BodyBoxes.data(), m_BodyBoxes.data() + m_BodyBoxes.size());
+        }
+
+        first = last;
+    }
+}
+
+void PhysicsBatch::Step(double dt) {
+    Walk(dt);
+    Collide(m_FallSpeed * dt);
+}
+
+} // ns world
+} // ns mc
@@ -0,0 +1,116 @@
+#include <mclib/world/SectionStore.h>
+
+#include <algorithm>
+
+namespace mc {
+namespace world {
+
+SectionStore::SectionStore()
+    : m_SweepSize(64), m_Lookups(0), m_Hits(0)
+{
+
+}
+
+SectionStore& SectionStore::GetInstance() {
+    static SectionStore store;
+    return store;
+}
+
+u64 SectionStore::Hash(const Chunk& section) {
+    // FNV-1a over whole words with an extra multiply, the packed data is already fairly random.
+    const u64 prime = 1099511628211ULL;
+    u64 hash = 14695981039346656037ULL;
+
+    auto mix = [&](u64 value) {
+        hash ^= value;
+        hash *= prime;
+        hash ^= hash >> 32;
+    };
+
+    mix(section.m_BitsPerBlock);
+
+    for (u32 value : section.m_Palette)
+        mix(value);
+    for (u64 value : section.m_Data)
+        mix(value);
+
+    return hash;
+}
+
+bool SectionStore::Equals(const Chunk& first, const Chunk& second) {
+    return first.m_BitsPerBlock == second.m_BitsPerBlock && first.m_Palette == second.m_Palette && first.m_Data == second.m_Data;
+}
+
+void SectionStore::Sweep() {
+    for (auto iter = m_Sections.begin(); iter != m_Sections.end();) {
+        if (iter->second.expired())
+            iter = m_Sections.erase(iter);
+        else
+            ++iter;
+    }
+
+    m_SweepSize = std::max<std::size_t>(m_Sections.size(), 64);
+}
+
+ChunkPtr SectionStore::Intern(const ChunkPtr& section) {
+    if (!section) return nullptr;
+    if (section->m_Shared) return section;
+
+    u64 hash = Hash(*section);
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    ++m_Lookups;
+
+    auto range = m_Sections.equal_range(hash);
+    for (auto iter = range.first; iter != range.second;) {
+        ChunkPtr stored = iter->second.lock();
+
+        if (!stored) {
+            iter = m_Sections.erase(iter);
+            continue;
+        }
+
+        if (Equals(*stored, *section)) {
+            ++m_Hits;
+            return stored;
+        }
+
+        ++iter;
+    }
+
+    section->m_Shared = true;
+    m_Sections.emplace(hash, section);
+
+    if (m_Sections.size() > m_SweepSize * 2)
+        Sweep();
+
+    return section;
+}
+
+SectionStoreStats SectionStore::GetStats() const {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    SectionStoreStats stats = {};
+
+    for (const auto& entry : m_Sections) {
+        ChunkPtr section = entry.second.lock();
+        if (!section) continue;
+
+        // Without the reference that lock() just added
+        std::size_t references = section.use_count() - 1;
+        std::size_t usage = section->GetMemoryUsage();
+
+        ++stats.sections;
+        stats.bytes += usage;
+        stats.referencedBytes += usage * references;
+    }
+
+    stats.lookups = m_Lookups;
+    stats.hits = m_Hits;
+
+    return stats;
+}
+
+} // ns world
+} // ns mc
@@ -1,11 +1,97 @@
 #include <mclib/world/World.h>
 
+#include <algorithm>
+#include <queue>
+#include <thread>
+
 namespace mc {
 namespace world {
 
-World::World(protocol::packets::PacketDispatcher* dispatcher)
-    : protocol::packets::PacketHandler(dispatcher)
+namespace {
+
+struct SectionCandidate {
+    double distanceSq;
+    Vector3i origin;
+    // Null for an air section
+    ChunkPtr section;
+};
+
+struct BlockHit {
+    double distanceSq;
+    Vector3i position;
+    u32 data;
+
+    bool operator>(const BlockHit& other) const noexcept {
+        return distanceSq > other.distanceSq;
+    }
+};
+
+double DistanceSqToBox(const Vector3d& point, const Vector3d& min, const Vector3d& max) {
+    double dx = std::max(std::max(min.x - point.x, 0.0), point.x - max.x);
+    double dy = std::max(std::max(min.y - point.y, 0.0), point.y - max.y);
+    double dz = std::max(std::max(min.z - point.z, 0.0), point.z - max.z);
+
+    return dx * dx + dy * dy + dz * dz;
+}
+
+// Blocks are measured from their center
+double BlockDistanceSq(const Vector3d& center, const Vector3i& position) {
+    return (ToVector3d(position) + Vector3d(0.5, 0.5, 0.5)).DistanceSq(center);
+}
+
+// Direction the ray has to travel along axis to enter a box through the face.
+Face GetEntryFace(std::size_t axis, double direction) {
+    static const Face negative[] = { Face::West, Face::Bottom, Face::North };
+    static const Face positive[] = { Face::East, Face::Top, Face::South };
+
+    // Moving towards positive enters through the negative side
+    return direction > 0 ? negative[axis] : positive[axis];
+}
+
+std::size_t GetEntryAxis(const AABB& box, const Ray& ray) {
+    std::size_t axis = 0;
+    double entry = -std::numeric_limits<double>::max();
+
+    for (std::size_t i = 0; i < 3; ++i) {
+        if (ray.GetDirection()[i] == 0.0) continue;
+
+        double t1 = (box.min[i] - ray.GetOrigin()[i]) * ray.GetReciprocal()[i];
+        double t2 = (box.max[i] - ray.GetOrigin()[i]) * ray.GetReciprocal()[i];
+        double enter = std::min(t1, t2);
+
+        if (enter > entry) {
+            entry = enter;
+            axis = i;
+        }
+    }
+
+    return axis;
+}
+
+} // ns
+
+// Remembers the last column a lookup went to, since a ray usually stays in a column for several blocks.
+struct World::ColumnCursor {
+    ChunkCoord coord;
+    ConstChunkColumnPtr column;
+    bool valid;
+
+    ColumnCursor() : valid(false) { }
+};
+
+World::World(protocol::packets::PacketDispatcher* dispatcher, const block::BlockRegistry* registry)
+    : protocol::packets::PacketHandler(dispatcher),
+      m_Registry(registry ? registry : block::BlockRegistry::GetInstance()),
+      m_SnapshotRequested(false),
+      m_SnapshotRebuild(true),
+      m_ShareSections(false),
+      m_HotRadius(0),
+      m_HotScanNeeded(false)
 {
+    auto empty = std::make_shared<WorldSnapshot>();
+    empty->m_Registry = m_Registry;
+    m_EmptySnapshot = empty;
+
     dispatcher->RegisterHandler(protocol::State::Play, protocol::play::MultiBlockChange, this);
     dispatcher->RegisterHandler(protocol::State::Play, protocol::play::BlockChange, this);
     dispatcher->RegisterHandler(protocol::State::Play, protocol::play::ChunkData, this);
@@ -20,7 +106,10 @@ World::~World() {
 }
 
 bool World::SetBlock(Vector3i position, u32 blockData) {
-    ChunkColumnPtr chunk = GetChunk(position);
+    block::BlockPtr block = m_Registry->GetBlock(blockData);
+    if (!block || position.y < 0 || position.y > 255) return false;
+
+    ChunkColumnPtr chunk = GetLiveColumn(GetChunkCoord(position));
     if (!chunk) return false;
 
     Vector3i relative(position);
@@ -34,45 +123,330 @@ bool World::SetBlock(Vector3i position, u32 blockData) {
         relative.z += 16;
 
     std::size_t index = (std::size_t)position.y / 16;
-    if ((*chunk)[index] == nullptr) {
-        ChunkPtr section = std::make_shared<Chunk>();
+    ChunkCoord coord(chunk->GetMetadata().x, chunk->GetMetadata().z);
+    MarkSnapshotDirty(coord, 1 << index);
+    UpdateBlockIndex(coord, relative, blockData);
 
-        (*chunk)[index] = section;
-    }
+    chunk->UpdateHeightmaps(relative, blockData);
 
     relative.y %= 16;
-    (*chunk)[index]->SetBlock(relative, block::BlockRegistry::GetInstance()->GetBlock(blockData));
+    GetWritableSection(*chunk, index).SetBlock(relative, block, m_Registry);
     return true;
 }
 
+Chunk& World::GetWritableSection(ChunkColumn& column, std::size_t index) {
+    ChunkPtr& section = column[index];
+
+    if (section == nullptr)
+        section = std::make_shared<Chunk>();
+    else if (section->IsShared())
+        section = std::make_shared<Chunk>(*section);
+
+    return *section;
+}
+
+void World::IndexColumn(const ChunkCoord& coord, const ChunkColumn& column) {
+    if (m_IndexedStates.IsEmpty()) return;
+
+    auto& entries = m_BlockIndex[coord];
+    entries.clear();
+
+    for (s32 i = 0; i < ChunkColumn::ChunksPerColumn; ++i) {
+        ChunkPtr section = column[i];
+
+        if (section ? !section->MayContain(m_IndexedStates) : !m_IndexedStates.Contains(0))
+            continue;
+
+        for (s32 index = 0; index < 16 * 16 * 16; ++index) {
+            Vector3i relative(index & 15, index >> 8, (index >> 4) & 15);
+            u32 data = section ? section->GetBlockData(relative) : 0;
+
+            if (m_IndexedStates.Contains(data))
+                entries[(u16)((i << 12) | index)] = data;
+        }
+    }
+}
+
+void World::UpdateBlockIndex(const ChunkCoord& coord, const Vector3i& relative, u32 blockData) {
+    if (m_IndexedStates.IsEmpty() || relative.y < 0 || relative.y > 255) return;
+
+    u16 key = (u16)((relative.y << 8) | (relative.z << 4) | relative.x);
+
+    if (m_IndexedStates.Contains(blockData)) {
+        m_BlockIndex[coord][key] = blockData;
+    } else {
+        auto iter = m_BlockIndex.find(coord);
+
+        if (iter != m_BlockIndex.end())
+            iter->second.erase(key);
+    }
+}
+
+void World::SetIndexedStates(const BlockTypeSet& states) {
+    m_IndexedStates = states;
+    m_BlockIndex.clear();
+
+    for (const auto& entry : m_Chunks) {
+        if (entry.second)
+            IndexColumn(entry.first, *entry.second);
+    }
+
+    if (m_ColdStore) {
+        for (const auto& entry : *m_ColdStore) {
+            ChunkColumnPtr column = m_ColdStore->Read(entry.first);
+
+            if (column)
+                IndexColumn(entry.first, *column);
+        }
+    }
+}
+
+void World::NotifyBlockChanges(const std::vector<BlockChange>& changes) {
+    if (changes.empty()) return;
+
+    NotifyListeners(&WorldListener::OnBlockChanges, changes);
+    m_BlockChangesEvent.Dispatch(changes);
+
+    if (!m_BlockChangeEvent.HasSubscribers()) return;
+
+    for (const BlockChange& change : changes)
+        m_BlockChangeEvent.Dispatch(change.position, change.newBlock, change.oldBlock);
+}
+
+World::ChunkCoord World::GetChunkCoord(const Vector3i& pos) {
+    return ChunkCoord((s32)std::floor(pos.x / 16.0), (s32)std::floor(pos.z / 16.0));
+}
+
+ChunkColumnPtr World::GetLiveColumn(const ChunkCoord& coord) {
+    auto iter = m_Chunks.find(coord);
+
+    if (iter != m_Chunks.end()) return iter->second;
+
+    return PromoteColumn(coord);
+}
+
+ChunkColumnPtr World::PromoteColumn(const ChunkCoord& coord) {
+    if (!m_ColdStore) return nullptr;
+
+    ChunkColumnPtr column = m_ColdStore->Take(coord);
+    if (!column) return nullptr;
+
+    // Decompressed into sections of its own, so they're shared again like a freshly loaded column.
+    ShareSections(*column);
+    // Same blocks as before, so the snapshot keeps its copy.
+    m_Chunks[coord] = column;
+
+    return column;
+}
+
+void World::ShareSections(ChunkColumn& column) {
+    if (!m_ShareSections) return;
+
+    for (auto& section : column)
+        section = SectionStore::GetInstance().Intern(section);
+}
+
+void World::EnableColdStorage(s32 hotRadius, std::size_t cacheBudget) {
+    if (!m_ColdStore)
+        m_ColdStore = std::make_unique<ColdColumnStore>(cacheBudget);
+    else
+        m_ColdStore->SetCacheBudget(cacheBudget);
+
+    m_HotRadius = hotRadius;
+    m_HotScanNeeded = true;
+}
+
+void World::DisableColdStorage() {
+    if (!m_ColdStore) return;
+
+    std::vector<ChunkCoord> coords;
+    for (const auto& entry : *m_ColdStore)
+        coords.push_back(entry.first);
+
+    for (const auto& coord : coords)
+        PromoteColumn(coord);
+
+    m_ColdStore.reset();
+}
+
+void World::UpdateColdStorage(Vector3d center) {
+    if (!m_ColdStore) return;
+
+    ChunkCoord centerCoord((s32)std::floor(center.x / 16.0), (s32)std::floor(center.z / 16.0));
+
+    if (centerCoord == m_HotCenter && !m_HotScanNeeded) return;
+
+    m_HotCenter = centerCoord;
+    m_HotScanNeeded = false;
+
+    auto isHot = [this](const ChunkCoord& coord) {
+        return std::abs(coord.first - m_HotCenter.first) <= m_HotRadius && std::abs(coord.second - m_HotCenter.second) <= m_HotRadius;
+    };
+
+    for (auto iter = m_Chunks.begin(); iter != m_Chunks.end();) {
+        if (!iter->second || isHot(iter->first)) {
+            ++iter;
+            continue;
+        }
+
+        // Not marked dirty, snapshots keep the column they already have.
+        m_ColdStore->Store(iter->first, *iter->second);
+        iter = m_Chunks.erase(iter);
+    }
+
+    std::vector<ChunkCoord> promote;
+    for (const auto& entry : *m_ColdStore) {
+        if (isHot(entry.first))
+            promote.push_back(entry.first);
+    }
+
+    for (const auto& coord : promote)
+        PromoteColumn(coord);
+}
+
+ColdColumnStats World::GetColdStorageStats() const {
+    if (!m_ColdStore) return ColdColumnStats();
+
+    return m_ColdStore->GetStats();
+}
+
+void World::SetDecodePool(std::shared_ptr<util::ThreadPool> pool) {
+    FinishPendingColumns();
+
+    m_DecodePool = std::move(pool);
+}
+
+void World::SetDecodeThreads(std::size_t count) {
+    SetDecodePool(count > 0 ? std::make_shared<util::ThreadPool>(count) : nullptr);
+}
+
+void World::ApplyDecodedColumns() {
+    while (!m_PendingColumns.empty() && m_PendingColumns.front()->finished.load(std::memory_order_acquire)) {
+        std::shared_ptr<PendingColumn> pending = std::move(m_PendingColumns.front());
+
+        m_PendingColumns.pop_front();
+
+        if (pending->column)
+            ApplyChunkColumn(pending->column);
+
+        for (auto& apply : pending->held)
+            apply();
+    }
+}
+
+void World::FinishPendingColumns() {
+    while (true) {
+        ApplyDecodedColumns();
+
+        if (m_PendingColumns.empty()) break;
+
+        if (!m_DecodePool || !m_DecodePool->RunPendingTask())
+            std::this_thread::yield();
+    }
+}
+
+bool World::HoldForPendingColumn(const ChunkCoord& coord, std::function<void()> apply) {
+    ApplyDecodedColumns();
+
+    // Attach to the latest pending packet for the column so it's applied between that one and any later one.
+    for (auto iter = m_PendingColumns.rbegin(); iter != m_PendingColumns.rend(); ++iter) {
+        if ((*iter)->coord == coord) {
+            (*iter)->held.push_back(std::move(apply));
+            return true;
+        }
+    }
+
+    return false;
+}
+
 void World::HandlePacket(protocol::packets::in::ExplosionPacket* packet) {
+    // The affected blocks can span several columns, so let every column catch up first.
+    FinishPendingColumns();
+
     Vector3d position = packet->GetPosition();
+    std::map<ChunkCoord, std::vector<protocol::packets::in::MultiBlockChangePacket::BlockChange>> columns;
 
+    // Set all affected blocks to air, a column at a time.
     for (Vector3s offset : packet->GetAffectedBlocks()) {
-        Vector3d absolute = position + ToVector3d(offset);
+        Vector3i absolute = ToVector3i(position + ToVector3d(offset));
+        ChunkCoord coord = GetChunkCoord(absolute);
 
-        block::BlockPtr oldBlock = GetBlock(absolute);
+        columns[coord].push_back({ (s16)(absolute.x & 15), (s16)absolute.y, (s16)(absolute.z & 15), 0 });
+    }
 
-        // Set all affected blocks to air
-        SetBlock(ToVector3i(absolute), 0);
+    std::vector<BlockChange> changes;
+    changes.reserve(packet->GetAffectedBlocks().size());
 
-        block::BlockPtr newBlock = block::BlockRegistry::GetInstance()->GetBlock(0);
-        NotifyListeners(&WorldListener::OnBlockChange, ToVector3i(absolute), newBlock, oldBlock);
-    }
+    for (const auto& entry : columns)
+        SetColumnBlocks(entry.first, entry.second, changes);
+
+    NotifyBlockChanges(changes);
 }
 
 void World::HandlePacket(protocol::packets::in::ChunkDataPacket* packet) {
-    ChunkColumnPtr col = packet->GetChunkColumn();
+    const ChunkColumnMetadata& meta = packet->GetMetadata();
+    ChunkCoord key(meta.x, meta.z);
+    bool unload = meta.continuous && meta.sectionmask == 0;
+
+    if (!m_DecodePool || packet->IsDecoded() || unload) {
+        ChunkColumnPtr col = packet->GetChunkColumn(m_Registry);
+
+        if (!HoldForPendingColumn(key, [this, col]() { ApplyChunkColumn(col); }))
+            ApplyChunkColumn(col);
+        return;
+    }
+
+    ApplyDecodedColumns();
+
+    auto pending = std::make_shared<PendingColumn>();
+
+    pending->coord = key;
+    pending->metadata = meta;
+    pending->data = packet->GetColumnData();
+    pending->finished = false;
+
+    m_PendingColumns.push_back(pending);
+
+    const block::BlockRegistry* registry = m_Registry;
+
+    m_DecodePool->Submit([pending, registry]() {
+        auto column = std::make_shared<ChunkColumn>(pending->metadata, registry);
+
+        try {
+            column->Load(pending->data);
+            pending->column = column;
+        } catch (const std::exception&) {
+            // Dropped, like a packet that failed to deserialize.
+        }
+
+        pending->data = DataBuffer();
+        pending->finished.store(true, std::memory_order_release);
+    });
+}
+
+void World::ApplyChunkColumn(ChunkColumnPtr col) {
     const ChunkColumnMetadata& meta = col->GetMetadata();
     ChunkCoord key(meta.x, meta.z);
 
+    // Only when something else decoded the packet first, with another registry.
+    if (col->GetRegistry() != m_Registry)
+        col->SetRegistry(m_Registry);
+
+    PromoteColumn(key);
+    MarkSnapshotDirty(key, 0xFFFF);
+    m_HotScanNeeded = true;
+
     if (meta.continuous && meta.sectionmask == 0) {
         m_Chunks[key] = nullptr;
+        m_BlockIndex.erase(key);
         return;
     }
 
-    if (!m_Chunks[key])
+    if (!m_Chunks[key]) {
+        ShareSections(*col);
         m_Chunks[key] = col;
+        IndexColumn(key, *col);
+    }
 
     for (s32 i = 0; i < ChunkColumn::ChunksPerColumn; ++i) {
         ChunkPtr chunk = (*col)[i];
@@ -82,64 +456,117 @@ void World::HandlePacket(protocol::packets::in::ChunkDataPacket* packet) {
 }
 
 void World::HandlePacket(protocol::packets::in::MultiBlockChangePacket* packet) {
-    Vector3i chunkStart(packet->GetChunkX() * 16, 0, packet->GetChunkZ() * 16);
-    auto iter = m_Chunks.find(ChunkCoord(packet->GetChunkX(), packet->GetChunkZ()));
-    if (iter == m_Chunks.end()) return;
+    ChunkCoord coord(packet->GetChunkX(), packet->GetChunkZ());
+    const auto& changes = packet->GetBlockChanges();
 
-    ChunkColumnPtr chunk = iter->second;
+    if (HoldForPendingColumn(coord, [this, coord, changes]() { ApplyMultiBlockChange(coord, changes); }))
+        return;
+
+    ApplyMultiBlockChange(coord, changes);
+}
+
+void World::ApplyMultiBlockChange(const ChunkCoord& coord, const std::vector<protocol::packets::in::MultiBlockChangePacket::BlockChange>& changes) {
+    std::vector<BlockChange> notifications;
+    notifications.reserve(changes.size());
+
+    SetColumnBlocks(coord, changes, notifications);
+    NotifyBlockChanges(notifications);
+}
+
+void World::SetColumnBlocks(const ChunkCoord& coord, const std::vector<protocol::packets::in::MultiBlockChangePacket::BlockChange>& changes,
+    std::vector<BlockChange>& notifications)
+{
+    Vector3i chunkStart(coord.first * 16, 0, coord.second * 16);
+
+    ChunkColumnPtr chunk = GetLiveColumn(coord);
     if (!chunk)
         return;
 
-    const auto& changes = packet->GetBlockChanges();
+    const block::BlockRegistry* registry = m_Registry;
+    u16 dirty = 0;
+
+    // Batches are usually the same few blocks over and over, so remember the last lookup of each side.
+    u32 oldData = 0, newData = 0;
+    block::BlockPtr oldBlock = registry->GetBlock(0);
+    block::BlockPtr newBlock = oldBlock;
+
     for (const auto& change : changes) {
+        if (change.y < 0 || change.y > 255) continue;
+
+        std::size_t index = change.y / 16;
         Vector3i relative(change.x, change.y, change.z);
+        Vector3i sectionPosition(change.x, change.y % 16, change.z);
+        const ChunkPtr& section = (*chunk)[index];
 
-        chunk->RemoveBlockEntity(chunkStart + relative);
+        u32 data = (u16)change.blockData;
+        if (data != newData) {
+            newData = data;
+            newBlock = registry->GetBlock(data);
+        }
 
-        std::size_t index = change.y / 16;
-        block::BlockPtr oldBlock = block::BlockRegistry::GetInstance()->GetBlock(0);
-        if ((*chunk)[index] == nullptr) {
-            ChunkPtr section = std::make_shared<Chunk>();
+        if (!newBlock) continue;
 
-            (*chunk)[index] = section;
-        } else {
-            oldBlock = chunk->GetBlock(relative);
+        data = section ? section->GetBlockData(sectionPosition) : 0;
+        if (data != oldData) {
+            oldData = data;
+            oldBlock = registry->GetBlock(data);
         }
 
-        block::BlockPtr newBlock = block::BlockRegistry::GetInstance()->GetBlock(change.blockData);
+        chunk->RemoveBlockEntity(chunkStart + relative);
+        dirty |= 1 << index;
 
-        Vector3i blockChangePos = chunkStart + relative;
+        GetWritableSection(*chunk, index).SetBlock(sectionPosition, newBlock, m_Registry);
+        chunk->UpdateHeightmaps(relative, newData);
+        UpdateBlockIndex(coord, relative, newData);
 
-        relative.y %= 16;
-        (*chunk)[index]->SetBlock(relative, newBlock);
-        NotifyListeners(&WorldListener::OnBlockChange, blockChangePos, newBlock, oldBlock);
+        notifications.push_back({ chunkStart + relative, newBlock, oldBlock });
     }
+
+    if (dirty)
+        MarkSnapshotDirty(coord, dirty);
 }
 
 void World::HandlePacket(protocol::packets::in::BlockChangePacket* packet) {
-    block::BlockPtr newBlock = block::BlockRegistry::GetInstance()->GetBlock((u16)packet->GetBlockId());
-    block::BlockPtr oldBlock = GetBlock(packet->GetPosition());
+    Vector3i position = packet->GetPosition();
+    s32 blockId = packet->GetBlockId();
+
+    if (HoldForPendingColumn(GetChunkCoord(position), [this, position, blockId]() { ApplyBlockChange(position, blockId); }))
+        return;
 
-    SetBlock(packet->GetPosition(), packet->GetBlockId());
+    ApplyBlockChange(position, blockId);
+}
+
+void World::ApplyBlockChange(Vector3i position, s32 blockId) {
+    block::BlockPtr newBlock = m_Registry->GetBlock((u16)blockId);
+    block::BlockPtr oldBlock = GetBlock(position);
+
+    SetBlock(position, blockId);
 
-    NotifyListeners(&WorldListener::OnBlockChange, packet->GetPosition(), newBlock, oldBlock);
+    NotifyBlockChanges(std::vector<BlockChange>(1, BlockChange{ position, newBlock, oldBlock }));
 
-    ChunkColumnPtr col = GetChunk(packet->GetPosition());
+    ChunkColumnPtr col = GetChunk(position);
     if (col) {
-        col->RemoveBlockEntity(packet->GetPosition());
+        col->RemoveBlockEntity(position);
     }
 }
 
 void World::HandlePacket(protocol::packets::in::UpdateBlockEntityPacket* packet) {
     Vector3i pos = packet->GetPosition();
+    block::BlockEntityPtr entity = packet->GetBlockEntity();
+
+    if (HoldForPendingColumn(GetChunkCoord(pos), [this, pos, entity]() { ApplyBlockEntity(pos, entity); }))
+        return;
+
+    ApplyBlockEntity(pos, entity);
+}
 
-    ChunkColumnPtr col = GetChunk(pos);
+void World::ApplyBlockEntity(Vector3i pos, block::BlockEntityPtr entity) {
+    ChunkColumnPtr col = GetLiveColumn(GetChunkCoord(pos));
 
     if (!col) return;
 
     col->RemoveBlockEntity(pos);
 
-    block::BlockEntityPtr entity = packet->GetBlockEntity();
     if (entity)
         col->AddBlockEntity(entity);
 }
@@ -147,6 +574,15 @@ void World::HandlePacket(protocol::packets::in::UpdateBlockEntityPacket* packet)
 void World::HandlePacket(protocol::packets::in::UnloadChunkPacket* packet) {
     ChunkCoord coord(packet->GetChunkX(), packet->GetChunkZ());
 
+    if (HoldForPendingColumn(coord, [this, coord]() { ApplyUnload(coord); }))
+        return;
+
+    ApplyUnload(coord);
+}
+
+void World::ApplyUnload(const ChunkCoord& coord) {
+    PromoteColumn(coord);
+
     auto iter = m_Chunks.find(coord);
 
     if (iter == m_Chunks.end()) return;
@@ -154,32 +590,154 @@ void World::HandlePacket(protocol::packets::in::UnloadChunkPacket* packet) {
     ChunkColumnPtr chunk = iter->second;
     NotifyListeners(&WorldListener::OnChunkUnload, chunk);
 
+    MarkSnapshotDirty(coord, 0xFFFF);
     m_Chunks.erase(iter);
+    m_BlockIndex.erase(coord);
 }
 
 // Clear all chunks because the server will resend the chunks after this.
 void World::HandlePacket(protocol::packets::in::RespawnPacket* packet) {
+    // Anything still being decoded belongs to the old world.
+    m_PendingColumns.clear();
+
     for (auto entry : m_Chunks) {
         ChunkColumnPtr chunk = entry.second;
 
         NotifyListeners(&WorldListener::OnChunkUnload, chunk);
     }
     m_Chunks.clear();
+
+    if (m_ColdStore) {
+        for (const auto& entry : *m_ColdStore)
+            NotifyListeners(&WorldListener::OnChunkUnload, m_ColdStore->Read(entry.first));
+
+        m_ColdStore->Clear();
+    }
+
+    m_BlockIndex.clear();
+    m_SnapshotDirty.clear();
+    m_SnapshotRebuild = true;
+}
+
+void World::MarkSnapshotDirty(const ChunkCoord& coord, u16 sections) {
+    if (!m_SnapshotRequested.load(std::memory_order_relaxed) || m_SnapshotRebuild) return;
+
+    m_SnapshotDirty[coord] |= sections;
+}
+
+WorldSnapshotPtr World::GetSnapshot() const {
+    WorldSnapshotPtr snapshot = std::atomic_load(&m_Snapshot);
+
+    if (!snapshot) {
+        m_SnapshotRequested = true;
+        return m_EmptySnapshot;
+    }
+
+    return snapshot;
 }
 
-ChunkColumnPtr World::GetChunk(Vector3i pos) const {
-    s32 x = (s32)std::floor(pos.x / 16.0);
-    s32 z = (s32)std::floor(pos.z / 16.0);
+void World::PublishSnapshot() {
+    if (!m_SnapshotRequested) return;
+    if (!m_SnapshotRebuild && m_SnapshotDirty.empty()) return;
+
+    WorldSnapshotPtr previous = std::atomic_load(&m_Snapshot);
+    auto snapshot = std::make_shared<WorldSnapshot>();
 
-    ChunkCoord key(x, z);
+    snapshot->m_Registry = m_Registry;
 
-    auto iter = m_Chunks.find(key);
+    snapshot->m_Version = previous ? previous->m_Version + 1 : 1;
 
-    if (iter == m_Chunks.end()) return nullptr;
+    auto copyColumn = [](const ChunkColumnPtr& live, const ConstChunkColumnPtr& old, u16 dirty) {
+        // Copied from the live column for the heightmaps and block entities, the sections are replaced below.
+        auto column = std::make_shared<ChunkColumn>(*live);
+
+        for (std::size_t i = 0; i < ChunkColumn::ChunksPerColumn; ++i) {
+            if (old && !(dirty & (1 << i)))
+                (*column)[i] = std::const_pointer_cast<Chunk>((*old)[i]);
+            else if ((*live)[i] && !(*live)[i]->IsShared())
+                (*column)[i] = std::make_shared<Chunk>(*(*live)[i]);
+        }
+
+        return ConstChunkColumnPtr(column);
+    };
+
+    if (m_SnapshotRebuild || !previous) {
+        snapshot->m_Columns.reserve(m_Chunks.size());
+
+        for (const auto& entry : m_Chunks) {
+            if (entry.second)
+                snapshot->m_Columns.emplace_back(entry.first, copyColumn(entry.second, nullptr, 0xFFFF));
+        }
+
+        if (m_ColdStore) {
+            // Cold columns are only written after they're taken out of the store, so the decompressed ones can be used as they are.
+            for (const auto& entry : *m_ColdStore)
+                snapshot->m_Columns.emplace_back(entry.first, m_ColdStore->Read(entry.first));
+
+            std::sort(snapshot->m_Columns.begin(), snapshot->m_Columns.end(),
+                [](const WorldSnapshot::Entry& first, const WorldSnapshot::Entry& second) { return first.first < second.first; });
+        }
+    } else {
+        // Both lists are sorted by coordinate, so merge them.
+        const auto& old = previous->m_Columns;
+        auto oldIter = old.begin();
+        auto dirtyIter = m_SnapshotDirty.begin();
+
+        snapshot->m_Columns.reserve(old.size() + m_SnapshotDirty.size());
+
+        while (oldIter != old.end() || dirtyIter != m_SnapshotDirty.end()) {
+            if (dirtyIter == m_SnapshotDirty.end() || (oldIter != old.end() && oldIter->first < dirtyIter->first)) {
+                snapshot->m_Columns.push_back(*oldIter++);
+                continue;
+            }
+
+            ConstChunkColumnPtr oldColumn;
+            if (oldIter != old.end() && oldIter->first == dirtyIter->first)
+                oldColumn = (oldIter++)->second;
+
+            auto live = m_Chunks.find(dirtyIter->first);
+            if (live != m_Chunks.end() && live->second) {
+                snapshot->m_Columns.emplace_back(dirtyIter->first, copyColumn(live->second, oldColumn, dirtyIter->second));
+            } else if (m_ColdStore && live == m_Chunks.end()) {
+                // Changed and then moved to cold storage before this publish.
+                ConstChunkColumnPtr cold = m_ColdStore->Read(dirtyIter->first);
+
+                if (cold)
+                    snapshot->m_Columns.emplace_back(dirtyIter->first, cold);
+            }
+
+            ++dirtyIter;
+        }
+    }
+
+    m_SnapshotDirty.clear();
+    m_SnapshotRebuild = false;
+
+    std::atomic_store(&m_Snapshot, WorldSnapshotPtr(snapshot));
+}
+
+ConstChunkColumnPtr World::GetChunk(Vector3i pos) const {
+    ChunkCoord coord = GetChunkCoord(pos);
+    auto iter = m_Chunks.find(coord);
+
+    if (iter == m_Chunks.end())
+        return m_ColdStore ? m_ColdStore->Get(coord) : nullptr;
 
     return iter->second;
 }
 
+ChunkColumnPtr World::GetChunk(Vector3i pos) {
+    return GetLiveColumn(GetChunkCoord(pos));
+}
+
+s32 World::GetHeight(s64 x, s64 z, HeightmapType type) const {
+    ConstChunkColumnPtr col = GetChunk(Vector3i(x, 0, z));
+
+    if (!col) return 0;
+
+    return col->GetHeight((s32)(x & 15), (s32)(z & 15), type);
+}
+
 block::BlockPtr World::GetBlock(Vector3f pos) const {
     return GetBlock(Vector3i((s64)std::floor(pos.x), (s64)std::floor(pos.y), (s64)std::floor(pos.z)));
 }
@@ -189,9 +747,9 @@ block::BlockPtr World::GetBlock(Vector3d pos) const {
 }
 
 block::BlockPtr World::GetBlock(Vector3i pos) const {
-    ChunkColumnPtr col = GetChunk(pos);
+    ConstChunkColumnPtr col = GetChunk(pos);
 
-    if (!col) return block::BlockRegistry::GetInstance()->GetBlock(0);
+    if (!col) return m_Registry->GetBlock(0);
 
     s64 x = pos.x % 16;
     s64 z = pos.z % 16;
@@ -204,8 +762,274 @@ block::BlockPtr World::GetBlock(Vector3i pos) const {
     return col->GetBlock(Vector3i(x, pos.y, z));
 }
 
+void World::ForEachBlockNearest(const BlockTypeSet& states, Vector3d center, double radius,
+    const std::function<bool(const Vector3i&, block::BlockPtr)>& visitor) const
+{
+    if (states.IsEmpty() || radius < 0) return;
+
+    const block::BlockRegistry* registry = m_Registry;
+    const double radiusSq = radius * radius;
+
+    auto columnInRange = [&](const ChunkCoord& coord) {
+        Vector3d min(coord.first * 16.0, 0.0, coord.second * 16.0);
+        return DistanceSqToBox(center, min, min + Vector3d(16.0, 256.0, 16.0)) <= radiusSq;
+    };
+
+    if (!m_IndexedStates.IsEmpty() && m_IndexedStates.Contains(states)) {
+        std::vector<BlockHit> hits;
+
+        for (const auto& entry : m_BlockIndex) {
+            if (!columnInRange(entry.first)) continue;
+
+            Vector3i origin(entry.first.first * 16, 0, entry.first.second * 16);
+
+            for (const auto& block : entry.second) {
+                if (!states.Contains(block.second)) continue;
+
+                Vector3i position = origin + Vector3i(block.first & 15, block.first >> 8, (block.first >> 4) & 15);
+                double distanceSq = BlockDistanceSq(center, position);
+
+                if (distanceSq <= radiusSq)
+                    hits.push_back(BlockHit{ distanceSq, position, block.second });
+            }
+        }
+
+        std::sort(hits.begin(), hits.end(), [](const BlockHit& lhs, const BlockHit& rhs) { return lhs.distanceSq < rhs.distanceSq; });
+
+        for (const BlockHit& hit : hits) {
+            if (!visitor(hit.position, registry->GetBlock(hit.data)))
+                return;
+        }
+        return;
+    }
+
+    std::vector<SectionCandidate> candidates;
+
+    auto addColumn = [&](const ChunkCoord& coord, const ChunkColumnPtr& column) {
+        if (!column) return;
+
+        for (s32 i = 0; i < ChunkColumn::ChunksPerColumn; ++i) {
+            ChunkPtr section = (*column)[i];
+
+            if (section ? !section->MayContain(states) : !states.Contains(0))
+                continue;
+
+            Vector3i origin(coord.first * 16, i * 16, coord.second * 16);
+            Vector3d min = ToVector3d(origin);
+            double distanceSq = DistanceSqToBox(center, min, min + Vector3d(16.0, 16.0, 16.0));
+
+            if (distanceSq <= radiusSq)
+                candidates.push_back(SectionCandidate{ distanceSq, origin, section });
+        }
+    };
+
+    for (const auto& entry : m_Chunks) {
+        if (columnInRange(entry.first))
+            addColumn(entry.first, entry.second);
+    }
+
+    if (m_ColdStore) {
+        for (const auto& entry : *m_ColdStore) {
+            if (columnInRange(entry.first))
+                addColumn(entry.first, m_ColdStore->Read(entry.first));
+        }
+    }
+
+    std::sort(candidates.begin(), candidates.end(), [](const SectionCandidate& lhs, const SectionCandidate& rhs) {
+        return lhs.distanceSq < rhs.distanceSq;
+    });
+
+    // A hit can be visited once no section left to scan can be closer than it.
+    std::priority_queue<BlockHit, std::vector<BlockHit>, std::greater<BlockHit>> hits;
+
+    for (const SectionCandidate& candidate : candidates) {
+        while (!hits.empty() && hits.top().distanceSq <= candidate.distanceSq) {
+            BlockHit hit = hits.top();
+            hits.pop();
+
+            if (!visitor(hit.position, registry->GetBlock(hit.data)))
+                return;
+        }
+
+        for (s32 index = 0; index < 16 * 16 * 16; ++index) {
+            Vector3i relative(index & 15, index >> 8, (index >> 4) & 15);
+            u32 data = candidate.section ? candidate.section->GetBlockData(relative) : 0;
+
+            if (!states.Contains(data)) continue;
+
+            Vector3i position = candidate.origin + relative;
+            double distanceSq = BlockDistanceSq(center, position);
+
+            if (distanceSq <= radiusSq)
+                hits.push(BlockHit{ distanceSq, position, data });
+        }
+    }
+
+    while (!hits.empty()) {
+        BlockHit hit = hits.top();
+        hits.pop();
+
+        if (!visitor(hit.position, registry->GetBlock(hit.data)))
+            return;
+    }
+}
+
+std::vector<Vector3i> World::FindBlocks(const BlockTypeSet& states, Vector3d center, double radius, std::size_t maxResults) const {
+    std::vector<Vector3i> result;
+
+    if (maxResults == 0) return result;
+
+    ForEachBlockNearest(states, center, radius, [&result, maxResults](const Vector3i& position, block::BlockPtr) {
+        result.push_back(position);
+        return result.size() < maxResults;
+    });
+
+    return result;
+}
+
+u32 World::GetBlockData(ColumnCursor& cursor, const Vector3i& pos) const {
+    if (pos.y < 0 || pos.y > 255) return 0;
+
+    ChunkCoord coord((s32)(pos.x >> 4), (s32)(pos.z >> 4));
+
+    if (!cursor.valid || cursor.coord != coord) {
+        cursor.coord = coord;
+        cursor.column = GetChunk(pos);
+        cursor.valid = true;
+    }
+
+    if (!cursor.column) return 0;
+
+    ChunkPtr section = (*cursor.column)[(std::size_t)(pos.y >> 4)];
+    if (!section) return 0;
+
+    return section->GetBlockData(Vector3i(pos.x & 15, pos.y & 15, pos.z & 15));
+}
+
+bool World::Raycast(ColumnCursor& cursor, const Ray& ray, double maxDistance, RaycastHit* hit) const {
+    const double length = ray.GetDirection().Length();
+    if (length == 0.0) return false;
+
+    const Ray normalized(ray.GetOrigin(), ray.GetDirection() / length);
+    const Vector3d& origin = normalized.GetOrigin();
+    const Vector3d& direction = normalized.GetDirection();
+    const block::BlockRegistry* registry = m_Registry;
+
+    // Amanatides-Woo traversal: step into whichever neighbor the ray reaches first.
+    Vector3i voxel((s64)std::floor(origin.x), (s64)std::floor(origin.y), (s64)std::floor(origin.z));
+    s64 step[3];
+    double next[3];
+    double delta[3];
+
+    for (std::size_t i = 0; i < 3; ++i) {
+        if (direction[i] > 0) {
+            step[i] = 1;
+            delta[i] = 1.0 / direction[i];
+            next[i] = (voxel[i] + 1 - origin[i]) * delta[i];
+        } else if (direction[i] < 0) {
+            step[i] = -1;
+            delta[i] = -1.0 / direction[i];
+            next[i] = (origin[i] - voxel[i]) * delta[i];
+        } else {
+            step[i] = 0;
+            delta[i] = std::numeric_limits<double>::infinity();
+            next[i] = std::numeric_limits<double>::infinity();
+        }
+    }
+
+    double closest = std::numeric_limits<double>::max();
+    RaycastHit result;
+
+    auto testBlock = [&](const Vector3i& position, block::BlockPtr block) {
+        for (const AABB& bounds : block->GetBoundingBoxes()) {
+            if (bounds.min == bounds.max) continue;
+
+            AABB box = bounds + position;
+            double distance;
+
+            if (!box.Intersects(normalized, &distance)) continue;
+
+            distance = std::max(distance, 0.0);
+
+            if (distance < closest) {
+                std::size_t axis = GetEntryAxis(box, normalized);
+
+                closest = distance;
+                result.block = block;
+                result.position = position;
+                result.face = GetEntryFace(axis, direction[axis]);
+                result.distance = distance;
+            }
+        }
+    };
+
+    double traveled = 0.0;
+
+    while (traveled <= maxDistance) {
+        u32 data = GetBlockData(cursor, voxel);
+
+        if (data != 0) {
+            block::BlockPtr block = registry->GetBlock(data);
+
+            if (block)
+                testBlock(voxel, block);
+        }
+
+        // Fences and walls stick out into the block above them.
+        Vector3i below(voxel.x, voxel.y - 1, voxel.z);
+        u32 belowData = GetBlockData(cursor, below);
+
+        if (belowData != 0) {
+            block::BlockPtr block = registry->GetBlock(belowData);
+
+            if (block && block->GetBoundingBox().max.y > 1.0)
+                testBlock(below, block);
+        }
+
+        if (result.block) {
+            if (result.distance > maxDistance) return false;
+
+            if (hit)
+                *hit = result;
+            return true;
+        }
+
+        std::size_t axis = 0;
+        if (next[1] < next[axis]) axis = 1;
+        if (next[2] < next[axis]) axis = 2;
+
+        traveled = next[axis];
+        voxel[axis] += step[axis];
+        next[axis] += delta[axis];
+
+        // Nothing outside of the world height to hit once the ray leaves it.
+        if ((voxel.y < 0 && step[1] <= 0) || (voxel.y > 256 && step[1] >= 0))
+            break;
+    }
+
+    return false;
+}
+
+bool World::Raycast(const Ray& ray, double maxDistance, RaycastHit* hit) const {
+    ColumnCursor cursor;
+
+    return Raycast(cursor, ray, maxDistance, hit);
+}
+
+std::vector<RaycastHit> World::Raycast(const std::vector<Ray>& rays, double maxDistance) const {
+    std::vector<RaycastHit> hits(rays.size());
+    ColumnCursor cursor;
+
+    for (std::size_t i = 0; i < rays.size(); ++i) {
+        if (!Raycast(cursor, rays[i], maxDistance, &hits[i]))
+            hits[i] = RaycastHit();
+    }
+
+    return hits;
+}
+
 block::BlockEntityPtr World::GetBlockEntity(Vector3i pos) const {
-    ChunkColumnPtr col = GetChunk(pos);
+    ConstChunkColumnPtr col = GetChunk(pos);
 
     if (!col) return nullptr;
 
@@ -222,6 +1046,11 @@ std::vector<block::BlockEntityPtr> World::GetBlockEntities() const {
         blockEntities.insert(blockEntities.end(), chunkBlockEntities.begin(), chunkBlockEntities.end());
     }
 
+    if (m_ColdStore) {
+        std::vector<block::BlockEntityPtr> coldBlockEntities = m_ColdStore->GetBlockEntities();
+        blockEntities.insert(blockEntities.end(), coldBlockEntities.begin(), coldBlockEntities.end());
+    }
+
     return blockEntities;
 }
 
@@ -0,0 +1,50 @@
+#include <mclib/world/WorldSnapshot.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace mc {
+namespace world {
+
+WorldSnapshot::WorldSnapshot() : m_Version(0), m_Registry(block::BlockRegistry::GetInstance()) {
+
+}
+
+ConstChunkColumnPtr WorldSnapshot::GetChunk(s32 chunkX, s32 chunkZ) const {
+    ChunkCoord key(chunkX, chunkZ);
+
+    auto iter = std::lower_bound(m_Columns.begin(), m_Columns.end(), key, [](const Entry& entry, const ChunkCoord& coord) {
+        return entry.first < coord;
+    });
+
+    if (iter == m_Columns.end() || iter->first != key) return nullptr;
+
+    return iter->second;
+}
+
+ConstChunkColumnPtr WorldSnapshot::GetChunk(Vector3i pos) const {
+    return GetChunk((s32)std::floor(pos.x / 16.0), (s32)std::floor(pos.z / 16.0));
+}
+
+block::BlockPtr WorldSnapshot::GetBlock(Vector3d pos) const {
+    return GetBlock(Vector3i((s64)std::floor(pos.x), (s64)std::floor(pos.y), (s64)std::floor(pos.z)));
+}
+
+block::BlockPtr WorldSnapshot::GetBlock(Vector3i pos) const {
+    ConstChunkColumnPtr col = GetChunk(pos);
+
+    if (!col) return m_Registry->GetBlock(0);
+
+    s64 x = pos.x % 16;
+    s64 z = pos.z % 16;
+
+    if (x < 0)
+        x += 16;
+    if (z < 0)
+        z += 16;
+
+    return col->GetBlock(Vector3i(x, pos.y, z));
+}
+
+} // ns world
+} // ns mc
@@ -0,0 +1,146 @@
+#include "catch.hpp"
+
+#include <mclib/util/Chat.h>
+
+#include <string>
+
+using mc::util::ChatColor;
+using mc::util::ChatFormat;
+using mc::util::ChatMessage;
+using mc::util::ChatParser;
+
+namespace {
+
+// The section sign that starts legacy formatting codes, in utf-8
+const std::string Section = "\xC2\xA7";
+
+} // ns
+
+TEST_CASE("Chat parses plain components", "[Chat]") {
+    SECTION("bare string") {
+        REQUIRE(mc::util::GetChatText("\"hello\"") == "hello");
+    }
+
+    SECTION("text with extra") {
+        const std::string json = R"({"text":"a","extra":["b",{"text":"c","extra":[{"text":"d"}]}]})";
+
+        REQUIRE(mc::util::GetChatText(json) == "abcd");
+        REQUIRE(mc::util::ParseChat(json).GetText() == "abcd");
+    }
+
+    SECTION("top level array") {
+        REQUIRE(mc::util::GetChatText(R"(["x",{"text":"y"},5,true])") == "xy5true");
+    }
+}
+
+TEST_CASE("Chat styles are inherited by extra components", "[Chat]") {
+    const std::string json = R"({"text":"red ","color":"red","bold":true,"extra":[{"text":"plain","bold":false},{"text":" blue","color":"blue"}]})";
+    ChatMessage message = mc::util::ParseChat(json);
+
+    REQUIRE(message.GetText() == "red plain blue");
+
+    const auto& runs = message.GetRuns();
+    REQUIRE(runs.size() == 3);
+
+    REQUIRE(message.GetRunText(runs[0]) == "red ");
+    REQUIRE(runs[0].color == ChatColor::Red);
+    REQUIRE(runs[0].format == ChatFormat::Bold);
+
+    REQUIRE(message.GetRunText(runs[1]) == "plain");
+    REQUIRE(runs[1].color == ChatColor::Red);
+    REQUIRE(runs[1].format == 0);
+
+    REQUIRE(message.GetRunText(runs[2]) == " blue");
+    REQUIRE(runs[2].color == ChatColor::Blue);
+    REQUIRE(runs[2].format == ChatFormat::Bold);
+}
+
+TEST_CASE("Chat fills in translations", "[Chat]") {
+    SECTION("known translation") {
+        const std::string json = R"({"translate":"chat.type.text","with":[{"text":"Steve","color":"gold"},"hi there"]})";
+        ChatMessage message = mc::util::ParseChat(json);
+
+        REQUIRE(message.GetText() == "<Steve> hi there");
+
+        const auto& runs = message.GetRuns();
+        REQUIRE(runs.size() == 3);
+        REQUIRE(message.GetRunText(runs[1]) == "Steve");
+        REQUIRE(runs[1].color == ChatColor::Gold);
+        REQUIRE(runs[0].color == ChatColor::Reset);
+    }
+
+    SECTION("translation nested in an argument") {
+        const std::string json = R"({"translate":"chat.type.announcement","with":["Server",{"translate":"multiplayer.player.joined","with":["Alex"]}]})";
+
+        REQUIRE(mc::util::GetChatText(json) == "[Server] Alex joined the game");
+    }
+
+    SECTION("unknown translation joins the arguments") {
+        REQUIRE(mc::util::GetChatText(R"({"translate":"some.key","with":["a","b","c"]})") == "a b c");
+    }
+
+    SECTION("translation wins over text") {
+        REQUIRE(mc::util::GetChatText(R"({"text":"ignored","translate":"multiplayer.player.left","with":["Alex"]})") == "Alex left the game");
+    }
+
+    SECTION("extra after a translation") {
+        REQUIRE(mc::util::GetChatText(R"({"translate":"multiplayer.player.left","with":["Alex"],"extra":["!"]})") == "Alex left the game!");
+    }
+}
+
+TEST_CASE("Chat applies legacy formatting codes", "[Chat]") {
+    const std::string json = "\"" + Section + "cRed " + Section + "lbold" + Section + "r reset\"";
+    ChatMessage message = mc::util::ParseChat(json);
+
+    REQUIRE(message.GetText() == "Red bold reset");
+
+    const auto& runs = message.GetRuns();
+    REQUIRE(runs.size() == 3);
+    REQUIRE(runs[0].color == ChatColor::Red);
+    REQUIRE(runs[0].format == 0);
+    REQUIRE(runs[1].color == ChatColor::Red);
+    REQUIRE(runs[1].format == ChatFormat::Bold);
+    REQUIRE(runs[2].color == ChatColor::Reset);
+    REQUIRE(runs[2].format == 0);
+
+    SECTION("codes carry into extra components") {
+        ChatMessage extra = mc::util::ParseChat("{\"text\":\"" + Section + "2green \",\"extra\":[\"still\"]}");
+
+        REQUIRE(extra.GetText() == "green still");
+        REQUIRE(extra.GetRuns().size() == 1);
+        REQUIRE(extra.GetRuns()[0].color == ChatColor::DarkGreen);
+    }
+
+    SECTION("plain text extraction drops the codes") {
+        REQUIRE(mc::util::GetChatText(json) == "Red bold reset");
+    }
+}
+
+TEST_CASE("Chat skips values that aren't text", "[Chat]") {
+    const std::string json = R"({"text":"click me","hoverEvent":{"action":"show_text","value":{"text":"hidden","extra":["also hidden"]}},"clickEvent":{"action":"run_command","value":"/hidden"},"insertion":"hidden","extra":[{"text":"!","hoverEvent":{"action":"show_text","value":["hidden"]}}]})";
+
+    REQUIRE(mc::util::GetChatText(json) == "click me!");
+}
+
+TEST_CASE("Chat reports malformed json", "[Chat]") {
+    ChatParser parser;
+    ChatMessage message;
+    std::string text;
+
+    SECTION("truncated input keeps what was read") {
+        REQUIRE_FALSE(parser.Parse(R"({"text":"partial","extra":["more")", &message));
+        REQUIRE(message.GetText() == "partialmore");
+    }
+
+    SECTION("garbage") {
+        REQUIRE_FALSE(parser.ParseText("{not json", &text));
+        REQUIRE_FALSE(parser.ParseText("", &text));
+        REQUIRE(text.empty());
+    }
+
+    SECTION("the parser is usable after an error") {
+        REQUIRE_FALSE(parser.ParseText("[\"a\",", &text));
+        REQUIRE(parser.ParseText("\"b\"", &text));
+        REQUIRE(text == "b");
+    }
+}
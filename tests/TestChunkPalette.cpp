@@ -0,0 +1,269 @@
+#include "catch.hpp"
+
+#include <mclib/block/Block.h>
+#include <mclib/common/DataBuffer.h>
+#include <mclib/common/VarInt.h>
+#include <mclib/protocol/packets/Packet.h>
+#include <mclib/protocol/packets/PacketDispatcher.h>
+#include <mclib/world/Chunk.h>
+#include <mclib/world/SectionStore.h>
+#include <mclib/world/World.h>
+
+#include <map>
+#include <random>
+#include <vector>
+
+namespace {
+
+// Every registered block data value, so each one maps back to itself.
+const std::vector<u32>& GetBlockStates() {
+    static std::vector<u32> states;
+
+    if (!states.empty()) return states;
+
+    mc::block::BlockRegistry* registry = mc::block::BlockRegistry::GetInstance();
+
+    registry->RegisterVanillaBlocks(mc::protocol::Version::Minecraft_1_11_2);
+
+    for (u32 data = 0; data < (1 << 13); ++data) {
+        mc::block::BlockPtr block = registry->GetBlock(data);
+
+        if (block && block->GetType() == data)
+            states.push_back(data);
+    }
+
+    return states;
+}
+
+mc::Vector3i GetPosition(std::size_t index) {
+    return mc::Vector3i(index & 15, (index >> 8) & 15, (index >> 4) & 15);
+}
+
+} // ns
+
+TEST_CASE("Chunk palette grows without corrupting blocks", "[Chunk]") {
+    const std::vector<u32>& states = GetBlockStates();
+    mc::block::BlockRegistry* registry = mc::block::BlockRegistry::GetInstance();
+
+    REQUIRE(states.size() > 256);
+
+    mc::world::Chunk chunk;
+    std::vector<u32> expected(16 * 16 * 16, 0);
+
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        expected[i] = states[(i * 7) % 40];
+        chunk.SetBlock(GetPosition(i), registry->GetBlock(expected[i]));
+    }
+
+    REQUIRE(chunk.GetBitsPerBlock() == 6);
+    REQUIRE(!chunk.IsDirect());
+
+    for (std::size_t i = 0; i < expected.size(); ++i)
+        REQUIRE(chunk.GetBlock(GetPosition(i), registry)->GetType() == expected[i]);
+}
+
+TEST_CASE("Chunk switches to the global palette", "[Chunk]") {
+    const std::vector<u32>& states = GetBlockStates();
+    mc::block::BlockRegistry* registry = mc::block::BlockRegistry::GetInstance();
+
+    mc::world::Chunk chunk;
+    std::vector<u32> expected(16 * 16 * 16, 0);
+
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        expected[i] = states[i % states.size()];
+        chunk.SetBlock(GetPosition(i), registry->GetBlock(expected[i]));
+    }
+
+    REQUIRE(chunk.IsDirect());
+    REQUIRE(chunk.GetBitsPerBlock() == mc::world::Chunk::GlobalPaletteBits);
+
+    for (std::size_t i = 0; i < expected.size(); ++i)
+        REQUIRE(chunk.GetBlock(GetPosition(i), registry)->GetType() == expected[i]);
+
+    // Copies have to read the same.
+    mc::world::Chunk copy(chunk);
+
+    for (std::size_t i = 0; i < expected.size(); i += 97)
+        REQUIRE(copy.GetBlock(GetPosition(i), registry)->GetType() == expected[i]);
+}
+
+TEST_CASE("Chunk fits every state of the flattened registry", "[Chunk]") {
+    const mc::block::BlockRegistry* registry = mc::block::BlockRegistry::GetInstance(mc::protocol::Version::Minecraft_1_13_2);
+    const u32 count = (u32)registry->GetStateCount();
+
+    // More states than 13 bits can hold
+    REQUIRE(count > (1 << 13));
+    REQUIRE(mc::world::Chunk::GetDirectBits(registry) == 14);
+    REQUIRE(mc::world::Chunk::GetDirectBits(mc::block::BlockRegistry::GetInstance(mc::protocol::Version::Minecraft_1_12_2)) == 13);
+
+    SECTION("palette growth switches to enough bits") {
+        mc::world::Chunk chunk;
+        std::vector<u32> expected(16 * 16 * 16, 0);
+
+        // Counting down from the last state, so the highest ones are in the palette before it runs out.
+        for (std::size_t i = 0; i < expected.size(); ++i) {
+            mc::block::BlockPtr block = registry->GetBlock(count - 1 - (u32)(i % 600));
+
+            REQUIRE(block);
+            expected[i] = block->GetType();
+            chunk.SetBlock(GetPosition(i), block, registry);
+        }
+
+        REQUIRE(chunk.IsDirect());
+        REQUIRE(chunk.GetBitsPerBlock() == 14);
+
+        for (std::size_t i = 0; i < expected.size(); ++i)
+            REQUIRE(chunk.GetBlock(GetPosition(i), registry)->GetType() == expected[i]);
+    }
+
+    SECTION("narrower direct sections are widened") {
+        mc::DataBuffer buffer;
+
+        buffer << (u8)13 << mc::VarInt(0) << mc::VarInt(16 * 16 * 16 * 13 / 64);
+        for (int i = 0; i < 16 * 16 * 16 * 13 / 64; ++i)
+            buffer << (u64)0;
+
+        mc::world::Chunk chunk;
+        chunk.Deserialize(buffer);
+
+        chunk.SetBlock(GetPosition(0), registry->GetBlock(100), registry);
+        REQUIRE(chunk.GetBitsPerBlock() == 13);
+
+        mc::block::BlockPtr last = registry->GetBlock(count - 1);
+
+        REQUIRE(last->GetType() >= (1 << 13));
+        chunk.SetBlock(GetPosition(1), last, registry);
+        REQUIRE(chunk.GetBitsPerBlock() == 14);
+
+        REQUIRE(chunk.GetBlockData(GetPosition(0)) == 100);
+        REQUIRE(chunk.GetBlockData(GetPosition(1)) == last->GetType());
+        REQUIRE(chunk.GetBlockData(GetPosition(2)) == 0);
+    }
+}
+
+TEST_CASE("Chunk compacts unused palette entries", "[Chunk]") {
+    const std::vector<u32>& states = GetBlockStates();
+    mc::block::BlockRegistry* registry = mc::block::BlockRegistry::GetInstance();
+
+    mc::world::Chunk chunk;
+
+    for (std::size_t i = 0; i < 100; ++i)
+        chunk.SetBlock(GetPosition(i), registry->GetBlock(states[i]));
+
+    REQUIRE(chunk.GetBitsPerBlock() == 7);
+
+    // Overwrite everything with two states, the other palette entries are unused now.
+    for (std::size_t i = 0; i < 100; ++i)
+        chunk.SetBlock(GetPosition(i), registry->GetBlock(states[1 + (i & 1)]));
+
+    REQUIRE(chunk.Compact());
+    REQUIRE(chunk.GetBitsPerBlock() == 4);
+    REQUIRE(chunk.GetPaletteSize() == 3);
+    REQUIRE(!chunk.Compact());
+
+    for (std::size_t i = 0; i < 100; ++i)
+        REQUIRE(chunk.GetBlock(GetPosition(i), registry)->GetType() == states[1 + (i & 1)]);
+
+    REQUIRE(chunk.GetBlock(GetPosition(4000), registry)->GetType() == 0);
+}
+
+TEST_CASE("Chunk copies never inherit the shared flag", "[Chunk]") {
+    const std::vector<u32>& states = GetBlockStates();
+    mc::block::BlockRegistry* registry = mc::block::BlockRegistry::GetInstance();
+
+    auto original = std::make_shared<mc::world::Chunk>();
+
+    for (std::size_t i = 0; i < 20; ++i)
+        original->SetBlock(GetPosition(i), registry->GetBlock(states[i]));
+
+    mc::world::ChunkPtr shared = mc::world::SectionStore::GetInstance().Intern(original);
+    REQUIRE(shared->IsShared());
+
+    SECTION("copy construction") {
+        mc::world::Chunk copy(*shared);
+
+        REQUIRE(!copy.IsShared());
+    }
+
+    SECTION("assigning from a shared section") {
+        mc::world::Chunk copy;
+
+        copy = *shared;
+        REQUIRE(!copy.IsShared());
+        REQUIRE(copy.GetBlock(GetPosition(5), registry)->GetType() == states[5]);
+    }
+
+    SECTION("assigning into a shared section") {
+        auto unique = std::make_shared<mc::world::Chunk>();
+        unique->SetBlock(GetPosition(0), registry->GetBlock(states[50]));
+
+        mc::world::ChunkPtr target = mc::world::SectionStore::GetInstance().Intern(unique);
+        REQUIRE(target->IsShared());
+
+        *target = mc::world::Chunk();
+        REQUIRE(!target->IsShared());
+    }
+
+    SECTION("assigning replaces the palette index") {
+        mc::world::Chunk replacement;
+        replacement.SetBlock(GetPosition(0), registry->GetBlock(states[30]));
+
+        mc::world::Chunk target(*shared);
+        // Builds the palette index for the old palette, which must not survive the assignment.
+        target.SetBlock(GetPosition(1), registry->GetBlock(states[1]));
+
+        target = replacement;
+        target.SetBlock(GetPosition(2), registry->GetBlock(states[30]));
+        target.SetBlock(GetPosition(3), registry->GetBlock(states[3]));
+
+        REQUIRE(target.GetBlock(GetPosition(0), registry)->GetType() == states[30]);
+        REQUIRE(target.GetBlock(GetPosition(2), registry)->GetType() == states[30]);
+        REQUIRE(target.GetBlock(GetPosition(3), registry)->GetType() == states[3]);
+        REQUIRE(target.GetBlock(GetPosition(1), registry)->GetType() == 0);
+    }
+}
+
+TEST_CASE("World applies MultiBlockChange streams correctly", "[Chunk]") {
+    const std::vector<u32>& states = GetBlockStates();
+
+    mc::protocol::packets::PacketDispatcher dispatcher;
+    mc::world::World world(&dispatcher);
+
+    {
+        // Empty column with no sections
+        mc::DataBuffer buffer;
+        buffer << (s32)0 << (s32)0 << false << mc::VarInt(0) << mc::VarInt(0) << mc::VarInt(0);
+
+        mc::protocol::packets::in::ChunkDataPacket packet;
+        packet.Deserialize(buffer, buffer.GetSize());
+        world.HandlePacket(&packet);
+    }
+
+    std::mt19937 random(1234);
+    std::map<mc::Vector3i, u32> expected;
+
+    for (s32 round = 0; round < 200; ++round) {
+        // Later rounds use more distinct states so the palette keeps growing until it's direct.
+        std::size_t stateCount = std::min<std::size_t>(states.size(), 2 + round * 2);
+        mc::DataBuffer buffer;
+
+        buffer << (s32)0 << (s32)0 << mc::VarInt(64);
+
+        for (s32 i = 0; i < 64; ++i) {
+            u8 x = random() & 15;
+            u8 z = random() & 15;
+            u8 y = random() & 31;
+            u32 data = states[random() % stateCount];
+
+            buffer << (u8)((x << 4) | z) << y << mc::VarInt((s32)data);
+            expected[mc::Vector3i(x, y, z)] = data;
+        }
+
+        mc::protocol::packets::in::MultiBlockChangePacket packet;
+        packet.Deserialize(buffer, buffer.GetSize());
+        world.HandlePacket(&packet);
+    }
+
+    for (const auto& entry : expected)
+        REQUIRE(world.GetBlock(entry.first)->GetType() == entry.second);
+}
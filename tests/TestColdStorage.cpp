@@ -0,0 +1,295 @@
+#include "catch.hpp"
+
+#include <mclib/block/Block.h>
+#include <mclib/common/DataBuffer.h>
+#include <mclib/common/Position.h>
+#include <mclib/common/VarInt.h>
+#include <mclib/protocol/packets/Packet.h>
+#include <mclib/protocol/packets/PacketDispatcher.h>
+#include <mclib/world/World.h>
+#include <mclib/world/WorldSnapshot.h>
+
+#include <iterator>
+#include <utility>
+
+namespace {
+
+const u32 Stone = 1 << 4;
+const u32 Dirt = 3 << 4;
+const u32 Glass = 20 << 4;
+
+const mc::block::BlockRegistry* GetRegistry() {
+    return mc::block::BlockRegistry::GetInstance(mc::protocol::Version::Minecraft_1_12_2);
+}
+
+void CreateColumn(mc::world::World& world, s32 x, s32 z) {
+    mc::DataBuffer buffer;
+
+    buffer << x << z << false << mc::VarInt(0) << mc::VarInt(0) << mc::VarInt(0);
+
+    mc::protocol::packets::in::ChunkDataPacket packet;
+    packet.Deserialize(buffer, buffer.GetSize());
+    world.HandlePacket(&packet);
+}
+
+void SetBlock(mc::world::World& world, const mc::Vector3i& position, u32 blockData) {
+    mc::DataBuffer buffer;
+
+    buffer << mc::Position(position.x, position.y, position.z) << mc::VarInt((s32)blockData);
+
+    mc::protocol::packets::in::BlockChangePacket packet;
+    packet.Deserialize(buffer, buffer.GetSize());
+    world.HandlePacket(&packet);
+}
+
+u32 GetBlock(const mc::world::World& world, const mc::Vector3i& position) {
+    return world.GetBlock(position)->GetType();
+}
+
+// Columns 0 to count - 1 along x, each with a stone block at 1, 64, 1 and a dirt block at 2, 100, 2.
+void CreateColumns(mc::world::World& world, s32 count) {
+    for (s32 x = 0; x < count; ++x) {
+        CreateColumn(world, x, 0);
+        SetBlock(world, mc::Vector3i(x * 16 + 1, 64, 1), Stone);
+        SetBlock(world, mc::Vector3i(x * 16 + 2, 100, 2), Dirt);
+    }
+}
+
+// Only the column x stays hot.
+void MoveCenter(mc::world::World& world, s32 x) {
+    world.UpdateColdStorage(mc::Vector3d(x * 16 + 8, 64, 8));
+}
+
+std::size_t GetColumnUsage(const mc::world::World& world, s32 x) {
+    return world.GetChunk(mc::Vector3i(x * 16, 0, 0))->GetMemoryUsage();
+}
+
+} // ns
+
+TEST_CASE("Cold columns keep their blocks", "[ColdStorage]") {
+    mc::protocol::packets::PacketDispatcher dispatcher;
+    mc::world::World world(&dispatcher, GetRegistry());
+
+    CreateColumns(world, 4);
+    world.EnableColdStorage(0, 1024 * 1024);
+    MoveCenter(world, 0);
+
+    mc::world::ColdColumnStats stats = world.GetColdStorageStats();
+
+    REQUIRE(stats.columns == 3);
+    REQUIRE(stats.compressedBytes > 0);
+    REQUIRE(stats.cachedColumns == 0);
+
+    // Iterating only sees the hot column.
+    REQUIRE(std::distance(world.begin(), world.end()) == 1);
+
+    SECTION("reads go through the cache") {
+        const mc::world::World& reader = world;
+
+        REQUIRE(GetBlock(reader, mc::Vector3i(17, 64, 1)) == Stone);
+        REQUIRE(GetBlock(reader, mc::Vector3i(18, 100, 2)) == Dirt);
+        REQUIRE(GetBlock(reader, mc::Vector3i(19, 64, 1)) == 0);
+
+        stats = world.GetColdStorageStats();
+
+        // Reading doesn't move the column out of cold storage.
+        REQUIRE(stats.columns == 3);
+        REQUIRE(stats.cachedColumns == 1);
+        REQUIRE(stats.misses == 1);
+        REQUIRE(stats.hits == 2);
+        REQUIRE(stats.cachedBytes == GetColumnUsage(world, 1));
+    }
+
+    SECTION("changes move the column back first") {
+        SetBlock(world, mc::Vector3i(33, 64, 1), Glass);
+
+        REQUIRE(world.GetColdStorageStats().columns == 2);
+        REQUIRE(GetBlock(world, mc::Vector3i(33, 64, 1)) == Glass);
+        REQUIRE(GetBlock(world, mc::Vector3i(34, 100, 2)) == Dirt);
+
+        // The change survives another trip through the store.
+        world.UpdateColdStorage(mc::Vector3d(-100, 64, 0));
+
+        REQUIRE(world.GetColdStorageStats().columns == 4);
+        REQUIRE(GetBlock(world, mc::Vector3i(33, 64, 1)) == Glass);
+        REQUIRE(GetBlock(world, mc::Vector3i(1, 64, 1)) == Stone);
+    }
+
+    SECTION("writes through GetChunk aren't lost") {
+        mc::world::ChunkColumnPtr column = world.GetChunk(mc::Vector3i(48, 0, 0));
+
+        REQUIRE(column);
+        REQUIRE(world.GetColdStorageStats().columns == 2);
+
+        (*column)[4]->SetBlock(mc::Vector3i(3, 0, 3), GetRegistry()->GetBlock(Glass));
+        column.reset();
+
+        world.UpdateColdStorage(mc::Vector3d(-100, 64, 0));
+        REQUIRE(world.GetColdStorageStats().columns == 4);
+
+        REQUIRE(GetBlock(world, mc::Vector3i(51, 64, 3)) == Glass);
+        REQUIRE(GetBlock(world, mc::Vector3i(49, 64, 1)) == Stone);
+    }
+
+    SECTION("moving the center promotes columns") {
+        MoveCenter(world, 2);
+
+        stats = world.GetColdStorageStats();
+
+        REQUIRE(stats.columns == 3);
+        REQUIRE(world.begin()->first == std::make_pair(2, 0));
+        REQUIRE(GetBlock(world, mc::Vector3i(33, 64, 1)) == Stone);
+        REQUIRE(GetBlock(world, mc::Vector3i(1, 64, 1)) == Stone);
+    }
+
+    SECTION("disabling promotes every column") {
+        world.DisableColdStorage();
+
+        REQUIRE_FALSE(world.IsColdStorageEnabled());
+        REQUIRE(std::distance(world.begin(), world.end()) == 4);
+
+        for (s32 x = 0; x < 4; ++x) {
+            REQUIRE(GetBlock(world, mc::Vector3i(x * 16 + 1, 64, 1)) == Stone);
+            REQUIRE(GetBlock(world, mc::Vector3i(x * 16 + 2, 100, 2)) == Dirt);
+        }
+    }
+}
+
+TEST_CASE("Cold column cache stays within its budget", "[ColdStorage]") {
+    mc::protocol::packets::PacketDispatcher dispatcher;
+    mc::world::World world(&dispatcher, GetRegistry());
+    const mc::world::World& reader = world;
+
+    CreateColumns(world, 4);
+    world.EnableColdStorage(0, 0);
+    MoveCenter(world, 0);
+
+    // Decompressed columns use less than live ones, so the size is taken from a cached one.
+    std::size_t usage = GetColumnUsage(world, 1);
+
+    // Room for two columns
+    world.EnableColdStorage(0, usage * 2);
+
+    REQUIRE(GetBlock(reader, mc::Vector3i(33, 64, 1)) == Stone);
+    REQUIRE(world.GetColdStorageStats().cachedColumns == 2);
+
+    // Reading column 1 again leaves 2 as the least recently used, so it's evicted for 3.
+    REQUIRE(GetBlock(reader, mc::Vector3i(17, 64, 1)) == Stone);
+    REQUIRE(GetBlock(reader, mc::Vector3i(49, 64, 1)) == Stone);
+
+    mc::world::ColdColumnStats stats = world.GetColdStorageStats();
+
+    REQUIRE(stats.cachedColumns == 2);
+    REQUIRE(stats.cachedBytes <= usage * 2);
+    REQUIRE(stats.misses == 3);
+    REQUIRE(stats.hits == 1);
+
+    REQUIRE(GetBlock(reader, mc::Vector3i(17, 64, 1)) == Stone);
+    REQUIRE(world.GetColdStorageStats().hits == 2);
+
+    REQUIRE(GetBlock(reader, mc::Vector3i(33, 64, 1)) == Stone);
+    REQUIRE(world.GetColdStorageStats().misses == 4);
+
+    SECTION("a smaller budget trims the cache") {
+        world.EnableColdStorage(0, usage);
+
+        // The most recent column stays when the budget only fits one.
+        REQUIRE(GetBlock(reader, mc::Vector3i(33, 64, 1)) == Stone);
+        stats = world.GetColdStorageStats();
+
+        REQUIRE(stats.cachedColumns == 1);
+        REQUIRE(stats.cachedBytes <= usage);
+    }
+
+    SECTION("promoting a column drops its cached copy") {
+        MoveCenter(world, 2);
+
+        stats = world.GetColdStorageStats();
+
+        REQUIRE(stats.columns == 3);
+        REQUIRE(stats.cachedColumns == 1);
+    }
+}
+
+TEST_CASE("Snapshots keep cold columns", "[ColdStorage]") {
+    mc::protocol::packets::PacketDispatcher dispatcher;
+    mc::world::World world(&dispatcher, GetRegistry());
+
+    CreateColumns(world, 3);
+
+    SECTION("columns that go cold after a publish") {
+        world.GetSnapshot();
+        world.PublishSnapshot();
+        REQUIRE(world.GetSnapshot()->GetColumnCount() == 3);
+
+        world.EnableColdStorage(0, 0);
+        MoveCenter(world, 0);
+
+        // Moving a column doesn't change any blocks, so there's nothing new to publish.
+        u64 version = world.GetSnapshot()->GetVersion();
+        world.PublishSnapshot();
+        REQUIRE(world.GetSnapshot()->GetVersion() == version);
+
+        SetBlock(world, mc::Vector3i(5, 64, 5), Glass);
+        world.PublishSnapshot();
+
+        mc::world::WorldSnapshotPtr snapshot = world.GetSnapshot();
+
+        REQUIRE(snapshot->GetColumnCount() == 3);
+        REQUIRE(snapshot->GetBlock(mc::Vector3i(5, 64, 5))->GetType() == Glass);
+        REQUIRE(snapshot->GetBlock(mc::Vector3i(17, 64, 1))->GetType() == Stone);
+        REQUIRE(snapshot->GetBlock(mc::Vector3i(34, 100, 2))->GetType() == Dirt);
+    }
+
+    SECTION("columns that are already cold on the first publish") {
+        world.EnableColdStorage(0, 0);
+        MoveCenter(world, 0);
+
+        world.GetSnapshot();
+        world.PublishSnapshot();
+
+        mc::world::WorldSnapshotPtr snapshot = world.GetSnapshot();
+
+        REQUIRE(snapshot->GetColumnCount() == 3);
+        REQUIRE(snapshot->GetBlock(mc::Vector3i(1, 64, 1))->GetType() == Stone);
+        REQUIRE(snapshot->GetBlock(mc::Vector3i(33, 64, 1))->GetType() == Stone);
+
+        // Sorted, so lookups by coordinate find them.
+        REQUIRE(snapshot->GetChunk(2, 0));
+        REQUIRE(snapshot->GetChunk(3, 0) == nullptr);
+    }
+
+    SECTION("columns changed and moved before the publish") {
+        world.GetSnapshot();
+        world.PublishSnapshot();
+
+        SetBlock(world, mc::Vector3i(33, 64, 1), Glass);
+        world.EnableColdStorage(0, 0);
+        MoveCenter(world, 0);
+        world.PublishSnapshot();
+
+        mc::world::WorldSnapshotPtr snapshot = world.GetSnapshot();
+
+        REQUIRE(snapshot->GetColumnCount() == 3);
+        REQUIRE(snapshot->GetBlock(mc::Vector3i(33, 64, 1))->GetType() == Glass);
+    }
+
+    SECTION("unloaded cold columns are dropped") {
+        world.GetSnapshot();
+        world.PublishSnapshot();
+        world.EnableColdStorage(0, 0);
+        MoveCenter(world, 0);
+
+        mc::DataBuffer buffer;
+        buffer << (s32)1 << (s32)0;
+
+        mc::protocol::packets::in::UnloadChunkPacket packet;
+        packet.Deserialize(buffer, buffer.GetSize());
+        world.HandlePacket(&packet);
+        world.PublishSnapshot();
+
+        REQUIRE(world.GetColdStorageStats().columns == 1);
+        REQUIRE(world.GetSnapshot()->GetColumnCount() == 2);
+        REQUIRE(world.GetSnapshot()->GetChunk(1, 0) == nullptr);
+    }
+}
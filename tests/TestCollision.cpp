@@ -0,0 +1,274 @@
+#include "catch.hpp"
+
+#include <mclib/block/Block.h>
+#include <mclib/common/AABB.h>
+#include <mclib/common/DataBuffer.h>
+#include <mclib/common/VarInt.h>
+#include <mclib/protocol/packets/Packet.h>
+#include <mclib/protocol/packets/PacketDispatcher.h>
+#include <mclib/world/Collision.h>
+#include <mclib/world/World.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace {
+
+const u32 Stone = 1 << 4;
+// Not vanilla types, the vanilla blocks are all full cubes.
+const u32 Slab = 410 << 4;
+const u32 Fence = 411 << 4;
+
+mc::block::BlockRegistry* GetRegistry() {
+    mc::block::BlockRegistry* registry = mc::block::BlockRegistry::GetInstance();
+
+    registry->RegisterVanillaBlocks(mc::protocol::Version::Minecraft_1_12_2);
+
+    if (!registry->GetBlock(Slab))
+        registry->RegisterBlock(new mc::block::Block("test:slab", Slab, true, mc::AABB(mc::Vector3d(0, 0, 0), mc::Vector3d(1, 0.5, 1))));
+    if (!registry->GetBlock(Fence))
+        registry->RegisterBlock(new mc::block::Block("test:fence", Fence, true, mc::AABB(mc::Vector3d(0.375, 0, 0.375), mc::Vector3d(0.625, 1.5, 0.625))));
+
+    return registry;
+}
+
+void CreateColumn(mc::world::World& world, s32 x, s32 z) {
+    mc::DataBuffer buffer;
+
+    buffer << x << z << false << mc::VarInt(0) << mc::VarInt(0) << mc::VarInt(0);
+
+    mc::protocol::packets::in::ChunkDataPacket packet;
+    packet.Deserialize(buffer, buffer.GetSize());
+    world.HandlePacket(&packet);
+}
+
+void SetBlock(mc::world::World& world, const mc::Vector3i& position, u32 blockData) {
+    mc::DataBuffer buffer;
+    s32 chunkX = (s32)std::floor(position.x / 16.0);
+    s32 chunkZ = (s32)std::floor(position.z / 16.0);
+
+    buffer << chunkX << chunkZ << mc::VarInt(1);
+    buffer << (u8)(((position.x & 15) << 4) | (position.z & 15)) << (u8)position.y << mc::VarInt((s32)blockData);
+
+    mc::protocol::packets::in::MultiBlockChangePacket packet;
+    packet.Deserialize(buffer, buffer.GetSize());
+    world.HandlePacket(&packet);
+}
+
+// A player sized box with its feet at the position
+mc::AABB PlayerBox(double x, double y, double z) {
+    return mc::AABB(mc::Vector3d(x - 0.3, y, z - 0.3), mc::Vector3d(x + 0.3, y + 1.8, z + 0.3));
+}
+
+typedef std::array<double, 6> Bounds;
+
+std::vector<Bounds> Sorted(const std::vector<mc::AABB>& boxes) {
+    std::vector<Bounds> result;
+
+    for (const mc::AABB& box : boxes)
+        result.push_back(Bounds{ { box.min.x, box.min.y, box.min.z, box.max.x, box.max.y, box.max.z } });
+
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+// Looks up every block on its own, including the layer below for the blocks that stick out of it.
+std::vector<mc::AABB> GatherSlowly(const mc::world::World& world, const mc::AABB& area) {
+    std::vector<mc::AABB> boxes;
+
+    for (s64 x = (s64)std::floor(area.min.x); x <= (s64)std::floor(area.max.x); ++x) {
+        for (s64 y = std::max<s64>((s64)std::floor(area.min.y) - 1, 0); y <= std::min<s64>((s64)std::floor(area.max.y), 255); ++y) {
+            for (s64 z = (s64)std::floor(area.min.z); z <= (s64)std::floor(area.max.z); ++z) {
+                mc::block::BlockPtr block = world.GetBlock(mc::Vector3i(x, y, z));
+
+                if (!block || !block->IsSolid()) continue;
+
+                for (const mc::AABB& bounds : block->GetBoundingBoxes()) {
+                    mc::AABB box = bounds + mc::Vector3i(x, y, z);
+
+                    if (bounds.min != bounds.max && box.Intersects(area))
+                        boxes.push_back(box);
+                }
+            }
+        }
+    }
+
+    return boxes;
+}
+
+struct CollisionFixture {
+    mc::protocol::packets::PacketDispatcher dispatcher;
+    mc::world::World world;
+    mc::world::Collider collider;
+
+    // A stone floor at y 9 over the columns -1 to 0
+    CollisionFixture() : world(&dispatcher, GetRegistry()), collider(world) {
+        CreateColumn(world, -1, 0);
+        CreateColumn(world, 0, 0);
+
+        for (s64 x = -16; x < 16; ++x) {
+            for (s64 z = 0; z < 16; ++z)
+                SetBlock(world, mc::Vector3i(x, 9, z), Stone);
+        }
+    }
+};
+
+} // ns
+
+TEST_CASE("Collider lands on partial blocks", "[Collision]") {
+    CollisionFixture fixture;
+
+    SECTION("the floor") {
+        mc::world::MoveResult result = fixture.collider.Move(PlayerBox(2.5, 12.0, 2.5), mc::Vector3d(0, -3.0, 0));
+
+        REQUIRE(result.motion.y == Approx(-2.0));
+        REQUIRE(result.onGround);
+        REQUIRE(result.collidedVertically);
+        REQUIRE_FALSE(result.collidedHorizontally);
+    }
+
+    SECTION("a slab") {
+        SetBlock(fixture.world, mc::Vector3i(5, 10, 5), Slab);
+
+        mc::world::MoveResult result = fixture.collider.Move(PlayerBox(5.5, 12.0, 5.5), mc::Vector3d(0.1, -3.0, 0));
+
+        REQUIRE(result.motion.y == Approx(-1.5));
+        REQUIRE(result.motion.x == Approx(0.1));
+        REQUIRE(result.onGround);
+    }
+
+    SECTION("a fence, which is taller than its block") {
+        SetBlock(fixture.world, mc::Vector3i(5, 10, 5), Fence);
+
+        mc::world::MoveResult result = fixture.collider.Move(PlayerBox(5.5, 12.0, 5.5), mc::Vector3d(0, -3.0, 0));
+
+        REQUIRE(result.motion.y == Approx(-0.5));
+        REQUIRE(result.onGround);
+
+        // Beside the post there's nothing until the floor.
+        result = fixture.collider.Move(PlayerBox(6.5, 12.0, 5.5), mc::Vector3d(0, -3.0, 0));
+        REQUIRE(result.motion.y == Approx(-2.0));
+    }
+
+    SECTION("jumping into a ceiling") {
+        SetBlock(fixture.world, mc::Vector3i(2, 12, 2), Stone);
+
+        mc::world::MoveResult result = fixture.collider.Move(PlayerBox(2.5, 10.0, 2.5), mc::Vector3d(0, 0.5, 0));
+
+        REQUIRE(result.motion.y == Approx(0.2));
+        REQUIRE(result.collidedVertically);
+        REQUIRE_FALSE(result.onGround);
+    }
+}
+
+TEST_CASE("Collider steps up and is stopped by walls", "[Collision]") {
+    CollisionFixture fixture;
+    const mc::AABB box = PlayerBox(2.5, 10.0, 5.5);
+
+    SECTION("onto a slab") {
+        SetBlock(fixture.world, mc::Vector3i(3, 10, 5), Slab);
+
+        mc::world::MoveResult result = fixture.collider.Move(box, mc::Vector3d(0.5, 0, 0), true, 0.6);
+
+        REQUIRE(result.motion.x == Approx(0.5));
+        REQUIRE(result.motion.y == Approx(0.5));
+        REQUIRE(result.onGround);
+        REQUIRE_FALSE(result.collidedHorizontally);
+
+        // Only from the ground
+        result = fixture.collider.Move(box, mc::Vector3d(0.5, 0, 0), false, 0.6);
+        REQUIRE(result.motion.x == Approx(0.2));
+        REQUIRE(result.collidedHorizontally);
+
+        // Not without a step height
+        result = fixture.collider.Move(box, mc::Vector3d(0.5, 0, 0), true);
+        REQUIRE(result.motion.x == Approx(0.2));
+    }
+
+    SECTION("not onto a full block") {
+        SetBlock(fixture.world, mc::Vector3i(3, 10, 5), Stone);
+
+        mc::world::MoveResult result = fixture.collider.Move(box, mc::Vector3d(0.5, 0, 0), true, 0.6);
+
+        REQUIRE(result.motion.x == Approx(0.2));
+        REQUIRE(result.motion.y == Approx(0.0));
+        REQUIRE(result.collidedHorizontally);
+    }
+
+    SECTION("not onto a fence") {
+        SetBlock(fixture.world, mc::Vector3i(3, 10, 5), Fence);
+
+        mc::world::MoveResult result = fixture.collider.Move(box, mc::Vector3d(1.0, 0, 0), true, 0.6);
+
+        REQUIRE(result.motion.x == Approx(3.375 - 2.8));
+        REQUIRE(result.motion.y == Approx(0.0));
+        REQUIRE(result.collidedHorizontally);
+    }
+
+    SECTION("sliding along a wall") {
+        for (s64 y = 10; y < 12; ++y)
+            SetBlock(fixture.world, mc::Vector3i(3, y, 5), Stone);
+
+        mc::world::MoveResult result = fixture.collider.Move(box, mc::Vector3d(0.5, 0, 0.25), true, 0.6);
+
+        REQUIRE(result.motion.x == Approx(0.2));
+        REQUIRE(result.motion.z == Approx(0.25));
+        REQUIRE(result.motion.y == Approx(0.0));
+        REQUIRE(result.collidedHorizontally);
+        REQUIRE_FALSE(result.collidedVertically);
+    }
+
+    SECTION("walls in the negative column") {
+        SetBlock(fixture.world, mc::Vector3i(-2, 10, 5), Stone);
+
+        mc::world::MoveResult result = fixture.collider.Move(PlayerBox(-0.5, 10.0, 5.5), mc::Vector3d(-1.0, 0, 0));
+
+        REQUIRE(result.motion.x == Approx(-0.2));
+        REQUIRE(result.collidedHorizontally);
+    }
+}
+
+TEST_CASE("Collider gathers the same boxes as looking up each block", "[Collision]") {
+    CollisionFixture fixture;
+    std::mt19937 random(4321);
+    const u32 blocks[] = { 0, Stone, Slab, Fence };
+
+    for (int i = 0; i < 400; ++i) {
+        mc::Vector3i position(std::uniform_int_distribution<s64>(-16, 15)(random), std::uniform_int_distribution<s64>(10, 20)(random),
+            std::uniform_int_distribution<s64>(0, 15)(random));
+
+        SetBlock(fixture.world, position, blocks[std::uniform_int_distribution<int>(0, 3)(random)]);
+    }
+
+    std::uniform_real_distribution<double> coordinate(-17.0, 17.0);
+    std::uniform_real_distribution<double> height(7.0, 22.0);
+    std::uniform_real_distribution<double> size(0.0, 3.0);
+
+    for (int i = 0; i < 200; ++i) {
+        mc::Vector3d min(coordinate(random), height(random), std::abs(coordinate(random)) - 1.0);
+        mc::AABB area(min, min + mc::Vector3d(size(random), size(random), size(random)));
+
+        INFO("area " << area.min.x << " " << area.min.y << " " << area.min.z);
+        REQUIRE(Sorted(fixture.collider.GetCollisionBoxes(area)) == Sorted(GatherSlowly(fixture.world, area)));
+    }
+
+    // Falling anywhere ends up on something, at the top of one of the boxes below.
+    for (int i = 0; i < 50; ++i) {
+        mc::AABB box = PlayerBox(coordinate(random) * 0.8, 24.0, 1.0 + std::abs(coordinate(random)) * 0.8);
+        mc::world::MoveResult result = fixture.collider.Move(box, mc::Vector3d(0, -20.0, 0));
+
+        REQUIRE(result.onGround);
+
+        double feet = box.min.y + result.motion.y;
+        mc::AABB below(mc::Vector3d(box.min.x, feet - 0.01, box.min.z), mc::Vector3d(box.max.x, feet, box.max.z));
+        bool supported = false;
+
+        for (const mc::AABB& other : GatherSlowly(fixture.world, below))
+            supported |= std::abs(other.max.y - feet) < 1e-9;
+
+        REQUIRE(supported);
+    }
+}
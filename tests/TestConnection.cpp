@@ -0,0 +1,288 @@
+#include "catch.hpp"
+
+#include <mclib/common/DataBuffer.h>
+#include <mclib/common/MCString.h>
+#include <mclib/common/VarInt.h>
+#include <mclib/core/Connection.h>
+#include <mclib/network/Socket.h>
+#include <mclib/protocol/packets/PacketDispatcher.h>
+#include <mclib/protocol/packets/PacketHandler.h>
+
+#include <chrono>
+#include <cstring>
+#include <map>
+#include <string>
+#include <thread>
+
+#ifndef _WIN32
+#include <sys/select.h>
+#endif
+
+using mc::DataBuffer;
+
+namespace {
+
+const mc::protocol::Version Version = mc::protocol::Version::Minecraft_1_12_2;
+
+// 1.12.2 ids
+const s32 LoginSuccessId = 0x02;
+const s32 KeepAliveId = 0x1F;
+const s32 ChunkDataId = 0x20;
+const s32 KeepAliveResponseId = 0x0B;
+
+void AddFrame(DataBuffer& stream, const DataBuffer& payload) {
+    stream << mc::VarInt((s32)payload.GetSize());
+    stream << payload;
+}
+
+void AddLoginSuccess(DataBuffer& stream) {
+    DataBuffer payload;
+
+    payload << mc::VarInt(LoginSuccessId) << mc::MCString("069a79f4-44e9-4726-a5be-fca90e38aaf5") << mc::MCString("tester");
+    AddFrame(stream, payload);
+}
+
+void AddKeepAlive(DataBuffer& stream, s64 id) {
+    DataBuffer payload;
+
+    payload << mc::VarInt(KeepAliveId) << id;
+    AddFrame(stream, payload);
+}
+
+void AddChunkData(DataBuffer& stream, s32 x, s32 z) {
+    DataBuffer payload;
+
+    payload << mc::VarInt(ChunkDataId) << x << z << true << mc::VarInt(0) << mc::VarInt(256);
+    payload << std::string(256, '\x01');
+    payload << mc::VarInt(0);
+    AddFrame(stream, payload);
+}
+
+// The server end of a loopback connection. It records every keepalive response the client sends.
+class Server {
+private:
+    mc::network::SocketHandle m_Listener;
+    mc::network::SocketHandle m_Client;
+    u16 m_Port;
+    DataBuffer m_Received;
+
+public:
+    std::map<s64, int> responses;
+
+    Server() : m_Client(INVALID_SOCKET) {
+        sockaddr_in address;
+
+        std::memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        address.sin_port = 0;
+
+        m_Listener = (mc::network::SocketHandle)socket(AF_INET, SOCK_STREAM, 0);
+        REQUIRE(bind(m_Listener, (sockaddr*)&address, sizeof(address)) == 0);
+        REQUIRE(listen(m_Listener, 1) == 0);
+
+        socklen_t size = sizeof(address);
+        getsockname(m_Listener, (sockaddr*)&address, &size);
+        m_Port = ntohs(address.sin_port);
+    }
+
+    ~Server() {
+        if (m_Client != INVALID_SOCKET)
+            closesocket(m_Client);
+        closesocket(m_Listener);
+    }
+
+    u16 GetPort() const { return m_Port; }
+
+    void Accept() {
+        m_Client = (mc::network::SocketHandle)accept(m_Listener, nullptr, nullptr);
+        REQUIRE(m_Client != INVALID_SOCKET);
+    }
+
+    // Sent in one write, so the client gets the frames together.
+    void Send(const DataBuffer& stream) {
+        std::string data = stream.ToString();
+
+        REQUIRE(send(m_Client, data.c_str(), (int)data.size(), 0) == (int)data.size());
+    }
+
+    // Reads whatever the client sent within timeout and counts the keepalive responses in it.
+    void Read(int timeout) {
+        char buffer[4096];
+
+        while (true) {
+            fd_set set;
+            FD_ZERO(&set);
+            FD_SET(m_Client, &set);
+
+            timeval time = { 0, timeout * 1000 };
+            if (select((int)m_Client + 1, &set, nullptr, nullptr, &time) <= 0) break;
+
+            int received = recv(m_Client, buffer, sizeof(buffer), 0);
+            if (received <= 0) break;
+
+            m_Received << std::string(buffer, received);
+        }
+
+        // Uncompressed frames are a length, the packet id and the data.
+        while (!m_Received.IsFinished()) {
+            std::size_t start = m_Received.GetReadOffset();
+            mc::VarInt length;
+
+            try {
+                m_Received >> length;
+            } catch (const std::out_of_range&) {
+                m_Received.SetReadOffset(start);
+                break;
+            }
+
+            if (m_Received.GetRemaining() < (std::size_t)length.GetInt()) {
+                m_Received.SetReadOffset(start);
+                break;
+            }
+
+            std::size_t end = m_Received.GetReadOffset() + length.GetInt();
+            mc::VarInt id;
+            m_Received >> id;
+
+            if (id.GetInt() == KeepAliveResponseId) {
+                s64 aliveId;
+                m_Received >> aliveId;
+                ++responses[aliveId];
+            }
+
+            m_Received.SetReadOffset(end);
+        }
+
+        m_Received = DataBuffer(m_Received, m_Received.GetReadOffset());
+    }
+};
+
+// Counts what was dispatched, so the test knows when the client went through everything that was sent.
+class Counter : public mc::protocol::packets::PacketHandler {
+public:
+    int keepAlives;
+    int chunks;
+
+    Counter(mc::protocol::packets::PacketDispatcher* dispatcher)
+        : mc::protocol::packets::PacketHandler(dispatcher), keepAlives(0), chunks(0)
+    {
+        dispatcher->RegisterHandler(mc::protocol::State::Play, mc::protocol::play::KeepAlive, this);
+        dispatcher->RegisterHandler(mc::protocol::State::Play, mc::protocol::play::ChunkData, this);
+    }
+
+    ~Counter() {
+        GetDispatcher()->UnregisterHandler(this);
+    }
+
+    void HandlePacket(mc::protocol::packets::in::KeepAlivePacket* packet) override { ++keepAlives; }
+    void HandlePacket(mc::protocol::packets::in::ChunkDataPacket* packet) override { ++chunks; }
+};
+
+struct ConnectionFixture {
+    mc::protocol::packets::PacketDispatcher dispatcher;
+    mc::core::Connection connection;
+    Counter counter;
+    Server server;
+
+    ConnectionFixture() : connection(&dispatcher, Version), counter(&dispatcher) {
+        REQUIRE(connection.Connect("127.0.0.1", server.GetPort()));
+        server.Accept();
+        REQUIRE(connection.Login("tester", ""));
+    }
+
+    // Runs the client until it dispatched that many packets in total.
+    void Update(int keepAlives, int chunks) {
+        auto end = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+
+        while ((counter.keepAlives < keepAlives || counter.chunks < chunks) && std::chrono::steady_clock::now() < end) {
+            connection.CreatePacket();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        REQUIRE(counter.keepAlives == keepAlives);
+        REQUIRE(counter.chunks == chunks);
+
+        server.Read(50);
+    }
+};
+
+// Keepalives with the ids first to first + count - 1, with chunks between them
+DataBuffer CreateFlood(s64 first, int count) {
+    DataBuffer stream;
+
+    for (int i = 0; i < count; ++i) {
+        AddKeepAlive(stream, first + i);
+        AddChunkData(stream, i, (s32)first);
+        AddChunkData(stream, i, (s32)first + 1);
+    }
+
+    return stream;
+}
+
+void RequireAnsweredOnce(const Server& server, s64 first, int count) {
+    for (s64 id = first; id < first + count; ++id) {
+        auto iter = server.responses.find(id);
+
+        INFO("keepalive " << id);
+        REQUIRE(iter != server.responses.end());
+        REQUIRE(iter->second == 1);
+    }
+}
+
+} // ns
+
+TEST_CASE("Connection answers every keepalive once", "[Connection]") {
+    ConnectionFixture fixture;
+
+    SECTION("without the pipeline") {
+        DataBuffer stream;
+
+        AddLoginSuccess(stream);
+        stream << CreateFlood(1, 10);
+        fixture.server.Send(stream);
+        fixture.Update(10, 20);
+
+        RequireAnsweredOnce(fixture.server, 1, 10);
+        REQUIRE(fixture.server.responses.size() == 10);
+        REQUIRE(fixture.connection.GetPipeline() == nullptr);
+    }
+
+    SECTION("with the pipeline started at login") {
+        fixture.connection.SetPipelineEnabled(true);
+
+        DataBuffer stream;
+        AddLoginSuccess(stream);
+        stream << CreateFlood(1, 10);
+        fixture.server.Send(stream);
+        fixture.Update(10, 20);
+
+        REQUIRE(fixture.connection.GetPipeline() != nullptr);
+
+        fixture.server.Send(CreateFlood(100, 10));
+        fixture.Update(20, 40);
+
+        RequireAnsweredOnce(fixture.server, 1, 10);
+        RequireAnsweredOnce(fixture.server, 100, 10);
+        REQUIRE(fixture.server.responses.size() == 20);
+    }
+
+    SECTION("with the pipeline enabled while playing") {
+        DataBuffer stream;
+
+        AddLoginSuccess(stream);
+        AddKeepAlive(stream, 1);
+        fixture.server.Send(stream);
+        fixture.Update(1, 0);
+
+        // It only takes effect on the next login, so the frames the priority lane answered aren't answered again.
+        fixture.connection.SetPipelineEnabled(true);
+        fixture.server.Send(CreateFlood(100, 10));
+        fixture.Update(11, 20);
+
+        REQUIRE(fixture.connection.GetPipeline() == nullptr);
+        RequireAnsweredOnce(fixture.server, 1, 1);
+        RequireAnsweredOnce(fixture.server, 100, 10);
+        REQUIRE(fixture.server.responses.size() == 11);
+    }
+}
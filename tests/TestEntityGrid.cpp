@@ -0,0 +1,216 @@
+#include "catch.hpp"
+
+#include <mclib/entity/EntityGrid.h>
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+using mc::entity::EntityGrid;
+using mc::entity::EntityPtr;
+
+namespace {
+
+EntityPtr CreateEntity(mc::EntityId id) {
+    return std::make_shared<mc::entity::Entity>(id, mc::protocol::Version::Minecraft_1_12_2);
+}
+
+std::vector<mc::EntityId> GetIds(const std::vector<EntityPtr>& entities) {
+    std::vector<mc::EntityId> ids;
+
+    for (const EntityPtr& entity : entities)
+        ids.push_back(entity->GetEntityId());
+
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+struct Population {
+    std::vector<EntityPtr> entities;
+    std::vector<mc::Vector3d> positions;
+
+    // Spread over spread * spread blocks around the origin, so it includes negative cells.
+    Population(EntityGrid& grid, std::size_t count, double spread, u32 seed) {
+        std::mt19937 random(seed);
+        std::uniform_real_distribution<double> horizontal(-spread / 2, spread / 2);
+        std::uniform_real_distribution<double> vertical(0, 128);
+
+        for (std::size_t i = 0; i < count; ++i) {
+            EntityPtr entity = CreateEntity((mc::EntityId)i + 1);
+            mc::Vector3d position(horizontal(random), vertical(random), horizontal(random));
+
+            entities.push_back(entity);
+            positions.push_back(position);
+            grid.Update(entity, position);
+        }
+    }
+
+    std::vector<mc::EntityId> InRadius(const mc::Vector3d& center, double radius) const {
+        std::vector<mc::EntityId> ids;
+
+        for (std::size_t i = 0; i < entities.size(); ++i) {
+            if (positions[i].DistanceSq(center) <= radius * radius)
+                ids.push_back(entities[i]->GetEntityId());
+        }
+
+        std::sort(ids.begin(), ids.end());
+        return ids;
+    }
+
+    double NearestDistanceSq(const mc::Vector3d& center, const EntityGrid::Filter& filter, double maxDistance) const {
+        double best = -1.0;
+
+        for (std::size_t i = 0; i < entities.size(); ++i) {
+            double distanceSq = positions[i].DistanceSq(center);
+
+            if (distanceSq > maxDistance * maxDistance || !filter(entities[i])) continue;
+            if (best < 0.0 || distanceSq < best)
+                best = distanceSq;
+        }
+
+        return best;
+    }
+};
+
+} // ns
+
+TEST_CASE("EntityGrid tracks entities between cells", "[EntityGrid]") {
+    EntityGrid grid;
+    EntityPtr first = CreateEntity(1);
+    EntityPtr second = CreateEntity(2);
+    EntityPtr third = CreateEntity(3);
+
+    grid.Update(first, mc::Vector3d(1, 64, 1));
+    grid.Update(second, mc::Vector3d(2, 64, 2));
+    grid.Update(third, mc::Vector3d(-1, 64, 1));
+
+    REQUIRE(grid.GetSize() == 3);
+    REQUIRE(grid.GetCellCount() == 2);
+
+    SECTION("moving inside of a cell") {
+        grid.Update(first, mc::Vector3d(15.5, 10, 15.5));
+
+        std::vector<EntityPtr> result;
+        grid.QueryRadius(mc::Vector3d(15.5, 10, 15.5), 0.1, result);
+
+        REQUIRE(GetIds(result) == std::vector<mc::EntityId>{ 1 });
+        REQUIRE(grid.GetCellCount() == 2);
+    }
+
+    SECTION("moving out of a cell drops it once it's empty") {
+        grid.Update(third, mc::Vector3d(3, 64, 3));
+        REQUIRE(grid.GetCellCount() == 1);
+
+        grid.Update(first, mc::Vector3d(100, 64, -100));
+        REQUIRE(grid.GetCellCount() == 2);
+        REQUIRE(grid.GetSize() == 3);
+
+        std::vector<EntityPtr> result;
+        grid.QueryRadius(mc::Vector3d(0, 64, 0), 10, result);
+        REQUIRE(GetIds(result) == std::vector<mc::EntityId>{ 2, 3 });
+    }
+
+    SECTION("removing the first entry of a cell keeps the others findable") {
+        grid.Remove(1);
+        grid.Remove(1);
+
+        REQUIRE(grid.GetSize() == 2);
+
+        // The swapped entry has to be removable and movable at its new index.
+        grid.Update(second, mc::Vector3d(5, 64, 5));
+        grid.Remove(2);
+
+        REQUIRE(grid.GetSize() == 1);
+        REQUIRE(grid.GetCellCount() == 1);
+    }
+
+    SECTION("clear") {
+        grid.Clear();
+
+        REQUIRE(grid.GetSize() == 0);
+        REQUIRE(grid.GetCellCount() == 0);
+        REQUIRE(grid.Nearest(mc::Vector3d(0, 0, 0), nullptr) == nullptr);
+    }
+}
+
+TEST_CASE("EntityGrid QueryAABB includes the edges", "[EntityGrid]") {
+    EntityGrid grid;
+
+    grid.Update(CreateEntity(1), mc::Vector3d(0, 0, 0));
+    grid.Update(CreateEntity(2), mc::Vector3d(16, 5, 16));
+    grid.Update(CreateEntity(3), mc::Vector3d(16.01, 5, 16));
+    grid.Update(CreateEntity(4), mc::Vector3d(8, 11, 8));
+
+    std::vector<EntityPtr> result;
+    grid.QueryAABB(mc::AABB(mc::Vector3d(0, 0, 0), mc::Vector3d(16, 10, 16)), result);
+
+    REQUIRE(GetIds(result) == std::vector<mc::EntityId>{ 1, 2 });
+}
+
+TEST_CASE("EntityGrid QueryRadius matches a brute force search", "[EntityGrid]") {
+    EntityGrid grid;
+    Population population(grid, 500, 400.0, 7);
+    std::mt19937 random(11);
+    std::uniform_real_distribution<double> coord(-220, 220);
+
+    // Small radii look up each cell, large ones go through the occupied cells.
+    for (double radius : { 0.0, 3.0, 20.0, 75.0, 1000.0 }) {
+        for (int i = 0; i < 20; ++i) {
+            mc::Vector3d center(coord(random), 64, coord(random));
+            std::vector<EntityPtr> result;
+
+            grid.QueryRadius(center, radius, result);
+            REQUIRE(GetIds(result) == population.InRadius(center, radius));
+        }
+    }
+
+    std::vector<EntityPtr> result;
+    grid.QueryRadius(mc::Vector3d(0, 64, 0), -1.0, result);
+    REQUIRE(result.empty());
+}
+
+TEST_CASE("EntityGrid Nearest matches a brute force search", "[EntityGrid]") {
+    auto everything = [](const EntityPtr&) { return true; };
+    auto even = [](const EntityPtr& entity) { return entity->GetEntityId() % 2 == 0; };
+
+    // Few occupied cells skip the rings, many go through them.
+    for (std::size_t count : { 3, 40, 600 }) {
+        EntityGrid grid;
+        Population population(grid, count, 300.0, (u32)count);
+        std::mt19937 random(5);
+        std::uniform_real_distribution<double> coord(-200, 200);
+
+        for (int i = 0; i < 50; ++i) {
+            mc::Vector3d center(coord(random), 64, coord(random));
+
+            for (double maxDistance : { 10.0, 60.0, std::numeric_limits<double>::infinity() }) {
+                EntityPtr nearest = grid.Nearest(center, everything, maxDistance);
+                double expected = population.NearestDistanceSq(center, everything, maxDistance);
+
+                if (expected < 0.0) {
+                    REQUIRE(nearest == nullptr);
+                } else {
+                    REQUIRE(nearest != nullptr);
+                    REQUIRE(population.positions[nearest->GetEntityId() - 1].DistanceSq(center) == Approx(expected));
+                }
+
+                EntityPtr filtered = grid.Nearest(center, even, maxDistance);
+                expected = population.NearestDistanceSq(center, even, maxDistance);
+
+                if (expected < 0.0) {
+                    REQUIRE(filtered == nullptr);
+                } else {
+                    REQUIRE(filtered != nullptr);
+                    REQUIRE(filtered->GetEntityId() % 2 == 0);
+                    REQUIRE(population.positions[filtered->GetEntityId() - 1].DistanceSq(center) == Approx(expected));
+                }
+            }
+        }
+
+        // No filter accepts everything
+        REQUIRE(grid.Nearest(mc::Vector3d(0, 64, 0), nullptr) != nullptr);
+        REQUIRE(grid.Nearest(mc::Vector3d(0, 64, 0), nullptr, -1.0) == nullptr);
+    }
+}
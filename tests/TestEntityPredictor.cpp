@@ -0,0 +1,118 @@
+#include "catch.hpp"
+
+#include <mclib/entity/EntityPredictor.h>
+#include <mclib/protocol/packets/PacketDispatcher.h>
+
+#include <vector>
+
+using mc::entity::EntityPredictor;
+
+namespace {
+
+const mc::protocol::Version Version = mc::protocol::Version::Minecraft_1_12_2;
+
+// Moves along x at speed blocks per second with a sample every 50 ms, like entity move packets.
+void AddWalk(EntityPredictor& predictor, mc::EntityId eid, mc::Vector3d start, double speed, s64 startTime, s64 endTime) {
+    for (s64 time = startTime; time <= endTime; time += 50)
+        predictor.AddSample(eid, start + mc::Vector3d(speed * (time - startTime) / 1000.0, 0, 0), time);
+}
+
+mc::Vector3d Predict(const EntityPredictor& predictor, mc::EntityId eid, s64 time) {
+    mc::Vector3d position;
+
+    REQUIRE(predictor.PredictPosition(eid, time, &position));
+    return position;
+}
+
+} // ns
+
+TEST_CASE("EntityPredictor extrapolates and then settles at the last move", "[EntityPredictor]") {
+    mc::protocol::packets::PacketDispatcher dispatcher;
+    mc::entity::EntityManager entityManager(&dispatcher, Version);
+    EntityPredictor predictor(&entityManager);
+
+    AddWalk(predictor, 1, mc::Vector3d(0, 64, 0), 10.0, 1000, 1200);
+
+    REQUIRE(predictor.GetMaxExtrapolation() == 150);
+    REQUIRE(predictor.GetVelocity(1).x == Approx(10.0));
+    REQUIRE(predictor.GetVelocity(1).y == Approx(0.0));
+    REQUIRE(Predict(predictor, 1, 1200).x == Approx(2.0));
+
+    SECTION("inside of the window it keeps the velocity") {
+        REQUIRE(Predict(predictor, 1, 1300).x == Approx(3.0));
+        REQUIRE(Predict(predictor, 1, 1350).x == Approx(3.5));
+    }
+
+    SECTION("after the window it returns to the last move") {
+        REQUIRE(Predict(predictor, 1, 1400).x == Approx(3.0));
+        REQUIRE(Predict(predictor, 1, 1500).x == Approx(2.0));
+        REQUIRE(Predict(predictor, 1, 100000).x == Approx(2.0));
+        REQUIRE(Predict(predictor, 1, 100000).y == Approx(64.0));
+    }
+
+    SECTION("times before the last move are interpolated") {
+        REQUIRE(Predict(predictor, 1, 1125).x == Approx(1.25));
+        REQUIRE(Predict(predictor, 1, 1000).x == Approx(0.0));
+        REQUIRE(Predict(predictor, 1, 500).x == Approx(0.0));
+    }
+
+    SECTION("teleports start over") {
+        predictor.AddSample(1, mc::Vector3d(100, 64, 0), 1250);
+
+        REQUIRE(predictor.GetVelocity(1).x == Approx(0.0));
+        REQUIRE(Predict(predictor, 1, 1300).x == Approx(100.0));
+        REQUIRE(Predict(predictor, 1, 1225).x == Approx(100.0));
+    }
+
+    SECTION("removed entities aren't tracked") {
+        predictor.Remove(1);
+
+        mc::Vector3d position;
+        REQUIRE_FALSE(predictor.IsTracked(1));
+        REQUIRE_FALSE(predictor.PredictPosition(1, 1300, &position));
+    }
+}
+
+TEST_CASE("EntityPredictor PredictAll matches PredictPosition", "[EntityPredictor]") {
+    // Odd counts leave an entity for the scalar loop after the SIMD one.
+    for (std::size_t count : { 1, 2, 3, 7, 8 }) {
+        mc::protocol::packets::PacketDispatcher dispatcher;
+        mc::entity::EntityManager entityManager(&dispatcher, Version);
+        EntityPredictor predictor(&entityManager);
+
+        for (std::size_t i = 0; i < count; ++i) {
+            // Different speeds and last moves, so entities are at different points of the window at once.
+            s64 start = 1000 + (s64)i * 30;
+
+            AddWalk(predictor, (mc::EntityId)i + 1, mc::Vector3d(i * 10.0, 64, -(double)i), 2.0 + i, start, start + 200 + (s64)i * 40);
+        }
+
+        REQUIRE(predictor.GetSize() == count);
+
+        for (s64 time : { 900, 1100, 1250, 1330, 1400, 1470, 1555, 1700, 5000 }) {
+            std::vector<mc::Vector3d> positions;
+
+            predictor.PredictAll(time, positions);
+            REQUIRE(positions.size() == count);
+
+            for (std::size_t i = 0; i < count; ++i) {
+                mc::Vector3d expected = Predict(predictor, predictor.GetIds()[i], time);
+
+                REQUIRE(positions[i].x == Approx(expected.x));
+                REQUIRE(positions[i].y == Approx(expected.y));
+                REQUIRE(positions[i].z == Approx(expected.z));
+            }
+        }
+
+        // Long after every last move, everything is back where it was last seen.
+        std::vector<mc::Vector3d> positions;
+        predictor.PredictAll(100000, positions);
+
+        for (std::size_t i = 0; i < count; ++i) {
+            // The last sample is on the last 50 ms step.
+            s64 duration = (200 + (s64)i * 40) / 50 * 50;
+
+            REQUIRE(positions[i].x == Approx(i * 10.0 + (2.0 + i) * duration / 1000.0));
+        }
+    }
+}
@@ -0,0 +1,321 @@
+#include "catch.hpp"
+
+#include <mclib/common/DataBuffer.h>
+#include <mclib/common/VarInt.h>
+#include <mclib/entity/Entity.h>
+#include <mclib/entity/EntityManager.h>
+#include <mclib/entity/EntityStore.h>
+#include <mclib/protocol/packets/Packet.h>
+#include <mclib/protocol/packets/PacketDispatcher.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <vector>
+
+using mc::entity::Entity;
+using mc::entity::EntityHandle;
+using mc::entity::EntityStore;
+
+namespace {
+
+const mc::protocol::Version Version = mc::protocol::Version::Minecraft_1_12_2;
+
+std::vector<mc::EntityId> GetSortedIds(const EntityStore& store) {
+    std::vector<mc::EntityId> ids = store.GetIds();
+
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+void SpawnEntity(mc::entity::EntityManager& manager, mc::EntityId eid) {
+    mc::DataBuffer buffer;
+
+    buffer << mc::VarInt(eid);
+
+    mc::protocol::packets::in::EntityPacket packet;
+    packet.Deserialize(buffer, buffer.GetSize());
+    manager.HandlePacket(&packet);
+}
+
+void DestroyEntity(mc::entity::EntityManager& manager, mc::EntityId eid) {
+    mc::DataBuffer buffer;
+
+    buffer << mc::VarInt(1) << mc::VarInt(eid);
+
+    mc::protocol::packets::in::DestroyEntitiesPacket packet;
+    packet.Deserialize(buffer, buffer.GetSize());
+    manager.HandlePacket(&packet);
+}
+
+} // ns
+
+TEST_CASE("EntityStore keeps its arrays packed", "[EntityStore]") {
+    EntityStore store;
+    std::vector<EntityHandle> handles;
+
+    for (mc::EntityId id = 0; id < 5; ++id) {
+        EntityHandle handle = store.Create(id);
+
+        store.SetPosition(handle, mc::Vector3d(id, id * 2.0, id * 3.0));
+        store.SetYaw(handle, id * 0.5f);
+        store.SetVehicleId(handle, id + 100);
+        handles.push_back(handle);
+    }
+
+    REQUIRE(store.GetSize() == 5);
+    REQUIRE(store.GetId(handles[3]) == 3);
+    REQUIRE(store.GetVehicleId(handles[3]) == 103);
+
+    SECTION("destroying in the middle moves the last entity into the hole") {
+        store.Destroy(handles[1]);
+
+        REQUIRE(store.GetSize() == 4);
+        REQUIRE(store.GetIndex(handles[4]) == 1);
+        REQUIRE(GetSortedIds(store) == std::vector<mc::EntityId>{ 0, 2, 3, 4 });
+
+        for (mc::EntityId id : { 0, 2, 3, 4 }) {
+            const EntityHandle& handle = handles[id];
+
+            REQUIRE(store.GetId(handle) == id);
+            REQUIRE(store.GetPosition(handle) == mc::Vector3d(id, id * 2.0, id * 3.0));
+            REQUIRE(store.GetYaw(handle) == id * 0.5f);
+            REQUIRE(store.GetVehicleId(handle) == id + 100);
+
+            // The packed arrays agree with the handle lookups.
+            std::size_t index = store.GetIndex(handle);
+            REQUIRE(store.GetIds()[index] == id);
+            REQUIRE(store.GetPositions()[index] == store.GetPosition(handle));
+        }
+    }
+
+    SECTION("destroying the last entity") {
+        store.Destroy(handles[4]);
+
+        REQUIRE(store.GetSize() == 4);
+        REQUIRE(store.GetIndex(handles[3]) == 3);
+    }
+
+    SECTION("destroying everything") {
+        for (const EntityHandle& handle : handles)
+            store.Destroy(handle);
+
+        REQUIRE(store.GetSize() == 0);
+        REQUIRE(store.GetPositions().empty());
+    }
+}
+
+TEST_CASE("EntityStore handles go stale when their entity is destroyed", "[EntityStore]") {
+    EntityStore store;
+    EntityHandle first = store.Create(1);
+    EntityHandle second = store.Create(2);
+
+    REQUIRE(store.IsValid(first));
+    REQUIRE_FALSE(store.IsValid(EntityHandle{ 50, 0 }));
+
+    store.Destroy(first);
+    REQUIRE_FALSE(store.IsValid(first));
+    REQUIRE(store.IsValid(second));
+
+    // The slot is reused, but not the generation.
+    EntityHandle reused = store.Create(3);
+
+    REQUIRE(reused.slot == first.slot);
+    REQUIRE(reused != first);
+    REQUIRE(store.IsValid(reused));
+    REQUIRE_FALSE(store.IsValid(first));
+
+    // A stale handle can't destroy the entity that took over its slot.
+    store.Destroy(first);
+
+    REQUIRE(store.GetSize() == 2);
+    REQUIRE(store.IsValid(reused));
+    REQUIRE(store.GetId(reused) == 3);
+    REQUIRE(store.GetId(second) == 2);
+}
+
+TEST_CASE("EntityStore copies state between stores", "[EntityStore]") {
+    EntityStore from;
+    EntityStore to;
+    EntityHandle source = from.Create(7);
+    EntityHandle target = to.Create(8);
+
+    from.SetPosition(source, mc::Vector3d(1, 2, 3));
+    from.SetVelocity(source, mc::Vector3d(4, 5, 6));
+    from.SetPitch(source, 0.25f);
+    from.SetHeadPitch(source, 0.75f);
+    from.SetType(source, mc::entity::EntityType::Pig);
+    from.SetVehicleId(source, 9);
+
+    to.CopyState(target, from, source);
+
+    REQUIRE(to.GetId(target) == 8);
+    REQUIRE(to.GetPosition(target) == mc::Vector3d(1, 2, 3));
+    REQUIRE(to.GetVelocity(target) == mc::Vector3d(4, 5, 6));
+    REQUIRE(to.GetPitch(target) == 0.25f);
+    REQUIRE(to.GetHeadPitch(target) == 0.75f);
+    REQUIRE(to.GetType(target) == mc::entity::EntityType::Pig);
+    REQUIRE(to.GetVehicleId(target) == 9);
+}
+
+TEST_CASE("Entity copies, moves and detaches from a shared store", "[EntityStore]") {
+    auto store = std::make_shared<EntityStore>();
+    Entity entity(1, Version, store);
+    Entity other(2, Version, store);
+
+    entity.SetPosition(mc::Vector3d(10, 64, 10));
+    entity.SetYaw(1.5f);
+    REQUIRE(store->GetSize() == 2);
+
+    SECTION("copies get a store of their own") {
+        Entity copy(entity);
+
+        REQUIRE(copy.GetStore() != store);
+        REQUIRE(store->GetSize() == 2);
+        REQUIRE(copy.GetEntityId() == 1);
+        REQUIRE(copy.GetPosition() == mc::Vector3d(10, 64, 10));
+        REQUIRE(copy.GetYaw() == 1.5f);
+
+        copy.SetPosition(mc::Vector3d(0, 0, 0));
+        REQUIRE(entity.GetPosition() == mc::Vector3d(10, 64, 10));
+
+        copy = other;
+
+        REQUIRE(copy.GetEntityId() == 2);
+        REQUIRE(copy.GetStore()->GetId(copy.GetHandle()) == 2);
+        REQUIRE(copy.GetPosition() == other.GetPosition());
+        REQUIRE(store->GetSize() == 2);
+    }
+
+    SECTION("moves keep the place in the store") {
+        EntityHandle handle = entity.GetHandle();
+        Entity moved(std::move(entity));
+
+        REQUIRE(moved.GetStore() == store);
+        REQUIRE(moved.GetHandle() == handle);
+        REQUIRE(moved.GetPosition() == mc::Vector3d(10, 64, 10));
+        REQUIRE(store->GetSize() == 2);
+
+        // Assigning destroys the entity that was there.
+        EntityHandle replaced = other.GetHandle();
+        other = std::move(moved);
+
+        REQUIRE(store->GetSize() == 1);
+        REQUIRE_FALSE(store->IsValid(replaced));
+        REQUIRE(other.GetEntityId() == 1);
+        REQUIRE(other.GetPosition() == mc::Vector3d(10, 64, 10));
+    }
+
+    SECTION("detaching leaves the shared store") {
+        EntityHandle handle = entity.GetHandle();
+
+        entity.Detach();
+
+        REQUIRE(entity.GetStore() != store);
+        REQUIRE(store->GetSize() == 1);
+        REQUIRE_FALSE(store->IsValid(handle));
+        REQUIRE(entity.GetPosition() == mc::Vector3d(10, 64, 10));
+        REQUIRE(entity.GetYaw() == 1.5f);
+        // The entity that was swapped into its place is still there.
+        REQUIRE(other.GetStore()->GetId(other.GetHandle()) == 2);
+    }
+
+    SECTION("destroying removes the entity from the store") {
+        {
+            Entity temporary(3, Version, store);
+            REQUIRE(store->GetSize() == 3);
+        }
+
+        REQUIRE(store->GetSize() == 2);
+    }
+}
+
+TEST_CASE("EntityStore pools memory by size", "[EntityStore]") {
+    EntityStore store;
+
+    SECTION("blocks are distinct and aligned") {
+        std::set<void*> blocks;
+
+        // More than one chunk's worth
+        for (int i = 0; i < 200; ++i) {
+            void* block = store.Allocate(40);
+
+            REQUIRE(reinterpret_cast<std::uintptr_t>(block) % alignof(std::max_align_t) == 0);
+            REQUIRE(blocks.insert(block).second);
+        }
+
+        for (void* block : blocks)
+            store.Deallocate(block, 40);
+    }
+
+    SECTION("freed blocks are reused") {
+        void* first = store.Allocate(24);
+        void* second = store.Allocate(24);
+
+        REQUIRE(first != second);
+
+        store.Deallocate(first, 24);
+        REQUIRE(store.Allocate(24) == first);
+
+        // Other sizes have pools of their own.
+        store.Deallocate(second, 24);
+        void* other = store.Allocate(100);
+
+        REQUIRE(other != second);
+        REQUIRE(store.Allocate(24) == second);
+
+        store.Deallocate(other, 100);
+    }
+
+    SECTION("allocate_shared keeps the store alive") {
+        auto shared = std::make_shared<EntityStore>();
+        std::weak_ptr<EntityStore> weak = shared;
+
+        std::shared_ptr<Entity> entity = std::allocate_shared<Entity>(mc::entity::EntityAllocator<Entity>(shared), 5, Version, shared);
+
+        shared.reset();
+        REQUIRE_FALSE(weak.expired());
+        REQUIRE(entity->GetEntityId() == 5);
+        REQUIRE(entity->GetStore()->GetSize() == 1);
+
+        entity.reset();
+        REQUIRE(weak.expired());
+    }
+}
+
+TEST_CASE("EntityManager detaches the entities that are still held", "[EntityStore]") {
+    mc::protocol::packets::PacketDispatcher dispatcher;
+    std::unique_ptr<mc::entity::EntityManager> manager(new mc::entity::EntityManager(&dispatcher, Version));
+
+    SpawnEntity(*manager, 1);
+    SpawnEntity(*manager, 2);
+    SpawnEntity(*manager, 3);
+
+    mc::entity::EntityPtr held = manager->GetEntity(1);
+    mc::entity::EntityStorePtr store = held->GetStore();
+
+    held->SetPosition(mc::Vector3d(1, 2, 3));
+    REQUIRE(manager->GetGrid().GetSize() == 3);
+
+    SECTION("when they're destroyed") {
+        DestroyEntity(*manager, 1);
+        DestroyEntity(*manager, 2);
+
+        REQUIRE(held->GetStore() != store);
+        REQUIRE(held->GetPosition() == mc::Vector3d(1, 2, 3));
+        REQUIRE(GetSortedIds(*store) == std::vector<mc::EntityId>{ 3 });
+    }
+
+    SECTION("when the manager goes away") {
+        mc::entity::EntityPtr other = manager->GetEntity(3);
+
+        manager.reset();
+
+        REQUIRE(held->GetStore() != store);
+        REQUIRE(other->GetStore() != store);
+        REQUIRE(held->GetPosition() == mc::Vector3d(1, 2, 3));
+        // Entity 2 wasn't held, so it was destroyed with the manager and left nothing behind.
+        REQUIRE(store->GetSize() == 0);
+    }
+}
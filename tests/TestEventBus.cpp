@@ -0,0 +1,227 @@
+#include "catch.hpp"
+
+#include <mclib/util/EventBus.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+using IntEvent = mc::util::Event<int>;
+
+struct Recorder {
+    std::vector<int> values;
+
+    void OnValue(int value) {
+        values.push_back(value);
+    }
+};
+
+struct Unsubscriber {
+    IntEvent* event;
+    mc::util::EventSubscription target;
+    std::vector<int> values;
+
+    void OnValue(int value) {
+        values.push_back(value);
+        event->Unsubscribe(target);
+    }
+};
+
+struct Flusher {
+    IntEvent* event;
+    std::vector<int> values;
+
+    void OnValue(int value) {
+        values.push_back(value);
+
+        if (value == 1) {
+            event->Post(100);
+            // Delivering 100 here would put it ahead of 2 and 3.
+            event->Flush();
+        }
+    }
+};
+
+struct Thrower {
+    std::vector<int> values;
+
+    void OnValue(int value) {
+        values.push_back(value);
+
+        if (value == 2)
+            throw std::runtime_error("subscriber failed");
+    }
+};
+
+} // ns
+
+TEST_CASE("Event dispatches to every subscriber", "[EventBus]") {
+    IntEvent event;
+    Recorder first, second;
+
+    mc::util::EventSubscription id = event.Subscribe<Recorder, &Recorder::OnValue>(&first);
+    event.Subscribe<Recorder, &Recorder::OnValue>(&second);
+
+    event.Dispatch(5);
+    event.Unsubscribe(id);
+    event.Dispatch(6);
+
+    REQUIRE(first.values == std::vector<int>{ 5 });
+    REQUIRE(second.values == std::vector<int>{ 5, 6 });
+
+    // Unknown ids are ignored
+    event.Unsubscribe(id);
+    event.Unsubscribe(12345);
+    REQUIRE(event.HasSubscribers());
+}
+
+TEST_CASE("Event delivers queued events in order on Flush", "[EventBus]") {
+    IntEvent event;
+    Recorder recorder;
+
+    SECTION("nothing is queued without subscribers") {
+        event.Post(1);
+        REQUIRE(event.GetQueuedCount() == 0);
+    }
+
+    SECTION("events wait for Flush") {
+        event.Subscribe<Recorder, &Recorder::OnValue>(&recorder);
+
+        event.Post(1);
+        event.Post(2);
+        event.Post(3);
+
+        REQUIRE(recorder.values.empty());
+        REQUIRE(event.GetQueuedCount() == 3);
+
+        event.Flush();
+
+        REQUIRE(recorder.values == std::vector<int>{ 1, 2, 3 });
+        REQUIRE(event.GetQueuedCount() == 0);
+
+        event.Flush();
+        REQUIRE(recorder.values.size() == 3);
+    }
+}
+
+TEST_CASE("Event handles unsubscribing during dispatch", "[EventBus]") {
+    IntEvent event;
+    Unsubscriber unsubscriber;
+    Recorder later;
+
+    unsubscriber.event = &event;
+
+    SECTION("removing a later subscriber stops it right away") {
+        event.Subscribe<Unsubscriber, &Unsubscriber::OnValue>(&unsubscriber);
+        unsubscriber.target = event.Subscribe<Recorder, &Recorder::OnValue>(&later);
+
+        event.Dispatch(1);
+        event.Dispatch(2);
+
+        REQUIRE(unsubscriber.values == std::vector<int>{ 1, 2 });
+        REQUIRE(later.values.empty());
+    }
+
+    SECTION("removing itself") {
+        unsubscriber.target = event.Subscribe<Unsubscriber, &Unsubscriber::OnValue>(&unsubscriber);
+        event.Subscribe<Recorder, &Recorder::OnValue>(&later);
+
+        event.Post(1);
+        event.Post(2);
+        event.Flush();
+
+        REQUIRE(unsubscriber.values == std::vector<int>{ 1 });
+        REQUIRE(later.values == std::vector<int>{ 1, 2 });
+    }
+}
+
+TEST_CASE("Event defers subscribers added during dispatch", "[EventBus]") {
+    IntEvent event;
+    Recorder added;
+
+    struct Adder {
+        IntEvent* event;
+        Recorder* recorder;
+
+        void OnValue(int value) {
+            if (value == 1)
+                event->Subscribe<Recorder, &Recorder::OnValue>(recorder);
+        }
+    } adder{ &event, &added };
+
+    event.Subscribe<Adder, &Adder::OnValue>(&adder);
+
+    event.Dispatch(1);
+    event.Dispatch(2);
+
+    REQUIRE(added.values == std::vector<int>{ 2 });
+}
+
+TEST_CASE("Event Flush called from a subscriber keeps the order", "[EventBus]") {
+    IntEvent event;
+    Flusher flusher;
+
+    flusher.event = &event;
+    event.Subscribe<Flusher, &Flusher::OnValue>(&flusher);
+
+    event.Post(1);
+    event.Post(2);
+    event.Post(3);
+    event.Flush();
+
+    REQUIRE(flusher.values == std::vector<int>{ 1, 2, 3 });
+    REQUIRE(event.GetQueuedCount() == 1);
+
+    event.Flush();
+
+    REQUIRE(flusher.values == std::vector<int>{ 1, 2, 3, 100 });
+}
+
+TEST_CASE("Event keeps working after a subscriber throws", "[EventBus]") {
+    IntEvent event;
+    Thrower thrower;
+
+    event.Subscribe<Thrower, &Thrower::OnValue>(&thrower);
+
+    event.Post(1);
+    event.Post(2);
+    event.Post(3);
+
+    REQUIRE_THROWS_AS(event.Flush(), std::runtime_error);
+    REQUIRE(thrower.values == std::vector<int>{ 1, 2 });
+
+    // The event after the one that threw is still queued, ahead of new ones.
+    REQUIRE(event.GetQueuedCount() == 1);
+    event.Post(4);
+    event.Flush();
+
+    REQUIRE(thrower.values == std::vector<int>{ 1, 2, 3, 4 });
+    REQUIRE(event.GetQueuedCount() == 0);
+
+    REQUIRE_THROWS_AS(event.Dispatch(2), std::runtime_error);
+    event.Dispatch(5);
+    REQUIRE(thrower.values.back() == 5);
+}
+
+TEST_CASE("Event passes reference arguments through", "[EventBus]") {
+    mc::util::Event<const std::string&> event;
+
+    struct Checker {
+        const std::string* expected;
+        bool same;
+
+        void OnValue(const std::string& value) {
+            same = &value == expected;
+        }
+    };
+
+    std::string value = "payload";
+    Checker checker{ &value, false };
+
+    event.Subscribe<Checker, &Checker::OnValue>(&checker);
+    event.Dispatch(value);
+
+    REQUIRE(checker.same);
+}
@@ -0,0 +1,183 @@
+#include "catch.hpp"
+
+#include <mclib/common/DataBuffer.h>
+#include <mclib/common/MCString.h>
+#include <mclib/common/VarInt.h>
+#include <mclib/entity/Metadata.h>
+
+#include <string>
+
+using mc::DataBuffer;
+using mc::entity::EntityMetadata;
+
+namespace {
+
+// 1.13 type ids, which are the same as the internal ones
+const mc::protocol::Version Version = mc::protocol::Version::Minecraft_1_13_2;
+
+enum WireType : u8 { Byte = 0, VarInt = 1, Float = 2, String = 3, Slot = 6, Boolean = 7 };
+
+// Starts a field the way a metadata packet sends it.
+DataBuffer& Field(DataBuffer& buffer, u8 index, WireType type) {
+    return buffer << index << (u8)type;
+}
+
+EntityMetadata Read(DataBuffer buffer) {
+    EntityMetadata metadata(Version);
+
+    buffer << (u8)0xFF;
+    buffer >> metadata;
+
+    return metadata;
+}
+
+std::string Write(const EntityMetadata& metadata) {
+    DataBuffer buffer;
+
+    buffer << metadata;
+    return buffer.ToString();
+}
+
+// Indices 35 and 40 go past the inline fields.
+EntityMetadata CreateMetadata() {
+    DataBuffer buffer;
+
+    Field(buffer, 0, Byte) << (u8)0x21;
+    Field(buffer, 2, String) << mc::MCString(L"Steve");
+    Field(buffer, 7, VarInt) << mc::VarInt(300);
+    Field(buffer, 9, Slot) << mc::inventory::Slot(1, 3, 0).Serialize(Version);
+    Field(buffer, 40, Float) << 1.5f;
+    Field(buffer, 35, Boolean) << true;
+
+    return Read(buffer);
+}
+
+std::wstring GetString(const EntityMetadata& metadata, std::size_t index) {
+    const EntityMetadata::StringType* value = metadata.GetIndex<EntityMetadata::StringType>(index);
+
+    REQUIRE(value);
+    return value->value;
+}
+
+void RequireCreated(const EntityMetadata& metadata) {
+    REQUIRE(metadata.GetIndex<EntityMetadata::ByteType>(0)->value == 0x21);
+    REQUIRE(GetString(metadata, 2) == L"Steve");
+    REQUIRE(metadata.GetIndex<EntityMetadata::VarIntType>(7)->value.GetInt() == 300);
+    REQUIRE(metadata.GetIndex<EntityMetadata::SlotType>(9)->value.GetItemId() == 1);
+    REQUIRE(metadata.GetIndex<EntityMetadata::SlotType>(9)->value.GetItemCount() == 3);
+    REQUIRE(metadata.GetIndex<EntityMetadata::BooleanType>(35)->value);
+    REQUIRE(metadata.GetIndex<EntityMetadata::FloatType>(40)->value == 1.5f);
+}
+
+} // ns
+
+TEST_CASE("EntityMetadata reads fields", "[Metadata]") {
+    EntityMetadata metadata = CreateMetadata();
+
+    RequireCreated(metadata);
+
+    REQUIRE_FALSE(metadata.HasIndex(1));
+    REQUIRE_FALSE(metadata.HasIndex(36));
+    // Asking for the wrong type doesn't reinterpret the value.
+    REQUIRE(metadata.GetIndex<EntityMetadata::FloatType>(0) == nullptr);
+    REQUIRE(metadata.GetIndex<EntityMetadata::StringType>(40) == nullptr);
+
+    metadata.Clear();
+
+    REQUIRE_FALSE(metadata.HasIndex(2));
+    REQUIRE_FALSE(metadata.HasIndex(40));
+}
+
+TEST_CASE("EntityMetadata writes the same bytes as before", "[Metadata]") {
+    // Fields go out by index, each behind a byte with the type in the top bits, and end with 0x7F.
+    DataBuffer expected;
+
+    expected << (u8)0x00 << (u8)0x21;
+    expected << (u8)((String << 5) | 2) << mc::MCString(L"Steve");
+    expected << (u8)((VarInt << 5) | 7) << mc::VarInt(300);
+    expected << (u8)((Slot << 5) | 9) << mc::inventory::Slot(1, 3, 0).Serialize(Version);
+    expected << (u8)((Boolean << 5) | (35 & 0x1F)) << true;
+    expected << (u8)((Float << 5) | (40 & 0x1F)) << 1.5f;
+    expected << (u8)0x7F;
+
+    REQUIRE(Write(CreateMetadata()) == expected.ToString());
+}
+
+TEST_CASE("EntityMetadata copies and moves its values", "[Metadata]") {
+    EntityMetadata original = CreateMetadata();
+    const std::string bytes = Write(original);
+
+    SECTION("copies own their strings and slots") {
+        EntityMetadata copy(original);
+        EntityMetadata assigned(mc::protocol::Version::Minecraft_1_12_2);
+
+        assigned = original;
+
+        RequireCreated(copy);
+        RequireCreated(assigned);
+        REQUIRE(copy.GetIndex<EntityMetadata::StringType>(2) != original.GetIndex<EntityMetadata::StringType>(2));
+        REQUIRE(copy.GetIndex<EntityMetadata::SlotType>(9) != original.GetIndex<EntityMetadata::SlotType>(9));
+
+        DataBuffer delta;
+        Field(delta, 2, String) << mc::MCString(L"Alex");
+        Field(delta, 35, Boolean) << false;
+        original.Merge(Read(delta));
+
+        REQUIRE(GetString(original, 2) == L"Alex");
+        RequireCreated(copy);
+        RequireCreated(assigned);
+        REQUIRE(Write(copy) == bytes);
+    }
+
+    SECTION("moves hand over the values") {
+        const EntityMetadata::StringType* string = original.GetIndex<EntityMetadata::StringType>(2);
+        EntityMetadata moved(std::move(original));
+
+        RequireCreated(moved);
+        REQUIRE(moved.GetIndex<EntityMetadata::StringType>(2) == string);
+
+        EntityMetadata assigned = CreateMetadata();
+        assigned = std::move(moved);
+
+        RequireCreated(assigned);
+        REQUIRE(Write(assigned) == bytes);
+    }
+}
+
+TEST_CASE("EntityMetadata Merge overwrites and adds indices", "[Metadata]") {
+    EntityMetadata metadata = CreateMetadata();
+    DataBuffer delta;
+
+    Field(delta, 2, String) << mc::MCString(L"Alex");
+    Field(delta, 3, Boolean) << false;
+    // Changes what kind of value is stored in an overflow field.
+    Field(delta, 40, String) << mc::MCString(L"overflow");
+    Field(delta, 50, VarInt) << mc::VarInt(7);
+    Field(delta, 45, Byte) << (u8)3;
+
+    metadata.Merge(Read(delta));
+
+    REQUIRE(metadata.GetIndex<EntityMetadata::ByteType>(0)->value == 0x21);
+    REQUIRE(GetString(metadata, 2) == L"Alex");
+    REQUIRE_FALSE(metadata.GetIndex<EntityMetadata::BooleanType>(3)->value);
+    REQUIRE(metadata.GetIndex<EntityMetadata::VarIntType>(7)->value.GetInt() == 300);
+    REQUIRE(metadata.GetIndex<EntityMetadata::FloatType>(40) == nullptr);
+    REQUIRE(GetString(metadata, 40) == L"overflow");
+    REQUIRE(metadata.GetIndex<EntityMetadata::ByteType>(45)->value == 3);
+    REQUIRE(metadata.GetIndex<EntityMetadata::VarIntType>(50)->value.GetInt() == 7);
+
+    // Merged overflow fields are written in index order, like a metadata read all at once.
+    DataBuffer merged;
+
+    Field(merged, 0, Byte) << (u8)0x21;
+    Field(merged, 2, String) << mc::MCString(L"Alex");
+    Field(merged, 3, Boolean) << false;
+    Field(merged, 7, VarInt) << mc::VarInt(300);
+    Field(merged, 9, Slot) << mc::inventory::Slot(1, 3, 0).Serialize(Version);
+    Field(merged, 35, Boolean) << true;
+    Field(merged, 40, String) << mc::MCString(L"overflow");
+    Field(merged, 45, Byte) << (u8)3;
+    Field(merged, 50, VarInt) << mc::VarInt(7);
+
+    REQUIRE(Write(metadata) == Write(Read(merged)));
+}
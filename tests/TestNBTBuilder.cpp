@@ -0,0 +1,162 @@
+#include "catch.hpp"
+
+#include <mclib/common/DataBuffer.h>
+#include <mclib/nbt/Builder.h>
+#include <mclib/nbt/NBT.h>
+
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace {
+
+// The same tree in both representations: every tag type, nested compounds and lists, and an empty list.
+void BuildTree(mc::nbt::Builder& builder) {
+    using namespace mc::nbt;
+
+    builder.SetRootName("tag");
+
+    BuilderNode* root = builder.GetRoot();
+
+    builder.AddByte(root, "Byte", 0xFE);
+    builder.AddShort(root, "Short", -12345);
+    builder.AddInt(root, "Int", std::numeric_limits<s32>::min());
+    builder.AddLong(root, "Long", 0x0123456789ABCDEFLL);
+    builder.AddFloat(root, "Float", 1.5f);
+    builder.AddDouble(root, "Double", -0.125);
+    builder.AddString(root, "String", "Firework Rocket");
+    builder.AddString(root, "Empty", "");
+
+    const u8 bytes[] = { 1, 2, 3, 0xFF };
+    builder.AddByteArray(root, builder.GetKeys().Intern("ByteArray"), bytes, sizeof(bytes));
+    builder.AddIntArray(root, "IntArray", std::vector<s32>{ 0x1E2D3C, -1, 0 });
+
+    BuilderNode* fireworks = builder.AddCompound(root, "Fireworks");
+    builder.AddByte(fireworks, "Flight", 2);
+
+    BuilderNode* explosions = builder.AddList(fireworks, "Explosions", TagType::Compound);
+
+    for (u8 type = 0; type < 3; ++type) {
+        BuilderNode* explosion = builder.AddCompound(explosions, "");
+
+        builder.AddByte(explosion, "Type", type);
+        builder.AddIntArray(explosion, "Colors", std::vector<s32>{ type * 100, type * 200 });
+    }
+
+    BuilderNode* lore = builder.AddList(root, "Lore", TagType::String);
+    builder.AddString(lore, "", "first");
+    builder.AddString(lore, "", "second");
+
+    builder.AddList(root, "Nothing", TagType::Int);
+}
+
+void BuildTree(mc::nbt::NBT& nbt) {
+    using namespace mc::nbt;
+
+    TagCompound& root = nbt.GetRoot();
+
+    root.SetName(L"tag");
+
+    root.AddItem(TagType::Byte, TagPtr(new TagByte("Byte", 0xFE)));
+    root.AddItem(TagType::Short, TagPtr(new TagShort("Short", -12345)));
+    root.AddItem(TagType::Int, TagPtr(new TagInt("Int", std::numeric_limits<s32>::min())));
+    root.AddItem(TagType::Long, TagPtr(new TagLong("Long", 0x0123456789ABCDEFLL)));
+    root.AddItem(TagType::Float, TagPtr(new TagFloat("Float", 1.5f)));
+    root.AddItem(TagType::Double, TagPtr(new TagDouble("Double", -0.125)));
+    root.AddItem(TagType::String, TagPtr(new TagString("String", "Firework Rocket")));
+    root.AddItem(TagType::String, TagPtr(new TagString("Empty", "")));
+    root.AddItem(TagType::ByteArray, TagPtr(new TagByteArray("ByteArray", std::string("\x01\x02\x03\xFF", 4))));
+    root.AddItem(TagType::IntArray, TagPtr(new TagIntArray("IntArray", std::vector<s32>{ 0x1E2D3C, -1, 0 })));
+
+    TagCompound* fireworks = new TagCompound("Fireworks");
+    fireworks->AddItem(TagType::Byte, TagPtr(new TagByte("Flight", 2)));
+
+    TagList* explosions = new TagList("Explosions", TagType::Compound);
+
+    for (u8 type = 0; type < 3; ++type) {
+        TagCompound* explosion = new TagCompound("");
+
+        explosion->AddItem(TagType::Byte, TagPtr(new TagByte("Type", type)));
+        explosion->AddItem(TagType::IntArray, TagPtr(new TagIntArray("Colors", std::vector<s32>{ type * 100, type * 200 })));
+        explosions->AddItem(TagPtr(explosion));
+    }
+
+    fireworks->AddItem(TagType::List, TagPtr(explosions));
+    root.AddItem(TagType::Compound, TagPtr(fireworks));
+
+    TagList* lore = new TagList("Lore", TagType::String);
+    lore->AddItem(TagPtr(new TagString("", "first")));
+    lore->AddItem(TagPtr(new TagString("", "second")));
+    root.AddItem(TagType::List, TagPtr(lore));
+
+    root.AddItem(TagType::List, TagPtr(new TagList("Nothing", TagType::Int)));
+}
+
+std::string Serialize(const mc::nbt::NBT& nbt) {
+    mc::DataBuffer buffer;
+
+    buffer << nbt;
+    return buffer.ToString();
+}
+
+} // ns
+
+TEST_CASE("Builder writes the same bytes as NBT", "[NBTBuilder]") {
+    mc::nbt::NBT nbt;
+    BuildTree(nbt);
+
+    const std::string expected = Serialize(nbt);
+
+    mc::nbt::Builder builder;
+    BuildTree(builder);
+
+    SECTION("serialized size is exact") {
+        REQUIRE(builder.GetSerializedSize() == expected.size());
+    }
+
+    SECTION("writing to a DataBuffer") {
+        mc::DataBuffer buffer;
+
+        buffer << builder;
+        REQUIRE(buffer.ToString() == expected);
+    }
+
+    SECTION("writing to a caller buffer") {
+        std::vector<u8> out(expected.size());
+
+        REQUIRE(builder.Write(out.data(), out.size() - 1) == 0);
+        REQUIRE(builder.Write(out.data(), out.size()) == expected.size());
+        REQUIRE(std::string(out.begin(), out.end()) == expected);
+    }
+
+    SECTION("converting back to NBT") {
+        mc::nbt::NBT converted;
+        converted.SetRoot(builder.ToCompound());
+
+        REQUIRE(Serialize(converted) == expected);
+    }
+}
+
+TEST_CASE("Builder output is unchanged after a reset", "[NBTBuilder]") {
+    mc::nbt::KeyTable keys;
+    mc::nbt::Builder builder(keys, 64);
+
+    BuildTree(builder);
+
+    mc::DataBuffer first;
+    first << builder;
+
+    std::size_t keyCount = keys.GetSize();
+
+    builder.Reset();
+    REQUIRE_FALSE(builder.HasData());
+
+    BuildTree(builder);
+
+    mc::DataBuffer second;
+    second << builder;
+
+    REQUIRE(second.ToString() == first.ToString());
+    // Every name was interned the first time around.
+    REQUIRE(keys.GetSize() == keyCount);
+}
@@ -0,0 +1,208 @@
+#include "catch.hpp"
+
+#include <mclib/common/DataBuffer.h>
+#include <mclib/common/VarInt.h>
+#include <mclib/core/Compression.h>
+#include <mclib/core/Encryption.h>
+#include <mclib/core/PacketPipeline.h>
+#include <mclib/network/Socket.h>
+#include <mclib/protocol/packets/Packet.h>
+#include <mclib/protocol/packets/PacketFactory.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using mc::DataBuffer;
+using mc::core::PacketPipeline;
+
+namespace {
+
+const mc::protocol::Version Version = mc::protocol::Version::Minecraft_1_12_2;
+
+// 1.12.2 play ids
+const s32 KeepAliveId = 0x1F;
+const s32 ChunkDataId = 0x20;
+
+// Hands out what it was fed a few bytes at a time, so frames arrive split up.
+class FakeSocket : public mc::network::Socket {
+private:
+    std::mutex m_Mutex;
+    std::string m_Data;
+    std::atomic<bool> m_CloseWhenEmpty;
+
+public:
+    FakeSocket() : Socket(TCP), m_CloseWhenEmpty(false) {
+        SetStatus(Connected);
+    }
+
+    void Feed(const DataBuffer& data) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Data += data.ToString();
+    }
+
+    // Disconnects once everything fed so far was received.
+    void Close() { m_CloseWhenEmpty = true; }
+
+    bool Connect(const mc::network::IPAddress& address, u16 port) override { return true; }
+    std::size_t Send(const uint8_t* data, std::size_t size) override { return size; }
+
+    DataBuffer Receive(std::size_t amount) override {
+        DataBuffer buffer;
+        Receive(buffer, amount);
+        return buffer;
+    }
+
+    std::size_t Receive(DataBuffer& buffer, std::size_t amount) override {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        std::size_t size = std::min<std::size_t>(std::min<std::size_t>(amount, 7), m_Data.size());
+
+        buffer = DataBuffer(m_Data.substr(0, size));
+        m_Data.erase(0, size);
+
+        if (m_Data.empty() && m_CloseWhenEmpty)
+            SetStatus(Disconnected);
+
+        return size;
+    }
+};
+
+void AddFrame(DataBuffer& stream, const DataBuffer& payload) {
+    stream << mc::VarInt((s32)payload.GetSize());
+    stream << payload;
+}
+
+void AddKeepAlive(DataBuffer& stream, s64 id) {
+    DataBuffer payload;
+
+    payload << mc::VarInt(KeepAliveId) << id;
+    AddFrame(stream, payload);
+}
+
+// An empty column, which is all that's read before the column is requested.
+void AddChunkData(DataBuffer& stream, s32 x, s32 z) {
+    DataBuffer payload;
+
+    payload << mc::VarInt(ChunkDataId) << x << z << true << mc::VarInt(0) << mc::VarInt(256);
+    payload << std::string(256, '\x01');
+    payload << mc::VarInt(0);
+    AddFrame(stream, payload);
+}
+
+// What a packet was, keepalives by id and chunks by x
+std::string Describe(mc::protocol::packets::Packet* packet) {
+    using namespace mc::protocol::packets;
+
+    if (auto keepAlive = dynamic_cast<in::KeepAlivePacket*>(packet))
+        return "k" + std::to_string(keepAlive->GetAliveId());
+    if (auto chunk = dynamic_cast<in::ChunkDataPacket*>(packet))
+        return "c" + std::to_string(chunk->GetMetadata().x);
+
+    return "?";
+}
+
+// Polls the way Connection does until the pipeline closes, or gives up after a few seconds.
+std::vector<std::string> PollAll(PacketPipeline& pipeline) {
+    std::vector<std::string> received;
+    auto end = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+
+    while (std::chrono::steady_clock::now() < end) {
+        bool closed = pipeline.IsClosed();
+
+        while (mc::protocol::packets::Packet* packet = pipeline.Poll()) {
+            received.push_back(Describe(packet));
+            mc::protocol::packets::PacketFactory::FreePacket(packet);
+        }
+
+        if (closed) break;
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    return received;
+}
+
+struct PipelineFixture {
+    FakeSocket socket;
+    mc::core::EncryptionStrategyNone encrypter;
+    mc::core::CompressionNone compressor;
+    PacketPipeline pipeline;
+
+    // Small queues, so the stages have to wait on each other.
+    PipelineFixture()
+        : pipeline(nullptr, mc::protocol::Protocol::GetProtocol(Version), &socket, &encrypter, &compressor, 4)
+    {
+    }
+};
+
+} // ns
+
+TEST_CASE("PacketPipeline hands packets over in the order they arrived", "[PacketPipeline]") {
+    PipelineFixture fixture;
+    DataBuffer pending;
+    DataBuffer stream;
+    std::vector<std::string> expected;
+
+    // Part of the stream was already received before the pipeline started.
+    AddKeepAlive(pending, 100);
+    AddChunkData(pending, -1, 0);
+    expected = { "k100", "c-1" };
+
+    for (s32 i = 0; i < 60; ++i) {
+        AddKeepAlive(stream, i);
+        AddChunkData(stream, i, 0);
+        expected.push_back("k" + std::to_string(i));
+        expected.push_back("c" + std::to_string(i));
+    }
+
+    fixture.socket.Feed(stream);
+    fixture.socket.Close();
+    fixture.pipeline.Start(pending);
+
+    REQUIRE(PollAll(fixture.pipeline) == expected);
+    REQUIRE(fixture.pipeline.IsClosed());
+
+    mc::core::PipelineStats stats = fixture.pipeline.GetStats();
+
+    REQUIRE(stats.decode.processed == expected.size());
+    REQUIRE(stats.apply.processed == expected.size());
+    REQUIRE(stats.decode.maxDepth <= 4);
+    REQUIRE(stats.decodeErrors == 0);
+}
+
+TEST_CASE("PacketPipeline stops at a zero length frame", "[PacketPipeline]") {
+    PipelineFixture fixture;
+    DataBuffer stream;
+
+    AddKeepAlive(stream, 1);
+    AddChunkData(stream, 2, 0);
+    stream << mc::VarInt(0);
+    AddKeepAlive(stream, 3);
+
+    // The socket stays connected, so only the bad length can close the pipeline.
+    fixture.socket.Feed(stream);
+    fixture.pipeline.Start(DataBuffer());
+
+    REQUIRE(PollAll(fixture.pipeline) == std::vector<std::string>{ "k1", "c2" });
+    REQUIRE(fixture.pipeline.IsClosed());
+    REQUIRE(fixture.pipeline.GetStats().decodeErrors == 1);
+}
+
+TEST_CASE("PacketPipeline frees packets that weren't polled", "[PacketPipeline]") {
+    PipelineFixture fixture;
+    DataBuffer stream;
+
+    for (s32 i = 0; i < 20; ++i)
+        AddChunkData(stream, i, i);
+
+    fixture.socket.Feed(stream);
+    fixture.pipeline.Start(DataBuffer());
+    fixture.pipeline.Stop();
+
+    REQUIRE_FALSE(fixture.pipeline.IsRunning());
+    REQUIRE(fixture.pipeline.Poll() == nullptr);
+}
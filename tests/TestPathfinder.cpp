@@ -0,0 +1,381 @@
+#include "catch.hpp"
+
+#include <mclib/common/DataBuffer.h>
+#include <mclib/common/VarInt.h>
+#include <mclib/protocol/packets/Packet.h>
+#include <mclib/protocol/packets/PacketDispatcher.h>
+#include <mclib/world/IncrementalPathfinder.h>
+#include <mclib/world/NavigationGrid.h>
+#include <mclib/world/Pathfinder.h>
+#include <mclib/world/World.h>
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+using mc::world::PathEdge;
+using mc::world::Pathfinder;
+
+namespace {
+
+const u32 Stone = 1 << 4;
+const u32 Magma = 213 << 4;
+
+typedef std::vector<std::pair<mc::Vector3i, u32>> BlockList;
+
+// Sets up a world with the columns from 0, 0 to size - 1, size - 1 loaded and empty.
+struct TestWorld {
+    mc::protocol::packets::PacketDispatcher dispatcher;
+    mc::world::World world;
+    mc::world::NavigationGrid grid;
+    Pathfinder pathfinder;
+
+    TestWorld(s32 size)
+        : world(&dispatcher, mc::block::BlockRegistry::GetInstance(mc::protocol::Version::Minecraft_1_12_2)),
+          grid(world),
+          pathfinder(grid)
+    {
+        for (s32 x = 0; x < size; ++x) {
+            for (s32 z = 0; z < size; ++z) {
+                mc::DataBuffer buffer;
+
+                buffer << x << z << false << mc::VarInt(0) << mc::VarInt(0) << mc::VarInt(0);
+
+                mc::protocol::packets::in::ChunkDataPacket packet;
+                packet.Deserialize(buffer, buffer.GetSize());
+                world.HandlePacket(&packet);
+            }
+        }
+    }
+
+    void SetBlocks(const BlockList& blocks) {
+        std::map<std::pair<s32, s32>, BlockList> columns;
+
+        for (const auto& block : blocks)
+            columns[std::make_pair((s32)(block.first.x >> 4), (s32)(block.first.z >> 4))].push_back(block);
+
+        for (const auto& column : columns) {
+            mc::DataBuffer buffer;
+
+            buffer << column.first.first << column.first.second << mc::VarInt((s32)column.second.size());
+
+            for (const auto& block : column.second) {
+                const mc::Vector3i& position = block.first;
+
+                buffer << (u8)(((position.x & 15) << 4) | (position.z & 15)) << (u8)position.y << mc::VarInt((s32)block.second);
+            }
+
+            mc::protocol::packets::in::MultiBlockChangePacket packet;
+            packet.Deserialize(buffer, buffer.GetSize());
+            world.HandlePacket(&packet);
+        }
+    }
+
+    void SetBlock(const mc::Vector3i& position, u32 data) {
+        SetBlocks(BlockList{ std::make_pair(position, data) });
+    }
+
+    // Stone floor with its top at y = 9, so feet are at y = 10.
+    void CreateFloor(s64 size) {
+        BlockList blocks;
+
+        for (s64 x = 0; x < size; ++x) {
+            for (s64 z = 0; z < size; ++z)
+                blocks.emplace_back(mc::Vector3i(x, 9, z), Stone);
+        }
+
+        SetBlocks(blocks);
+    }
+
+    std::vector<PathEdge> GetNeighbors(const mc::Vector3i& from) {
+        std::vector<PathEdge> edges;
+
+        pathfinder.GetNeighbors(from, edges);
+        return edges;
+    }
+
+    // Cost of every move along the path, infinity if one of them can't be made.
+    double GetPathCost(const mc::world::Path& path) {
+        double cost = 0.0;
+
+        for (std::size_t i = 1; i < path.nodes.size(); ++i)
+            cost += pathfinder.GetMoveCost(path.nodes[i - 1], path.nodes[i]);
+
+        return cost;
+    }
+};
+
+const PathEdge* FindEdge(const std::vector<PathEdge>& edges, const mc::Vector3i& to) {
+    for (const PathEdge& edge : edges) {
+        if (edge.to == to) return &edge;
+    }
+
+    return nullptr;
+}
+
+bool HasEdgeTowards(const std::vector<PathEdge>& edges, s64 x, s64 z) {
+    for (const PathEdge& edge : edges) {
+        if (edge.to.x == x && edge.to.z == z) return true;
+    }
+
+    return false;
+}
+
+} // ns
+
+TEST_CASE("Pathfinder walks to all eight neighbors on flat ground", "[Pathfinder]") {
+    TestWorld test(1);
+    test.CreateFloor(16);
+
+    std::vector<PathEdge> edges = test.GetNeighbors(mc::Vector3i(5, 10, 5));
+
+    REQUIRE(edges.size() == 8);
+
+    for (const PathEdge& edge : edges) {
+        bool diagonal = edge.to.x != 5 && edge.to.z != 5;
+
+        REQUIRE(edge.to.y == 10);
+        REQUIRE(edge.cost == Approx(diagonal ? Pathfinder::DiagonalCost : Pathfinder::WalkCost));
+    }
+
+    SECTION("the edge of the loaded area") {
+        edges = test.GetNeighbors(mc::Vector3i(0, 10, 0));
+
+        REQUIRE(edges.size() == 3);
+    }
+
+    SECTION("positions that can't be stood on") {
+        REQUIRE_FALSE(test.grid.IsStandable(5, 11, 5));
+        REQUIRE(test.grid.IsStandable(5, 10, 5));
+        REQUIRE(test.pathfinder.GetMoveCost(mc::Vector3i(5, 11, 5), mc::Vector3i(6, 11, 5)) == std::numeric_limits<double>::infinity());
+    }
+}
+
+TEST_CASE("Pathfinder jumps up one block", "[Pathfinder]") {
+    TestWorld test(1);
+    test.CreateFloor(16);
+    test.SetBlock(mc::Vector3i(6, 10, 5), Stone);
+
+    const mc::Vector3i from(5, 10, 5);
+    const mc::Vector3i top(6, 11, 5);
+
+    SECTION("with room above") {
+        std::vector<PathEdge> edges = test.GetNeighbors(from);
+        const PathEdge* jump = FindEdge(edges, top);
+
+        REQUIRE(jump);
+        REQUIRE(jump->cost == Approx(Pathfinder::JumpCost));
+        REQUIRE(test.pathfinder.GetMoveCost(from, top) == Approx(Pathfinder::JumpCost));
+
+        // Walking back down off of it
+        REQUIRE(test.pathfinder.GetMoveCost(top, from) == Approx(Pathfinder::WalkCost + Pathfinder::DropCost));
+    }
+
+    SECTION("not with a ceiling over the start") {
+        test.SetBlock(mc::Vector3i(5, 12, 5), Stone);
+
+        REQUIRE_FALSE(FindEdge(test.GetNeighbors(from), top));
+        REQUIRE(test.pathfinder.GetMoveCost(from, top) == std::numeric_limits<double>::infinity());
+    }
+
+    SECTION("not up two blocks") {
+        test.SetBlock(mc::Vector3i(6, 11, 5), Stone);
+
+        REQUIRE_FALSE(HasEdgeTowards(test.GetNeighbors(from), 6, 5));
+    }
+
+    SECTION("diagonals don't cut the corner") {
+        std::vector<PathEdge> edges = test.GetNeighbors(from);
+
+        REQUIRE_FALSE(HasEdgeTowards(edges, 6, 6));
+        REQUIRE_FALSE(HasEdgeTowards(edges, 6, 4));
+        REQUIRE(FindEdge(edges, mc::Vector3i(4, 10, 6)));
+        REQUIRE(test.pathfinder.GetMoveCost(from, mc::Vector3i(6, 10, 6)) == std::numeric_limits<double>::infinity());
+    }
+}
+
+TEST_CASE("Pathfinder drops down ledges", "[Pathfinder]") {
+    TestWorld test(1);
+    test.CreateFloor(16);
+
+    // A pit three blocks deep to the east
+    test.SetBlocks(BlockList{
+        std::make_pair(mc::Vector3i(6, 9, 5), 0u), std::make_pair(mc::Vector3i(6, 8, 5), 0u),
+        std::make_pair(mc::Vector3i(6, 7, 5), 0u), std::make_pair(mc::Vector3i(6, 6, 5), Stone)
+    });
+
+    const mc::Vector3i from(5, 10, 5);
+    const mc::Vector3i bottom(6, 7, 5);
+
+    SECTION("up to the max drop") {
+        const PathEdge* drop = FindEdge(test.GetNeighbors(from), bottom);
+
+        REQUIRE(drop);
+        REQUIRE(drop->cost == Approx(Pathfinder::WalkCost + 3 * Pathfinder::DropCost));
+        REQUIRE(test.pathfinder.GetMoveCost(from, bottom) == Approx(drop->cost));
+
+        // No way back up
+        REQUIRE_FALSE(HasEdgeTowards(test.GetNeighbors(bottom), 5, 5));
+    }
+
+    SECTION("not further") {
+        test.pathfinder.SetMaxDrop(2);
+
+        REQUIRE_FALSE(HasEdgeTowards(test.GetNeighbors(from), 6, 5));
+        REQUIRE(test.pathfinder.GetMoveCost(from, bottom) == std::numeric_limits<double>::infinity());
+    }
+
+    SECTION("only onto the first block below") {
+        test.SetBlock(mc::Vector3i(6, 8, 5), Stone);
+
+        REQUIRE(FindEdge(test.GetNeighbors(from), mc::Vector3i(6, 9, 5)));
+        REQUIRE(test.pathfinder.GetMoveCost(from, bottom) == std::numeric_limits<double>::infinity());
+    }
+}
+
+TEST_CASE("Pathfinder doesn't stand on hazards", "[Pathfinder]") {
+    TestWorld test(1);
+    test.CreateFloor(16);
+    test.SetBlock(mc::Vector3i(6, 9, 5), Magma);
+
+    REQUIRE_FALSE(test.grid.IsStandable(6, 10, 5));
+    REQUIRE_FALSE(HasEdgeTowards(test.GetNeighbors(mc::Vector3i(5, 10, 5)), 6, 5));
+
+    mc::world::Path path = test.pathfinder.FindPath(mc::Vector3i(5, 10, 5), mc::Vector3i(7, 10, 5));
+
+    REQUIRE(path.complete);
+    REQUIRE(path.nodes.size() == 3);
+    REQUIRE(test.GetPathCost(path) == Approx(2 * Pathfinder::DiagonalCost));
+}
+
+TEST_CASE("Pathfinder move rules agree with each other", "[Pathfinder]") {
+    TestWorld test(2);
+    std::mt19937 random(3);
+    std::uniform_int_distribution<s32> height(0, 3);
+    BlockList blocks;
+
+    // Uneven ground with steps of up to three blocks
+    for (s64 x = 0; x < 32; ++x) {
+        for (s64 z = 0; z < 32; ++z) {
+            s32 top = 8 + height(random);
+
+            for (s64 y = 6; y <= top; ++y)
+                blocks.emplace_back(mc::Vector3i(x, y, z), Stone);
+        }
+    }
+
+    test.SetBlocks(blocks);
+
+    std::size_t checked = 0;
+
+    for (s64 x = 1; x < 31; ++x) {
+        for (s64 z = 1; z < 31; ++z) {
+            for (s64 y = 7; y <= 12; ++y) {
+                mc::Vector3i from(x, y, z);
+                if (!test.grid.IsStandable(from)) continue;
+
+                for (const PathEdge& edge : test.GetNeighbors(from)) {
+                    REQUIRE(test.pathfinder.GetMoveCost(from, edge.to) == Approx(edge.cost));
+                    REQUIRE(Pathfinder::EstimateCost(from, edge.to) <= edge.cost + 1e-9);
+
+                    std::vector<PathEdge> predecessors;
+                    test.pathfinder.GetPredecessors(edge.to, predecessors);
+
+                    const PathEdge* back = FindEdge(predecessors, from);
+                    REQUIRE(back);
+                    REQUIRE(back->cost == Approx(edge.cost));
+                    ++checked;
+                }
+            }
+        }
+    }
+
+    REQUIRE(checked > 1000);
+}
+
+TEST_CASE("IncrementalPathfinder finds paths as cheap as Pathfinder after edits", "[Pathfinder]") {
+    const s64 Size = 48;
+    TestWorld test(3);
+    mc::world::IncrementalPathfinder planner(test.pathfinder);
+    std::mt19937 random(17);
+    std::uniform_int_distribution<s64> coord(0, Size - 1);
+    std::uniform_int_distribution<s32> chance(0, 99);
+    BlockList blocks;
+
+    // Ground at two heights, with two block high walls on it
+    auto getFeet = [](s64 x, s64 z) { return mc::Vector3i(x, 10 + ((x / 6 + z / 5) % 3 == 0 ? 1 : 0), z); };
+
+    for (s64 x = 0; x < Size; ++x) {
+        for (s64 z = 0; z < Size; ++z) {
+            mc::Vector3i feet = getFeet(x, z);
+
+            for (s64 y = 8; y < feet.y; ++y)
+                blocks.emplace_back(mc::Vector3i(x, y, z), Stone);
+
+            if (chance(random) < 15) {
+                blocks.emplace_back(feet, Stone);
+                blocks.emplace_back(mc::Vector3i(x, feet.y + 1, z), Stone);
+            }
+        }
+    }
+
+    test.SetBlocks(blocks);
+
+    const mc::Vector3i goal = getFeet(Size - 3, Size - 3);
+    mc::Vector3i start = getFeet(2, 2);
+
+    // Keep the ends clear so there is something to search for.
+    for (const mc::Vector3i& end : { goal, start }) {
+        test.SetBlock(end, 0);
+        test.SetBlock(mc::Vector3i(end.x, end.y + 1, end.z), 0);
+    }
+
+    REQUIRE(test.grid.IsStandable(goal));
+    REQUIRE(test.grid.IsStandable(start));
+
+    planner.SetGoal(goal);
+
+    std::size_t completed = 0;
+
+    for (int round = 0; round < 40; ++round) {
+        mc::world::Path expected = test.pathfinder.FindPath(start, goal);
+        mc::world::Path path = planner.FindPath(start);
+
+        REQUIRE(path.complete == expected.complete);
+        REQUIRE(path.nodes.front() == start);
+
+        if (expected.complete) {
+            REQUIRE(path.nodes.back() == goal);
+            REQUIRE(test.GetPathCost(path) == Approx(test.GetPathCost(expected)));
+            ++completed;
+
+            // Walk part of the way, which the planner handles without searching again.
+            if (round % 3 == 0 && path.nodes.size() > 4)
+                start = path.nodes[3];
+        }
+
+        // Open and close walls, away from the two ends
+        blocks.clear();
+
+        for (int i = 0; i < 12; ++i) {
+            s64 x = coord(random);
+            s64 z = coord(random);
+            mc::Vector3i feet = getFeet(x, z);
+
+            if ((feet.x == goal.x && feet.z == goal.z) || (feet.x == start.x && feet.z == start.z)) continue;
+
+            u32 data = chance(random) < 50 ? Stone : 0;
+
+            blocks.emplace_back(feet, data);
+            blocks.emplace_back(mc::Vector3i(feet.x, feet.y + 1, feet.z), data);
+        }
+
+        test.SetBlocks(blocks);
+    }
+
+    REQUIRE(completed > 20);
+    REQUIRE(planner.GetStats().repairs > 0);
+}
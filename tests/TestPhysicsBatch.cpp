@@ -0,0 +1,268 @@
+#include "catch.hpp"
+
+#include <mclib/block/Block.h>
+#include <mclib/common/DataBuffer.h>
+#include <mclib/common/VarInt.h>
+#include <mclib/protocol/packets/Packet.h>
+#include <mclib/protocol/packets/PacketDispatcher.h>
+#include <mclib/world/Collision.h>
+#include <mclib/world/PhysicsBatch.h>
+#include <mclib/world/World.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace {
+
+const u32 Stone = 1 << 4;
+// Same as PlayerController
+const double StepHeight = 0.6;
+const double JumpHeight = 1.25;
+const double Speed = 4.3;
+const double TickTime = 0.05;
+const s64 WallHeight = 4;
+
+const mc::block::BlockRegistry* GetRegistry() {
+    return mc::block::BlockRegistry::GetInstance(mc::protocol::Version::Minecraft_1_12_2);
+}
+
+void CreateColumn(mc::world::World& world, s32 x, s32 z) {
+    mc::DataBuffer buffer;
+
+    buffer << x << z << false << mc::VarInt(0) << mc::VarInt(0) << mc::VarInt(0);
+
+    mc::protocol::packets::in::ChunkDataPacket packet;
+    packet.Deserialize(buffer, buffer.GetSize());
+    world.HandlePacket(&packet);
+}
+
+void SetBlocks(mc::world::World& world, s32 chunkX, s32 chunkZ, const std::vector<mc::Vector3i>& positions, u32 blockData) {
+    mc::DataBuffer buffer;
+
+    buffer << chunkX << chunkZ << mc::VarInt((s32)positions.size());
+
+    for (const mc::Vector3i& position : positions)
+        buffer << (u8)(((position.x & 15) << 4) | (position.z & 15)) << (u8)position.y << mc::VarInt((s32)blockData);
+
+    mc::protocol::packets::in::MultiBlockChangePacket packet;
+    packet.Deserialize(buffer, buffer.GetSize());
+    world.HandlePacket(&packet);
+}
+
+// Stone at x, z from the floor at y 9 up to height blocks above it, and air over that
+void Fill(mc::world::World& world, s64 x, s64 z, s64 height) {
+    std::vector<mc::Vector3i> stone;
+    std::vector<mc::Vector3i> air;
+
+    for (s64 y = 9; y <= 9 + WallHeight; ++y) {
+        if (y <= 9 + height)
+            stone.emplace_back(x, y, z);
+        else
+            air.emplace_back(x, y, z);
+    }
+
+    SetBlocks(world, (s32)(x >> 4), (s32)(z >> 4), stone, Stone);
+    if (!air.empty())
+        SetBlocks(world, (s32)(x >> 4), (s32)(z >> 4), air, 0);
+}
+
+// A walled in floor over the columns 0, 0 and 1, 0 with two walls across it and ledges of one and two blocks.
+// The walls are too high to jump onto even from the ledges.
+void CreateTerrain(mc::world::World& world, std::mt19937& random) {
+    CreateColumn(world, 0, 0);
+    CreateColumn(world, 1, 0);
+
+    for (s64 x = 0; x < 32; ++x) {
+        for (s64 z = 0; z < 16; ++z) {
+            bool wall = x == 0 || x == 31 || z == 0 || z == 15 || (x == 8 && z >= 2 && z <= 12) || (x == 24 && z >= 3);
+
+            Fill(world, x, z, wall ? WallHeight : 0);
+        }
+    }
+
+    std::uniform_int_distribution<s64> x(1, 30);
+    std::uniform_int_distribution<s64> z(1, 14);
+
+    for (int i = 0; i < 40; ++i) {
+        s64 ledgeX = x(random);
+        s64 ledgeZ = z(random);
+
+        if (ledgeX != 8 && ledgeX != 24)
+            Fill(world, ledgeX, ledgeZ, i < 30 ? 1 : 2);
+    }
+}
+
+// Without the rounding error that stopping at a block leaves, like PlayerController::HandleJump
+mc::AABB Shrink(mc::AABB box) {
+    box.min.x += mc::world::StuckTolerance;
+    box.min.z += mc::world::StuckTolerance;
+    box.max.x -= mc::world::StuckTolerance;
+    box.max.z -= mc::world::StuckTolerance;
+
+    return box;
+}
+
+// What PlayerController does each tick without a batch: walk towards the target, climb out of a block it's stuck in or else fall.
+struct Walker {
+    mc::Vector3d position;
+    mc::Vector3d target;
+    double stepHeight;
+    bool onGround;
+
+    void Step(mc::world::Collider& collider, const mc::AABB& bounds, double fall) {
+        double dx = target.x - position.x;
+        double dz = target.z - position.z;
+        double distance = std::sqrt(dx * dx + dz * dz);
+
+        if (distance >= 0.001) {
+            double scale = std::min(Speed * TickTime, distance) / distance;
+            mc::world::MoveResult result = collider.Move(bounds + position, mc::Vector3d(dx * scale, 0, dz * scale), onGround, stepHeight);
+
+            position += result.motion;
+        }
+
+        const std::vector<mc::AABB>& stuck = collider.GetCollisionBoxes(Shrink(bounds + position));
+
+        if (!stuck.empty()) {
+            for (const mc::AABB& other : stuck)
+                position.y = std::max(position.y, other.max.y);
+
+            onGround = true;
+            return;
+        }
+
+        mc::world::MoveResult result = collider.Move(bounds + position, mc::Vector3d(0, -fall, 0));
+
+        position += result.motion;
+        onGround = result.collidedVertically;
+    }
+};
+
+struct BatchFixture {
+    mc::protocol::packets::PacketDispatcher dispatcher;
+    mc::world::World world;
+    mc::world::Collider collider;
+    mc::world::PhysicsBatch batch;
+    std::mt19937 random;
+
+    BatchFixture() : world(&dispatcher, GetRegistry()), collider(world), random(1234) {
+        CreateTerrain(world, random);
+    }
+
+    bool IsFree(const mc::Vector3d& position) {
+        return collider.GetCollisionBoxes(Shrink(batch.GetBounds() + position)).empty();
+    }
+
+    // A free spot on the floor in the x range
+    mc::Vector3d GetFreePosition(double minX, double maxX) {
+        std::uniform_real_distribution<double> x(minX, maxX);
+        std::uniform_real_distribution<double> z(1.5, 14.5);
+
+        while (true) {
+            mc::Vector3d position(x(random), 10.0, z(random));
+
+            if (IsFree(position))
+                return position;
+        }
+    }
+};
+
+} // ns
+
+TEST_CASE("PhysicsBatch moves bodies like walking them one at a time", "[PhysicsBatch]") {
+    BatchFixture fixture;
+    std::vector<Walker> walkers;
+    std::vector<mc::world::PhysicsBatch::BodyId> bodies;
+    std::uniform_real_distribution<double> targetX(1.5, 30.5);
+    std::uniform_real_distribution<double> targetZ(1.5, 14.5);
+
+    // Spread out in the first column and bunched up in the second, so the bodies there share gathers.
+    for (int i = 0; i < 48; ++i) {
+        Walker walker;
+
+        walker.position = i < 16 ? fixture.GetFreePosition(1.5, 15.5) : fixture.GetFreePosition(20.0, 23.0);
+        walker.stepHeight = i % 2 == 0 ? StepHeight : JumpHeight;
+        walker.onGround = true;
+
+        walkers.push_back(walker);
+        bodies.push_back(fixture.batch.AddBody(fixture.world, walker.position));
+    }
+
+    const double fall = 8.3 * TickTime;
+
+    fixture.batch.SetFallSpeed(8.3);
+
+    for (int tick = 0; tick < 400; ++tick) {
+        // New targets every so often, some of them behind a wall.
+        if (tick % 50 == 0) {
+            for (std::size_t i = 0; i < walkers.size(); ++i) {
+                walkers[i].target = mc::Vector3d(targetX(fixture.random), 0, targetZ(fixture.random));
+                fixture.batch.SetTarget(bodies[i], walkers[i].target, Speed, walkers[i].stepHeight);
+            }
+        }
+
+        fixture.batch.Step(TickTime);
+
+        for (std::size_t i = 0; i < walkers.size(); ++i) {
+            walkers[i].Step(fixture.collider, fixture.batch.GetBounds(), fall);
+
+            mc::Vector3d position = fixture.batch.GetPosition(bodies[i]);
+
+            INFO("tick " << tick << " body " << i);
+            REQUIRE(position.x == Approx(walkers[i].position.x));
+            REQUIRE(position.y == Approx(walkers[i].position.y));
+            REQUIRE(position.z == Approx(walkers[i].position.z));
+            REQUIRE(fixture.batch.IsOnGround(bodies[i]) == walkers[i].onGround);
+
+            // Nobody ends up inside of a block or on top of a wall.
+            REQUIRE(fixture.IsFree(position));
+            REQUIRE(position.y < 12.5);
+        }
+    }
+}
+
+TEST_CASE("PhysicsBatch bodies are stopped by walls", "[PhysicsBatch]") {
+    BatchFixture fixture;
+
+    // Clear the way to the wall at x 8 of any ledges.
+    for (s64 x = 5; x < 8; ++x)
+        Fill(fixture.world, x, 6, 0);
+
+    mc::world::PhysicsBatch::BodyId body = fixture.batch.AddBody(fixture.world, mc::Vector3d(5.5, 10.0, 6.5));
+
+    SECTION("higher than a jump") {
+        fixture.batch.SetTarget(body, mc::Vector3d(12.5, 10.0, 6.5), Speed, JumpHeight);
+
+        for (int tick = 0; tick < 40; ++tick)
+            fixture.batch.Step(TickTime);
+
+        REQUIRE(fixture.batch.GetPosition(body).x == Approx(7.7));
+        REQUIRE(fixture.batch.GetPosition(body).y == Approx(10.0));
+        REQUIRE(fixture.batch.IsOnGround(body));
+    }
+
+    SECTION("one block high only with a jump") {
+        Fill(fixture.world, 7, 6, 1);
+        Fill(fixture.world, 6, 6, 0);
+
+        fixture.batch.SetTarget(body, mc::Vector3d(6.5, 10.0, 6.5), Speed, StepHeight);
+        for (int tick = 0; tick < 20; ++tick)
+            fixture.batch.Step(TickTime);
+
+        fixture.batch.SetTarget(body, mc::Vector3d(7.5, 10.0, 6.5), Speed, StepHeight);
+        for (int tick = 0; tick < 20; ++tick)
+            fixture.batch.Step(TickTime);
+
+        REQUIRE(fixture.batch.GetPosition(body).x == Approx(6.7));
+        REQUIRE(fixture.batch.GetPosition(body).y == Approx(10.0));
+
+        fixture.batch.SetTarget(body, mc::Vector3d(7.5, 10.0, 6.5), Speed, JumpHeight);
+        for (int tick = 0; tick < 20; ++tick)
+            fixture.batch.Step(TickTime);
+
+        REQUIRE(fixture.batch.GetPosition(body).x == Approx(7.5));
+        REQUIRE(fixture.batch.GetPosition(body).y == Approx(11.0));
+    }
+}
@@ -0,0 +1,211 @@
+#include "catch.hpp"
+
+#include <mclib/common/DataBuffer.h>
+#include <mclib/common/MCString.h>
+#include <mclib/common/VarInt.h>
+#include <mclib/core/PlayerManager.h>
+#include <mclib/protocol/packets/Packet.h>
+#include <mclib/protocol/packets/PacketDispatcher.h>
+
+#include <iterator>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+using mc::entity::PlayerEntity;
+using mc::protocol::packets::in::PlayerListItemPacket;
+
+namespace {
+
+const mc::protocol::Version Version = mc::protocol::Version::Minecraft_1_12_2;
+
+const mc::UUID FirstUUID = mc::UUID::FromString("069a79f4-44e9-4726-a5be-fca90e38aaf5");
+const mc::UUID SecondUUID = mc::UUID::FromString("853c80ef-3c37-49fd-aa49-938b674adae6");
+
+typedef std::vector<std::pair<mc::UUID, std::wstring>> PlayerList;
+
+void AddPlayers(mc::core::PlayerManager& manager, const PlayerList& players) {
+    mc::DataBuffer buffer;
+
+    buffer << mc::VarInt((s32)PlayerListItemPacket::Action::AddPlayer) << mc::VarInt((s32)players.size());
+
+    // No properties, survival, no ping and no display name
+    for (const auto& player : players)
+        buffer << player.first << mc::MCString(player.second) << mc::VarInt(0) << mc::VarInt(0) << mc::VarInt(0) << (u8)0;
+
+    PlayerListItemPacket packet;
+    packet.Deserialize(buffer, buffer.GetSize());
+    manager.HandlePacket(&packet);
+}
+
+void RemovePlayers(mc::core::PlayerManager& manager, const std::vector<mc::UUID>& uuids) {
+    mc::DataBuffer buffer;
+
+    buffer << mc::VarInt((s32)PlayerListItemPacket::Action::RemovePlayer) << mc::VarInt((s32)uuids.size());
+
+    for (const mc::UUID& uuid : uuids)
+        buffer << uuid;
+
+    PlayerListItemPacket packet;
+    packet.Deserialize(buffer, buffer.GetSize());
+    manager.HandlePacket(&packet);
+}
+
+struct PlayerFixture {
+    mc::protocol::packets::PacketDispatcher dispatcher;
+    mc::entity::EntityManager entityManager;
+    mc::core::PlayerManager playerManager;
+
+    PlayerFixture() : entityManager(&dispatcher, Version), playerManager(&dispatcher, &entityManager) { }
+};
+
+} // ns
+
+TEST_CASE("PlayerManager finds players by their entity id", "[PlayerManager]") {
+    mc::protocol::packets::PacketDispatcher dispatcher;
+    mc::entity::EntityManager entityManager(&dispatcher, Version);
+    mc::core::PlayerManager playerManager(&dispatcher, &entityManager);
+
+    const mc::UUID uuid = mc::UUID::FromString("069a79f4-44e9-4726-a5be-fca90e38aaf5");
+    auto entity = std::make_shared<PlayerEntity>(12, Version);
+
+    playerManager.OnPlayerSpawn(entity, uuid);
+
+    mc::core::PlayerPtr player = playerManager.GetPlayerByEntityId(12);
+
+    REQUIRE(player);
+    REQUIRE(player == playerManager.GetPlayerByUUID(uuid));
+    REQUIRE(player->GetEntity() == entity);
+    REQUIRE_FALSE(playerManager.GetPlayerByEntityId(13));
+
+    SECTION("destroyed entities are dropped") {
+        playerManager.OnEntityDestroy(entity);
+
+        REQUIRE_FALSE(playerManager.GetPlayerByEntityId(12));
+        REQUIRE_FALSE(player->GetEntity());
+    }
+
+    SECTION("freed entities are dropped") {
+        entity.reset();
+
+        REQUIRE_FALSE(playerManager.GetPlayerByEntityId(12));
+        REQUIRE_FALSE(player->GetEntity());
+        REQUIRE(playerManager.GetPlayerByUUID(uuid) == player);
+    }
+
+    SECTION("a new entity with the same id belongs to the new player") {
+        const mc::UUID otherUUID = mc::UUID::FromString("853c80ef-3c37-49fd-aa49-938b674adae6");
+        auto other = std::make_shared<PlayerEntity>(12, Version);
+
+        entity.reset();
+        playerManager.OnPlayerSpawn(other, otherUUID);
+
+        REQUIRE(playerManager.GetPlayerByEntityId(12) == playerManager.GetPlayerByUUID(otherUUID));
+        REQUIRE_FALSE(player->GetEntity());
+    }
+
+    SECTION("respawning moves the index to the new id") {
+        auto respawned = std::make_shared<PlayerEntity>(20, Version);
+
+        playerManager.OnPlayerSpawn(respawned, uuid);
+
+        REQUIRE_FALSE(playerManager.GetPlayerByEntityId(12));
+        REQUIRE(playerManager.GetPlayerByEntityId(20) == player);
+    }
+}
+
+TEST_CASE("PlayerManager finds players by name in any case", "[PlayerManager]") {
+    PlayerFixture fixture;
+    mc::core::PlayerManager& manager = fixture.playerManager;
+
+    AddPlayers(manager, { { FirstUUID, L"Notch" }, { SecondUUID, L"jeb_" } });
+
+    mc::core::PlayerPtr notch = manager.GetPlayerByUUID(FirstUUID);
+
+    REQUIRE(notch);
+    REQUIRE(notch->GetName() == L"Notch");
+    REQUIRE(manager.GetPlayerByName(L"Notch") == notch);
+    REQUIRE(manager.GetPlayerByName(L"notch") == notch);
+    REQUIRE(manager.GetPlayerByName(L"NOTCH") == notch);
+    REQUIRE(manager.GetPlayerByName(L"nOtCh") == notch);
+    REQUIRE(manager.GetPlayerByName(L"JEB_") == manager.GetPlayerByUUID(SecondUUID));
+
+    REQUIRE_FALSE(manager.GetPlayerByName(L"Notc"));
+    REQUIRE_FALSE(manager.GetPlayerByName(L""));
+}
+
+TEST_CASE("PlayerManager keeps the name and entity id indexes in sync with the player list", "[PlayerManager]") {
+    PlayerFixture fixture;
+    mc::core::PlayerManager& manager = fixture.playerManager;
+    auto entity = std::make_shared<PlayerEntity>(12, Version);
+
+    AddPlayers(manager, { { FirstUUID, L"Alice" } });
+    manager.OnPlayerSpawn(entity, FirstUUID);
+
+    mc::core::PlayerPtr alice = manager.GetPlayerByUUID(FirstUUID);
+
+    REQUIRE(alice);
+    REQUIRE(manager.GetPlayerByName(L"alice") == alice);
+    REQUIRE(manager.GetPlayerByEntityId(12) == alice);
+
+    SECTION("removed players aren't found by name or entity id") {
+        RemovePlayers(manager, { FirstUUID });
+
+        REQUIRE_FALSE(manager.GetPlayerByUUID(FirstUUID));
+        REQUIRE_FALSE(manager.GetPlayerByName(L"Alice"));
+        // The entity is still around, but it doesn't belong to a listed player anymore.
+        REQUIRE_FALSE(manager.GetPlayerByEntityId(12));
+        REQUIRE_FALSE(alice->GetEntity());
+        REQUIRE(manager.begin() == manager.end());
+
+        // Removing a player that isn't listed does nothing.
+        RemovePlayers(manager, { FirstUUID, SecondUUID });
+        REQUIRE(manager.begin() == manager.end());
+    }
+
+    SECTION("a removed name can be taken by another player") {
+        RemovePlayers(manager, { FirstUUID });
+        AddPlayers(manager, { { SecondUUID, L"ALICE" } });
+
+        mc::core::PlayerPtr other = manager.GetPlayerByUUID(SecondUUID);
+
+        REQUIRE(manager.GetPlayerByName(L"alice") == other);
+        REQUIRE(other != alice);
+        REQUIRE_FALSE(manager.GetPlayerByEntityId(12));
+    }
+
+    SECTION("adding a listed player again keeps the first entry") {
+        AddPlayers(manager, { { FirstUUID, L"Mallory" } });
+
+        REQUIRE(manager.GetPlayerByUUID(FirstUUID) == alice);
+        REQUIRE(manager.GetPlayerByName(L"alice") == alice);
+        REQUIRE_FALSE(manager.GetPlayerByName(L"mallory"));
+        REQUIRE(manager.GetPlayerByEntityId(12) == alice);
+    }
+
+    SECTION("players that spawn before they're listed get their name later") {
+        auto bobEntity = std::make_shared<PlayerEntity>(13, Version);
+
+        manager.OnPlayerSpawn(bobEntity, SecondUUID);
+
+        mc::core::PlayerPtr bob = manager.GetPlayerByEntityId(13);
+
+        REQUIRE(bob);
+        REQUIRE(bob->GetName().empty());
+
+        AddPlayers(manager, { { SecondUUID, L"Bob" } });
+
+        REQUIRE(manager.GetPlayerByUUID(SecondUUID) == bob);
+        REQUIRE(manager.GetPlayerByName(L"BOB") == bob);
+        REQUIRE(manager.GetPlayerByEntityId(13) == bob);
+
+        // Both go in one packet.
+        RemovePlayers(manager, { FirstUUID, SecondUUID });
+
+        REQUIRE_FALSE(manager.GetPlayerByName(L"bob"));
+        REQUIRE_FALSE(manager.GetPlayerByName(L"alice"));
+        REQUIRE_FALSE(manager.GetPlayerByEntityId(12));
+        REQUIRE_FALSE(manager.GetPlayerByEntityId(13));
+    }
+}
@@ -0,0 +1,93 @@
+#include "catch.hpp"
+
+#include <mclib/util/SPSCQueue.h>
+
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+using mc::util::SPSCQueue;
+
+TEST_CASE("SPSCQueue rounds its capacity up and refuses to overfill", "[SPSCQueue]") {
+    REQUIRE_THROWS_AS(SPSCQueue<int>(0), std::invalid_argument);
+    REQUIRE(SPSCQueue<int>(1).GetCapacity() == 1);
+    REQUIRE(SPSCQueue<int>(8).GetCapacity() == 8);
+
+    SPSCQueue<int> queue(5);
+
+    REQUIRE(queue.GetCapacity() == 8);
+    REQUIRE(queue.IsEmpty());
+
+    for (int i = 0; i < 8; ++i)
+        REQUIRE(queue.TryPush(int(i)));
+
+    REQUIRE(queue.GetSize() == 8);
+    REQUIRE_FALSE(queue.TryPush(8));
+
+    int value = -1;
+    REQUIRE(queue.TryPop(value));
+    REQUIRE(value == 0);
+
+    // The freed slot is reused by the next push, which wraps around.
+    REQUIRE(queue.TryPush(8));
+    REQUIRE_FALSE(queue.TryPush(9));
+
+    for (int i = 1; i <= 8; ++i) {
+        REQUIRE(queue.TryPop(value));
+        REQUIRE(value == i);
+    }
+
+    REQUIRE(queue.IsEmpty());
+    REQUIRE_FALSE(queue.TryPop(value));
+}
+
+TEST_CASE("SPSCQueue moves values in and out", "[SPSCQueue]") {
+    SPSCQueue<std::unique_ptr<int>> queue(2);
+    std::unique_ptr<int> value(new int(5));
+
+    REQUIRE(queue.TryPush(std::move(value)));
+    REQUIRE_FALSE(value);
+
+    // A failed push leaves the value with the caller.
+    std::unique_ptr<int> kept(new int(6));
+    REQUIRE(queue.TryPush(std::unique_ptr<int>(new int(7))));
+    REQUIRE_FALSE(queue.TryPush(std::move(kept)));
+    REQUIRE(kept);
+
+    REQUIRE(queue.TryPop(value));
+    REQUIRE(*value == 5);
+}
+
+TEST_CASE("SPSCQueue keeps the order between two threads", "[SPSCQueue]") {
+    const u64 count = 200000;
+    // Small, so both sides keep running into a full or empty queue.
+    SPSCQueue<u64> queue(16);
+
+    std::thread producer([&queue, count]() {
+        for (u64 i = 0; i < count; ++i) {
+            while (!queue.TryPush(u64(i)))
+                std::this_thread::yield();
+        }
+    });
+
+    u64 expected = 0;
+    bool ordered = true;
+
+    while (expected < count) {
+        u64 value;
+
+        if (!queue.TryPop(value)) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        if (value != expected)
+            ordered = false;
+        ++expected;
+    }
+
+    producer.join();
+
+    REQUIRE(ordered);
+    REQUIRE(queue.IsEmpty());
+}
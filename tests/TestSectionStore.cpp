@@ -0,0 +1,210 @@
+#include "catch.hpp"
+
+#include <mclib/block/Block.h>
+#include <mclib/common/DataBuffer.h>
+#include <mclib/common/Position.h>
+#include <mclib/common/VarInt.h>
+#include <mclib/protocol/packets/Packet.h>
+#include <mclib/protocol/packets/PacketDispatcher.h>
+#include <mclib/world/SectionStore.h>
+#include <mclib/world/World.h>
+#include <mclib/world/WorldSnapshot.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using mc::world::SectionStore;
+using mc::world::SectionStoreStats;
+
+namespace {
+
+const u32 Stone = 1 << 4;
+const u32 Dirt = 3 << 4;
+const u32 Glass = 20 << 4;
+
+const mc::block::BlockRegistry* GetRegistry() {
+    return mc::block::BlockRegistry::GetInstance(mc::protocol::Version::Minecraft_1_12_2);
+}
+
+// A column with one section at the bottom that's filled with blockData.
+void LoadColumn(mc::world::World& world, s32 x, s32 z, u32 blockData) {
+    mc::DataBuffer data;
+
+    // 4 bits per block, every block is palette entry 1.
+    data << (u8)4 << mc::VarInt(2) << mc::VarInt(0) << mc::VarInt((s32)blockData);
+    data << mc::VarInt(256);
+    for (int i = 0; i < 256; ++i)
+        data << (u64)0x1111111111111111ULL;
+
+    // Block light, sky light and biomes
+    data << std::string(2048 * 2 + 256, '\0');
+    data << mc::VarInt(0);
+
+    mc::DataBuffer buffer;
+    buffer << x << z << true << mc::VarInt(1) << mc::VarInt((s32)data.GetSize()) << data;
+
+    mc::protocol::packets::in::ChunkDataPacket packet;
+    packet.Deserialize(buffer, buffer.GetSize());
+    world.HandlePacket(&packet);
+}
+
+void SetBlock(mc::world::World& world, const mc::Vector3i& position, u32 blockData) {
+    mc::DataBuffer buffer;
+
+    buffer << mc::Position(position.x, position.y, position.z) << mc::VarInt((s32)blockData);
+
+    mc::protocol::packets::in::BlockChangePacket packet;
+    packet.Deserialize(buffer, buffer.GetSize());
+    world.HandlePacket(&packet);
+}
+
+// The bottom section of the column, read without moving the column out of cold storage.
+const mc::world::Chunk* GetSection(const mc::world::World& world, s32 x, s32 z) {
+    mc::world::ConstChunkColumnPtr column = world.GetChunk(mc::Vector3i(x * 16, 0, z * 16));
+
+    REQUIRE(column);
+    return (*column)[0].get();
+}
+
+// SectionStore's hash of the first count words of a section made by CreateSection, so two can be built to collide.
+u64 Hash(const std::vector<u64>& data, std::size_t count) {
+    u64 hash = 14695981039346656037ULL;
+
+    auto mix = [&hash](u64 value) {
+        hash ^= value;
+        hash *= 1099511628211ULL;
+        hash ^= hash >> 32;
+    };
+
+    mix(4);
+    mix(0);
+    mix(Stone);
+
+    for (std::size_t i = 0; i < count; ++i)
+        mix(data[i]);
+
+    return hash;
+}
+
+mc::world::ChunkPtr CreateSection(const std::vector<u64>& data) {
+    mc::DataBuffer buffer;
+
+    buffer << (u8)4 << mc::VarInt(2) << (u32)0 << Stone << mc::VarInt((s32)data.size());
+    for (u64 value : data)
+        buffer << value;
+
+    auto section = std::make_shared<mc::world::Chunk>();
+    section->Deserialize(buffer);
+    return section;
+}
+
+struct SharingFixture {
+    mc::protocol::packets::PacketDispatcher dispatcher;
+    mc::world::World first;
+    mc::world::World second;
+
+    SharingFixture() : first(&dispatcher, GetRegistry()), second(&dispatcher, GetRegistry()) {
+        first.SetSectionSharing(true);
+        second.SetSectionSharing(true);
+    }
+};
+
+} // ns
+
+TEST_CASE("Worlds share identical sections", "[SectionStore]") {
+    SharingFixture fixture;
+    SectionStoreStats before = SectionStore::GetInstance().GetStats();
+
+    LoadColumn(fixture.first, 0, 0, Stone);
+    LoadColumn(fixture.second, 0, 0, Stone);
+
+    const mc::world::Chunk* section = GetSection(fixture.first, 0, 0);
+    std::size_t usage = section->GetMemoryUsage();
+
+    REQUIRE(section->IsShared());
+    REQUIRE(GetSection(fixture.second, 0, 0) == section);
+
+    SectionStoreStats shared = SectionStore::GetInstance().GetStats();
+
+    REQUIRE(shared.lookups == before.lookups + 2);
+    REQUIRE(shared.hits == before.hits + 1);
+    REQUIRE(shared.sections == before.sections + 1);
+    REQUIRE(shared.bytes == before.bytes + usage);
+    REQUIRE(shared.referencedBytes == before.referencedBytes + usage * 2);
+
+    SECTION("different sections aren't merged") {
+        LoadColumn(fixture.second, 1, 0, Glass);
+
+        REQUIRE(GetSection(fixture.second, 1, 0) != section);
+        REQUIRE(fixture.second.GetBlock(mc::Vector3i(16, 0, 0))->GetType() == Glass);
+        REQUIRE(SectionStore::GetInstance().GetStats().sections == before.sections + 2);
+    }
+
+    SECTION("writing copies the section first") {
+        SetBlock(fixture.first, mc::Vector3i(1, 2, 3), Dirt);
+
+        const mc::world::Chunk* written = GetSection(fixture.first, 0, 0);
+
+        REQUIRE(written != section);
+        REQUIRE_FALSE(written->IsShared());
+        REQUIRE(GetSection(fixture.second, 0, 0) == section);
+
+        REQUIRE(fixture.first.GetBlock(mc::Vector3i(1, 2, 3))->GetType() == Dirt);
+        REQUIRE(fixture.first.GetBlock(mc::Vector3i(1, 2, 4))->GetType() == Stone);
+        REQUIRE(fixture.second.GetBlock(mc::Vector3i(1, 2, 3))->GetType() == Stone);
+
+        // Only the other world still uses the stored section.
+        SectionStoreStats stats = SectionStore::GetInstance().GetStats();
+
+        REQUIRE(stats.sections == before.sections + 1);
+        REQUIRE(stats.referencedBytes == before.referencedBytes + usage);
+    }
+
+    SECTION("columns moved out of cold storage are shared again") {
+        fixture.first.EnableColdStorage(0, 0);
+        fixture.first.UpdateColdStorage(mc::Vector3d(100 * 16, 0, 0));
+
+        REQUIRE(fixture.first.GetColdStorageStats().columns == 1);
+
+        // The non-const GetChunk moves it back to the hot set.
+        REQUIRE(fixture.first.GetChunk(mc::Vector3i(0, 0, 0)));
+        REQUIRE(fixture.first.GetColdStorageStats().columns == 0);
+        REQUIRE(GetSection(fixture.first, 0, 0) == section);
+        REQUIRE(SectionStore::GetInstance().GetStats().referencedBytes == before.referencedBytes + usage * 2);
+    }
+}
+
+TEST_CASE("SectionStore compares sections with the same hash", "[SectionStore]") {
+    std::vector<u64> data(256, 0x1111111111111111ULL);
+    std::vector<u64> other = data;
+
+    const std::size_t last = data.size() - 1;
+
+    // Mixing a word in can be undone, so the last word can make up for the different first one.
+    other[0] = 0x2222222222222222ULL;
+    other[last] = Hash(data, last) ^ Hash(other, last) ^ data[last];
+
+    REQUIRE(other != data);
+    REQUIRE(Hash(other, other.size()) == Hash(data, data.size()));
+
+    mc::world::ChunkPtr first = CreateSection(data);
+    mc::world::ChunkPtr second = CreateSection(other);
+
+    SectionStoreStats before = SectionStore::GetInstance().GetStats();
+
+    REQUIRE(SectionStore::GetInstance().Intern(first) == first);
+    REQUIRE(SectionStore::GetInstance().Intern(second) == second);
+    REQUIRE(first->IsShared());
+    REQUIRE(second->IsShared());
+
+    // Both are found through the same bucket.
+    REQUIRE(SectionStore::GetInstance().Intern(CreateSection(other)) == second);
+    REQUIRE(SectionStore::GetInstance().Intern(CreateSection(data)) == first);
+
+    SectionStoreStats after = SectionStore::GetInstance().GetStats();
+
+    REQUIRE(after.lookups == before.lookups + 4);
+    REQUIRE(after.hits == before.hits + 2);
+    REQUIRE(after.sections == before.sections + 2);
+}
@@ -0,0 +1,199 @@
+#include "catch.hpp"
+
+#include <mclib/block/Block.h>
+#include <mclib/common/DataBuffer.h>
+#include <mclib/common/VarInt.h>
+#include <mclib/entity/EntityManager.h>
+#include <mclib/protocol/packets/Packet.h>
+#include <mclib/protocol/packets/PacketDispatcher.h>
+#include <mclib/world/World.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace {
+
+const s32 Iterations = 2000;
+const s32 ReaderCount = 4;
+
+void CreateColumn(mc::world::World& world, s32 x, s32 z) {
+    mc::DataBuffer buffer;
+
+    buffer << x << z << false << mc::VarInt(0) << mc::VarInt(0) << mc::VarInt(0);
+
+    mc::protocol::packets::in::ChunkDataPacket packet;
+    packet.Deserialize(buffer, buffer.GetSize());
+    world.HandlePacket(&packet);
+}
+
+// Sets the whole first row of the column's bottom section to one block.
+void FillRow(mc::world::World& world, s32 chunkX, s32 chunkZ, u32 blockData) {
+    mc::DataBuffer buffer;
+
+    buffer << chunkX << chunkZ << mc::VarInt(16);
+
+    for (u8 x = 0; x < 16; ++x)
+        buffer << (u8)(x << 4) << (u8)0 << mc::VarInt((s32)blockData);
+
+    mc::protocol::packets::in::MultiBlockChangePacket packet;
+    packet.Deserialize(buffer, buffer.GetSize());
+    world.HandlePacket(&packet);
+}
+
+} // ns
+
+TEST_CASE("World snapshots are consistent while the world is written", "[Snapshot]") {
+    const u32 Stone = 1 << 4;
+    const u32 Dirt = 3 << 4;
+
+    mc::block::BlockRegistry::GetInstance()->RegisterVanillaBlocks(mc::protocol::Version::Minecraft_1_11_2);
+
+    mc::protocol::packets::PacketDispatcher dispatcher;
+    mc::world::World world(&dispatcher);
+
+    CreateColumn(world, 0, 0);
+    FillRow(world, 0, 0, Stone);
+
+    // Nothing is built until a snapshot is requested.
+    REQUIRE(world.GetSnapshot()->GetColumnCount() == 0);
+
+    world.PublishSnapshot();
+    REQUIRE(world.GetSnapshot()->GetColumnCount() == 1);
+    REQUIRE(world.GetSnapshot()->GetBlock(mc::Vector3i(0, 0, 0))->GetType() == Stone);
+
+    std::atomic<bool> running(true);
+    std::atomic<s32> failures(0);
+    std::atomic<u64> reads(0);
+    std::vector<std::thread> readers;
+
+    for (s32 i = 0; i < ReaderCount; ++i) {
+        readers.emplace_back([&]() {
+            u64 lastVersion = 0;
+
+            while (running) {
+                mc::world::WorldSnapshotPtr snapshot = world.GetSnapshot();
+
+                if (snapshot->GetVersion() < lastVersion)
+                    ++failures;
+                lastVersion = snapshot->GetVersion();
+
+                mc::block::BlockPtr first = snapshot->GetBlock(mc::Vector3i(0, 0, 0));
+
+                // Every row in a snapshot was written by a single change, so it has to be uniform.
+                for (s32 x = 1; x < 16; ++x) {
+                    if (snapshot->GetBlock(mc::Vector3i(x, 0, 0)) != first)
+                        ++failures;
+                }
+
+                // New columns are filled before the publish that adds them.
+                for (const auto& entry : *snapshot) {
+                    if (entry.first.first == 0) continue;
+
+                    mc::block::BlockPtr block = entry.second->GetBlock(mc::Vector3i(0, 0, 0));
+                    if (block == nullptr || block->GetType() != Stone)
+                        ++failures;
+                }
+
+                ++reads;
+            }
+        });
+    }
+
+    for (s32 i = 0; i < Iterations; ++i) {
+        FillRow(world, 0, 0, (i & 1) ? Stone : Dirt);
+
+        if (i % 100 == 0) {
+            s32 chunkX = i / 100 + 1;
+
+            CreateColumn(world, chunkX, 0);
+            FillRow(world, chunkX, 0, Stone);
+        }
+
+        world.PublishSnapshot();
+    }
+
+    running = false;
+    for (auto& reader : readers)
+        reader.join();
+
+    REQUIRE(failures == 0);
+    REQUIRE(reads > 0);
+
+    mc::world::WorldSnapshotPtr snapshot = world.GetSnapshot();
+    REQUIRE(snapshot->GetColumnCount() == Iterations / 100 + 1);
+    REQUIRE(snapshot->GetBlock(mc::Vector3i(0, 0, 0))->GetType() == Stone);
+}
+
+TEST_CASE("Entity snapshots are consistent while entities move", "[Snapshot]") {
+    const mc::EntityId PlayerId = 7;
+
+    mc::protocol::packets::PacketDispatcher dispatcher;
+    mc::entity::EntityManager entities(&dispatcher, mc::protocol::Version::Minecraft_1_11_2);
+
+    {
+        mc::DataBuffer buffer;
+        buffer << PlayerId << (u8)0 << (s32)0 << (u8)0 << (u8)20 << mc::MCString(L"default") << false;
+
+        mc::protocol::packets::in::JoinGamePacket packet;
+        packet.Deserialize(buffer, buffer.GetSize());
+        entities.HandlePacket(&packet);
+    }
+
+    REQUIRE(entities.GetSnapshot()->GetSize() == 0);
+    entities.PublishSnapshot();
+
+    mc::entity::EntitySnapshotPtr first = entities.GetSnapshot();
+    REQUIRE(first->GetSize() == 1);
+    REQUIRE(first->GetPlayerEntity() != nullptr);
+    REQUIRE(first->GetEntity(PlayerId + 1) == nullptr);
+
+    std::atomic<bool> running(true);
+    std::atomic<s32> failures(0);
+    std::vector<std::thread> readers;
+
+    for (s32 i = 0; i < ReaderCount; ++i) {
+        readers.emplace_back([&]() {
+            u64 lastVersion = 0;
+
+            while (running) {
+                mc::entity::EntitySnapshotPtr snapshot = entities.GetSnapshot();
+
+                if (snapshot->GetVersion() < lastVersion)
+                    ++failures;
+                lastVersion = snapshot->GetVersion();
+
+                const mc::entity::EntityState* player = snapshot->GetPlayerEntity();
+                if (!player) {
+                    ++failures;
+                    continue;
+                }
+
+                // Each teleport moves to (i, 2i, 3i), so a torn read breaks the ratios.
+                if (player->position.y != player->position.x * 2 || player->position.z != player->position.x * 3)
+                    ++failures;
+            }
+        });
+    }
+
+    for (s32 i = 0; i < Iterations; ++i) {
+        mc::DataBuffer buffer;
+        buffer << mc::VarInt(PlayerId) << (double)i << (double)(i * 2) << (double)(i * 3) << (u8)0 << (u8)0 << true;
+
+        mc::protocol::packets::in::EntityTeleportPacket packet;
+        packet.Deserialize(buffer, buffer.GetSize());
+        entities.HandlePacket(&packet);
+
+        entities.PublishSnapshot();
+    }
+
+    running = false;
+    for (auto& reader : readers)
+        reader.join();
+
+    REQUIRE(failures == 0);
+
+    mc::entity::EntitySnapshotPtr last = entities.GetSnapshot();
+    REQUIRE(last->GetVersion() == first->GetVersion() + Iterations);
+    REQUIRE(last->GetPlayerEntity()->position.x == Iterations - 1);
+}
@@ -0,0 +1,220 @@
+#include "catch.hpp"
+
+#include <mclib/block/Block.h>
+#include <mclib/common/DataBuffer.h>
+#include <mclib/common/MCString.h>
+#include <mclib/common/Position.h>
+#include <mclib/common/VarInt.h>
+#include <mclib/protocol/packets/Packet.h>
+#include <mclib/protocol/packets/PacketDispatcher.h>
+#include <mclib/util/ThreadPool.h>
+#include <mclib/world/World.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+const u32 Stone = 1 << 4;
+
+const mc::block::BlockRegistry* GetRegistry() {
+    return mc::block::BlockRegistry::GetInstance(mc::protocol::Version::Minecraft_1_12_2);
+}
+
+void CreateColumn(mc::world::World& world, s32 x, s32 z) {
+    mc::DataBuffer buffer;
+
+    buffer << x << z << false << mc::VarInt(0) << mc::VarInt(0) << mc::VarInt(0);
+
+    mc::protocol::packets::in::ChunkDataPacket packet;
+    packet.Deserialize(buffer, buffer.GetSize());
+    world.HandlePacket(&packet);
+}
+
+void SetBlocks(mc::world::World& world, s32 chunkX, s32 chunkZ, const std::vector<mc::Vector3i>& positions, u32 blockData) {
+    mc::DataBuffer buffer;
+
+    buffer << chunkX << chunkZ << mc::VarInt((s32)positions.size());
+
+    for (const mc::Vector3i& position : positions)
+        buffer << (u8)(((position.x & 15) << 4) | (position.z & 15)) << (u8)position.y << mc::VarInt((s32)blockData);
+
+    mc::protocol::packets::in::MultiBlockChangePacket packet;
+    packet.Deserialize(buffer, buffer.GetSize());
+    world.HandlePacket(&packet);
+}
+
+void SetBlock(mc::world::World& world, const mc::Vector3i& position, u32 blockData) {
+    mc::DataBuffer buffer;
+
+    buffer << mc::Position(position.x, position.y, position.z) << mc::VarInt((s32)blockData);
+
+    mc::protocol::packets::in::BlockChangePacket packet;
+    packet.Deserialize(buffer, buffer.GetSize());
+    world.HandlePacket(&packet);
+}
+
+void Respawn(mc::world::World& world) {
+    mc::DataBuffer buffer;
+
+    buffer << (s32)-1 << (u8)1 << (u8)0 << mc::MCString(L"default");
+
+    mc::protocol::packets::in::RespawnPacket packet;
+    packet.Deserialize(buffer, buffer.GetSize());
+    world.HandlePacket(&packet);
+}
+
+// A pool of two workers that are both kept busy until Release, so decodes only run when the test says so.
+struct BlockedPool {
+    std::shared_ptr<mc::util::ThreadPool> pool;
+    std::atomic<bool> released;
+    std::atomic<int> blocked;
+
+    BlockedPool() : pool(std::make_shared<mc::util::ThreadPool>(2)), released(false), blocked(0) {
+        for (int i = 0; i < 2; ++i) {
+            pool->Submit([this]() {
+                ++blocked;
+                while (!released)
+                    std::this_thread::yield();
+            });
+        }
+
+        while (blocked < 2)
+            std::this_thread::yield();
+    }
+
+    ~BlockedPool() { Release(); }
+
+    void Release() { released = true; }
+};
+
+// Records loads and block changes in the order the world reports them.
+class Recorder : public mc::world::WorldListener {
+public:
+    std::vector<std::string> events;
+
+    void OnChunkLoad(mc::world::ChunkPtr chunk, const mc::world::ChunkColumnMetadata& meta, u16 yIndex) override {
+        if (yIndex == 0)
+            events.push_back("load " + std::to_string(meta.x) + "," + std::to_string(meta.z));
+    }
+
+    void OnBlockChange(mc::Vector3i position, mc::block::BlockPtr newBlock, mc::block::BlockPtr oldBlock) override {
+        events.push_back("change " + std::to_string(position.x) + "," + std::to_string(position.y) + "," + std::to_string(position.z));
+    }
+};
+
+} // ns
+
+TEST_CASE("World applies columns in the order they arrived", "[WorldDecode]") {
+    BlockedPool blocked;
+    mc::protocol::packets::PacketDispatcher dispatcher;
+    mc::world::World world(&dispatcher, GetRegistry());
+    Recorder recorder;
+
+    world.RegisterListener(&recorder);
+    world.SetDecodePool(blocked.pool);
+
+    CreateColumn(world, 0, 0);
+    CreateColumn(world, 1, 0);
+    REQUIRE(world.GetPendingColumnCount() == 2);
+
+    // Submit goes round robin over the two queues, and RunPendingTask starts at the queue the next task goes to.
+    // After this filler that's the queue with the second column, so it's decoded first.
+    blocked.pool->Submit([]() { });
+    REQUIRE(blocked.pool->RunPendingTask());
+
+    world.ApplyDecodedColumns();
+
+    // The second column waits for the first one.
+    REQUIRE(world.GetPendingColumnCount() == 2);
+    REQUIRE(world.GetChunk(mc::Vector3i(16, 0, 0)) == nullptr);
+    REQUIRE(recorder.events.empty());
+
+    blocked.Release();
+    world.FinishPendingColumns();
+
+    REQUIRE(world.GetPendingColumnCount() == 0);
+    REQUIRE(recorder.events == std::vector<std::string>{ "load 0,0", "load 1,0" });
+    REQUIRE(world.GetChunk(mc::Vector3i(16, 0, 0)) != nullptr);
+
+    world.UnregisterListener(&recorder);
+}
+
+TEST_CASE("World applies block changes after the pending column they belong to", "[WorldDecode]") {
+    BlockedPool blocked;
+    mc::protocol::packets::PacketDispatcher dispatcher;
+    mc::world::World world(&dispatcher, GetRegistry());
+    Recorder recorder;
+
+    world.RegisterListener(&recorder);
+    world.SetDecodePool(blocked.pool);
+
+    CreateColumn(world, 0, 0);
+    SetBlocks(world, 0, 0, { mc::Vector3i(1, 64, 1), mc::Vector3i(1, 65, 1) }, Stone);
+    SetBlock(world, mc::Vector3i(2, 64, 2), Stone);
+
+    // Nothing is applied before the column.
+    REQUIRE(world.GetChunk(mc::Vector3i(1, 64, 1)) == nullptr);
+    REQUIRE(recorder.events.empty());
+
+    CreateColumn(world, 1, 0);
+    SetBlock(world, mc::Vector3i(20, 64, 4), Stone);
+
+    blocked.Release();
+    world.FinishPendingColumns();
+
+    REQUIRE(recorder.events == std::vector<std::string>{
+        "load 0,0", "change 1,64,1", "change 1,65,1", "change 2,64,2",
+        "load 1,0", "change 20,64,4"
+    });
+
+    REQUIRE(world.GetBlock(mc::Vector3i(1, 64, 1))->GetType() == Stone);
+    REQUIRE(world.GetBlock(mc::Vector3i(1, 65, 1))->GetType() == Stone);
+    REQUIRE(world.GetBlock(mc::Vector3i(2, 64, 2))->GetType() == Stone);
+    REQUIRE(world.GetBlock(mc::Vector3i(20, 64, 4))->GetType() == Stone);
+
+    SECTION("changes to loaded columns aren't held") {
+        CreateColumn(world, 5, 5);
+        SetBlock(world, mc::Vector3i(3, 64, 3), Stone);
+
+        REQUIRE(world.GetBlock(mc::Vector3i(3, 64, 3))->GetType() == Stone);
+        world.FinishPendingColumns();
+    }
+
+    world.UnregisterListener(&recorder);
+}
+
+TEST_CASE("World drops pending columns on respawn", "[WorldDecode]") {
+    BlockedPool blocked;
+    mc::protocol::packets::PacketDispatcher dispatcher;
+    mc::world::World world(&dispatcher, GetRegistry());
+    Recorder recorder;
+
+    world.RegisterListener(&recorder);
+    world.SetDecodePool(blocked.pool);
+
+    CreateColumn(world, 0, 0);
+    SetBlock(world, mc::Vector3i(1, 64, 1), Stone);
+    REQUIRE(world.GetPendingColumnCount() == 1);
+
+    Respawn(world);
+    REQUIRE(world.GetPendingColumnCount() == 0);
+
+    blocked.Release();
+    world.FinishPendingColumns();
+
+    // Neither the old column nor the change held for it show up in the new world.
+    REQUIRE(world.GetChunk(mc::Vector3i(1, 64, 1)) == nullptr);
+    REQUIRE(recorder.events.empty());
+
+    // The new world's columns still go through the pool.
+    CreateColumn(world, 0, 0);
+    world.FinishPendingColumns();
+
+    REQUIRE(recorder.events == std::vector<std::string>{ "load 0,0" });
+
+    world.UnregisterListener(&recorder);
+}
@@ -0,0 +1,675 @@
+#include "catch.hpp"
+
+#include <mclib/block/Block.h>
+#include <mclib/common/DataBuffer.h>
+#include <mclib/common/Position.h>
+#include <mclib/common/VarInt.h>
+#include <mclib/protocol/packets/Packet.h>
+#include <mclib/protocol/packets/PacketDispatcher.h>
+#include <mclib/world/World.h>
+
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+#include <vector>
+
+namespace {
+
+const u32 Stone = 1 << 4;
+// Not vanilla types
+const u32 TallFence = 400 << 4;
+const u32 Flower = 401 << 4;
+
+void CreateColumn(mc::world::World& world, s32 x, s32 z) {
+    mc::DataBuffer buffer;
+
+    buffer << x << z << false << mc::VarInt(0) << mc::VarInt(0) << mc::VarInt(0);
+
+    mc::protocol::packets::in::ChunkDataPacket packet;
+    packet.Deserialize(buffer, buffer.GetSize());
+    world.HandlePacket(&packet);
+}
+
+void SetBlock(mc::world::World& world, const mc::Vector3i& position, u32 blockData) {
+    mc::DataBuffer buffer;
+    s32 chunkX = (s32)std::floor(position.x / 16.0);
+    s32 chunkZ = (s32)std::floor(position.z / 16.0);
+
+    buffer << chunkX << chunkZ << mc::VarInt(1);
+    buffer << (u8)(((position.x & 15) << 4) | (position.z & 15)) << (u8)position.y << mc::VarInt((s32)blockData);
+
+    mc::protocol::packets::in::MultiBlockChangePacket packet;
+    packet.Deserialize(buffer, buffer.GetSize());
+    world.HandlePacket(&packet);
+}
+
+void ChangeBlock(mc::world::World& world, const mc::Vector3i& position, u32 blockData) {
+    mc::DataBuffer buffer;
+
+    buffer << mc::Position(position.x, position.y, position.z) << mc::VarInt((s32)blockData);
+
+    mc::protocol::packets::in::BlockChangePacket packet;
+    packet.Deserialize(buffer, buffer.GetSize());
+    world.HandlePacket(&packet);
+}
+
+void Explode(mc::world::World& world, const mc::Vector3d& position, const std::vector<mc::Vector3i>& offsets) {
+    mc::DataBuffer buffer;
+
+    buffer << (float)position.x << (float)position.y << (float)position.z << 4.0f << (s32)offsets.size();
+    for (const mc::Vector3i& offset : offsets)
+        buffer << (s8)offset.x << (s8)offset.y << (s8)offset.z;
+    buffer << 0.0f << 0.0f << 0.0f;
+
+    mc::protocol::packets::in::ExplosionPacket packet;
+    packet.Deserialize(buffer, buffer.GetSize());
+    world.HandlePacket(&packet);
+}
+
+void Unload(mc::world::World& world, s32 x, s32 z) {
+    mc::DataBuffer buffer;
+
+    buffer << x << z;
+
+    mc::protocol::packets::in::UnloadChunkPacket packet;
+    packet.Deserialize(buffer, buffer.GetSize());
+    world.HandlePacket(&packet);
+}
+
+const mc::block::BlockRegistry* GetRegistry() {
+    return mc::block::BlockRegistry::GetInstance(mc::protocol::Version::Minecraft_1_12_2);
+}
+
+// A change as position, old block data and new block data
+typedef std::tuple<mc::Vector3i, u32, u32> Change;
+
+Change ToChange(const mc::Vector3i& position, mc::block::BlockPtr newBlock, mc::block::BlockPtr oldBlock) {
+    return Change(position, oldBlock->GetType(), newBlock->GetType());
+}
+
+// Keeps each batch it receives.
+class BatchRecorder : public mc::world::WorldListener {
+public:
+    std::vector<std::vector<Change>> batches;
+
+    void OnBlockChanges(const std::vector<mc::world::BlockChange>& changes) override {
+        batches.emplace_back();
+
+        for (const mc::world::BlockChange& change : changes)
+            batches.back().push_back(ToChange(change.position, change.newBlock, change.oldBlock));
+    }
+};
+
+// Only implements the single block callback.
+class ChangeRecorder : public mc::world::WorldListener {
+public:
+    std::vector<Change> changes;
+
+    void OnBlockChange(mc::Vector3i position, mc::block::BlockPtr newBlock, mc::block::BlockPtr oldBlock) override {
+        changes.push_back(ToChange(position, newBlock, oldBlock));
+    }
+};
+
+// Columns -1 to 1 along x with stone 2, 4, 12 and 13 blocks away from the center of 8, 64, 8.
+void CreateSearchArea(mc::world::World& world) {
+    CreateColumn(world, -1, 0);
+    CreateColumn(world, 0, 0);
+    CreateColumn(world, 1, 0);
+
+    SetBlock(world, mc::Vector3i(20, 64, 8), Stone);
+    SetBlock(world, mc::Vector3i(-5, 64, 8), Stone);
+    SetBlock(world, mc::Vector3i(8, 68, 8), Stone);
+    SetBlock(world, mc::Vector3i(10, 64, 8), Stone);
+}
+
+const mc::Vector3d SearchCenter(8.5, 64.5, 8.5);
+
+// The index only answers searches for states it has, so adding another state makes the world scan its sections instead.
+void RequireIndexMatchesScan(const mc::world::World& world, double radius) {
+    mc::world::BlockTypeSet scanned{ 1, 20 };
+
+    REQUIRE(world.FindBlocks(mc::world::BlockTypeSet{ 1 }, SearchCenter, radius) == world.FindBlocks(scanned, SearchCenter, radius));
+}
+
+} // ns
+
+TEST_CASE("World decodes columns with its own registry", "[WorldQueries]") {
+    mc::protocol::packets::PacketDispatcher dispatcher;
+    mc::world::World world(&dispatcher, GetRegistry());
+    mc::DataBuffer buffer;
+
+    buffer << (s32)3 << (s32)4 << false << mc::VarInt(0) << mc::VarInt(0) << mc::VarInt(0);
+
+    mc::protocol::packets::in::ChunkDataPacket packet;
+    packet.Deserialize(buffer, buffer.GetSize());
+    world.HandlePacket(&packet);
+
+    REQUIRE(packet.IsDecoded());
+    REQUIRE(packet.GetChunkColumn()->GetRegistry() == GetRegistry());
+    REQUIRE(world.GetChunk(mc::Vector3i(48, 0, 64))->GetRegistry() == GetRegistry());
+}
+
+TEST_CASE("World raycasts report the hit face and distance", "[WorldQueries]") {
+    mc::protocol::packets::PacketDispatcher dispatcher;
+    mc::world::World world(&dispatcher, GetRegistry());
+    mc::world::RaycastHit hit;
+
+    CreateColumn(world, 0, 0);
+    CreateColumn(world, -1, 0);
+    SetBlock(world, mc::Vector3i(8, 64, 8), Stone);
+
+    SECTION("straight down onto the top face") {
+        REQUIRE(world.Raycast(mc::Ray(mc::Vector3d(8.5, 70.0, 8.5), mc::Vector3d(0, -1, 0)), 10.0, &hit));
+        REQUIRE(hit.position == mc::Vector3i(8, 64, 8));
+        REQUIRE(hit.face == mc::Face::Top);
+        REQUIRE(hit.distance == Approx(5.0));
+        REQUIRE(hit.block->GetType() == Stone);
+    }
+
+    SECTION("sideways onto the west face") {
+        REQUIRE(world.Raycast(mc::Ray(mc::Vector3d(2.0, 64.5, 8.5), mc::Vector3d(1, 0, 0)), 10.0, &hit));
+        REQUIRE(hit.position == mc::Vector3i(8, 64, 8));
+        REQUIRE(hit.face == mc::Face::West);
+        REQUIRE(hit.distance == Approx(6.0));
+    }
+
+    SECTION("the direction doesn't have to be normalized") {
+        REQUIRE(world.Raycast(mc::Ray(mc::Vector3d(8.5, 64.5, 2.0), mc::Vector3d(0, 0, 20)), 10.0, &hit));
+        REQUIRE(hit.face == mc::Face::North);
+        REQUIRE(hit.distance == Approx(6.0));
+    }
+
+    SECTION("diagonal across a column border") {
+        mc::Vector3d origin(-3.5, 67.5, 8.5);
+        mc::Vector3d target(8.5, 64.5, 8.5);
+
+        REQUIRE(world.Raycast(mc::Ray(origin, target - origin), 20.0, &hit));
+        REQUIRE(hit.position == mc::Vector3i(8, 64, 8));
+        REQUIRE(hit.face == mc::Face::West);
+    }
+
+    SECTION("stops at maxDistance") {
+        REQUIRE_FALSE(world.Raycast(mc::Ray(mc::Vector3d(8.5, 70.0, 8.5), mc::Vector3d(0, -1, 0)), 4.9, &hit));
+        REQUIRE(world.Raycast(mc::Ray(mc::Vector3d(8.5, 70.0, 8.5), mc::Vector3d(0, -1, 0)), 5.0, nullptr));
+    }
+
+    SECTION("misses") {
+        REQUIRE_FALSE(world.Raycast(mc::Ray(mc::Vector3d(8.5, 70.0, 8.5), mc::Vector3d(1, 0, 0)), 50.0, &hit));
+        REQUIRE_FALSE(world.Raycast(mc::Ray(mc::Vector3d(8.5, 70.0, 8.5), mc::Vector3d(0, 0, 0)), 50.0, &hit));
+    }
+
+    SECTION("nearer blocks win") {
+        SetBlock(world, mc::Vector3i(8, 66, 8), Stone);
+
+        REQUIRE(world.Raycast(mc::Ray(mc::Vector3d(8.5, 70.0, 8.5), mc::Vector3d(0, -1, 0)), 10.0, &hit));
+        REQUIRE(hit.position == mc::Vector3i(8, 66, 8));
+        REQUIRE(hit.distance == Approx(3.0));
+    }
+
+    SECTION("starting inside a block") {
+        REQUIRE(world.Raycast(mc::Ray(mc::Vector3d(8.5, 64.5, 8.5), mc::Vector3d(0, 1, 0)), 10.0, &hit));
+        REQUIRE(hit.position == mc::Vector3i(8, 64, 8));
+        REQUIRE(hit.distance == Approx(0.0));
+    }
+}
+
+TEST_CASE("World raycasts hit fences in the block above them", "[WorldQueries]") {
+    mc::block::BlockRegistry* registry = mc::block::BlockRegistry::GetInstance();
+
+    // Vanilla blocks are all full cubes, so register one that is as tall as a fence's collision box.
+    if (!registry->GetBlock(TallFence))
+        registry->RegisterBlock(new mc::block::Block("test:tall_fence", TallFence, true, mc::AABB(mc::Vector3d(0.375, 0, 0.375), mc::Vector3d(0.625, 1.5, 0.625))));
+
+    mc::protocol::packets::PacketDispatcher dispatcher;
+    mc::world::World world(&dispatcher, registry);
+    mc::world::RaycastHit hit;
+
+    CreateColumn(world, 0, 0);
+    SetBlock(world, mc::Vector3i(4, 10, 4), TallFence);
+
+    // Only passes through the block above the fence.
+    REQUIRE(world.Raycast(mc::Ray(mc::Vector3d(0.0, 11.25, 4.5), mc::Vector3d(1, 0, 0)), 10.0, &hit));
+    REQUIRE(hit.position == mc::Vector3i(4, 10, 4));
+    REQUIRE(hit.block->GetType() == TallFence);
+    REQUIRE(hit.face == mc::Face::West);
+    REQUIRE(hit.distance == Approx(4.375));
+
+    // Straight down onto the top of the collision box
+    REQUIRE(world.Raycast(mc::Ray(mc::Vector3d(4.5, 15.0, 4.5), mc::Vector3d(0, -1, 0)), 10.0, &hit));
+    REQUIRE(hit.position == mc::Vector3i(4, 10, 4));
+    REQUIRE(hit.face == mc::Face::Top);
+    REQUIRE(hit.distance == Approx(3.5));
+
+    // Over the top of it
+    REQUIRE_FALSE(world.Raycast(mc::Ray(mc::Vector3d(0.0, 11.75, 4.5), mc::Vector3d(1, 0, 0)), 10.0, &hit));
+    // Beside it
+    REQUIRE_FALSE(world.Raycast(mc::Ray(mc::Vector3d(0.0, 11.25, 4.9), mc::Vector3d(1, 0, 0)), 10.0, &hit));
+}
+
+TEST_CASE("World raycasts leave the world height", "[WorldQueries]") {
+    mc::protocol::packets::PacketDispatcher dispatcher;
+    mc::world::World world(&dispatcher, GetRegistry());
+    mc::world::RaycastHit hit;
+
+    CreateColumn(world, 0, 0);
+    SetBlock(world, mc::Vector3i(8, 0, 8), Stone);
+    SetBlock(world, mc::Vector3i(8, 255, 8), Stone);
+
+    // Rays leaving the world end right away instead of walking to maxDistance.
+    REQUIRE_FALSE(world.Raycast(mc::Ray(mc::Vector3d(2.5, 100.5, 2.5), mc::Vector3d(0, 1, 0)), 1e9, &hit));
+    REQUIRE_FALSE(world.Raycast(mc::Ray(mc::Vector3d(2.5, 100.5, 2.5), mc::Vector3d(0, -1, 0)), 1e9, &hit));
+    REQUIRE_FALSE(world.Raycast(mc::Ray(mc::Vector3d(2.5, -20.0, 2.5), mc::Vector3d(0, -1, 0)), 1e9, &hit));
+
+    // Rays from outside of the world still reach the blocks at its edges.
+    REQUIRE(world.Raycast(mc::Ray(mc::Vector3d(8.5, 300.0, 8.5), mc::Vector3d(0, -1, 0)), 100.0, &hit));
+    REQUIRE(hit.position == mc::Vector3i(8, 255, 8));
+    REQUIRE(hit.face == mc::Face::Top);
+    REQUIRE(hit.distance == Approx(44.0));
+
+    REQUIRE(world.Raycast(mc::Ray(mc::Vector3d(8.5, -10.0, 8.5), mc::Vector3d(0, 1, 0)), 100.0, &hit));
+    REQUIRE(hit.position == mc::Vector3i(8, 0, 8));
+    REQUIRE(hit.face == mc::Face::Bottom);
+    REQUIRE(hit.distance == Approx(10.0));
+}
+
+TEST_CASE("World batched raycasts match single raycasts", "[WorldQueries]") {
+    mc::protocol::packets::PacketDispatcher dispatcher;
+    mc::world::World world(&dispatcher, GetRegistry());
+
+    CreateColumn(world, 0, 0);
+    CreateColumn(world, 1, 0);
+
+    for (s64 x = 0; x < 32; x += 3)
+        SetBlock(world, mc::Vector3i(x, 20 + x % 5, 7), Stone);
+
+    std::vector<mc::Ray> rays;
+
+    for (s32 i = 0; i < 40; ++i)
+        rays.emplace_back(mc::Vector3d(i * 0.8, 30.0, 0.5), mc::Vector3d(0.1, -0.5 - (i % 3) * 0.1, 0.4));
+
+    std::vector<mc::world::RaycastHit> hits = world.Raycast(rays, 40.0);
+
+    REQUIRE(hits.size() == rays.size());
+
+    for (std::size_t i = 0; i < rays.size(); ++i) {
+        mc::world::RaycastHit single;
+        bool found = world.Raycast(rays[i], 40.0, &single);
+
+        REQUIRE(found == (hits[i].block != nullptr));
+
+        if (found) {
+            REQUIRE(hits[i].position == single.position);
+            REQUIRE(hits[i].face == single.face);
+            REQUIRE(hits[i].distance == Approx(single.distance));
+        }
+    }
+}
+
+TEST_CASE("World heightmaps drop when the top block is removed", "[WorldQueries]") {
+    mc::protocol::packets::PacketDispatcher dispatcher;
+    mc::world::World world(&dispatcher, GetRegistry());
+
+    CreateColumn(world, 0, 0);
+    CreateColumn(world, -1, -1);
+
+    REQUIRE(world.GetHeight(5, 5) == 0);
+
+    // Two sections apart, with nothing in between
+    SetBlock(world, mc::Vector3i(5, 3, 5), Stone);
+    SetBlock(world, mc::Vector3i(5, 40, 5), Stone);
+    SetBlock(world, mc::Vector3i(5, 41, 5), Stone);
+
+    for (auto type : { mc::world::HeightmapType::Solid, mc::world::HeightmapType::MotionBlocking, mc::world::HeightmapType::NonAir })
+        REQUIRE(world.GetHeight(5, 5, type) == 42);
+
+    SECTION("one at a time") {
+        SetBlock(world, mc::Vector3i(5, 41, 5), 0);
+        REQUIRE(world.GetHeight(5, 5) == 41);
+
+        SetBlock(world, mc::Vector3i(5, 40, 5), 0);
+        REQUIRE(world.GetHeight(5, 5) == 4);
+        REQUIRE(world.GetHeight(5, 5, mc::world::HeightmapType::NonAir) == 4);
+
+        SetBlock(world, mc::Vector3i(5, 3, 5), 0);
+        REQUIRE(world.GetHeight(5, 5) == 0);
+        REQUIRE(world.GetHeight(5, 5, mc::world::HeightmapType::NonAir) == 0);
+    }
+
+    SECTION("removing a lower block keeps the height") {
+        SetBlock(world, mc::Vector3i(5, 40, 5), 0);
+        REQUIRE(world.GetHeight(5, 5) == 42);
+    }
+
+    SECTION("neighbors are untouched") {
+        SetBlock(world, mc::Vector3i(6, 10, 5), Stone);
+        SetBlock(world, mc::Vector3i(5, 41, 5), 0);
+
+        REQUIRE(world.GetHeight(6, 5) == 11);
+        REQUIRE(world.GetHeight(5, 6) == 0);
+    }
+
+    SECTION("negative coordinates") {
+        SetBlock(world, mc::Vector3i(-3, 70, -14), Stone);
+        SetBlock(world, mc::Vector3i(-3, 20, -14), Stone);
+        REQUIRE(world.GetHeight(-3, -14) == 71);
+
+        SetBlock(world, mc::Vector3i(-3, 70, -14), 0);
+        REQUIRE(world.GetHeight(-3, -14) == 21);
+    }
+}
+
+TEST_CASE("World heightmaps track non-solid blocks separately", "[WorldQueries]") {
+    mc::block::BlockRegistry* registry = mc::block::BlockRegistry::GetInstance();
+
+    registry->RegisterVanillaBlocks(mc::protocol::Version::Minecraft_1_12_2);
+
+    // The vanilla plants are all marked solid.
+    if (!registry->GetBlock(Flower))
+        registry->RegisterBlock(new mc::block::Block("test:flower", Flower, false));
+
+    mc::protocol::packets::PacketDispatcher dispatcher;
+    mc::world::World world(&dispatcher, registry);
+
+    CreateColumn(world, 0, 0);
+
+    SetBlock(world, mc::Vector3i(2, 30, 2), Stone);
+    SetBlock(world, mc::Vector3i(2, 31, 2), Flower);
+
+    REQUIRE(world.GetHeight(2, 2, mc::world::HeightmapType::Solid) == 31);
+    REQUIRE(world.GetHeight(2, 2, mc::world::HeightmapType::MotionBlocking) == 31);
+    REQUIRE(world.GetHeight(2, 2, mc::world::HeightmapType::NonAir) == 32);
+
+    SECTION("removing the block under the flower") {
+        SetBlock(world, mc::Vector3i(2, 30, 2), 0);
+
+        REQUIRE(world.GetHeight(2, 2, mc::world::HeightmapType::Solid) == 0);
+        REQUIRE(world.GetHeight(2, 2, mc::world::HeightmapType::NonAir) == 32);
+    }
+
+    SECTION("removing the flower") {
+        SetBlock(world, mc::Vector3i(2, 31, 2), 0);
+
+        REQUIRE(world.GetHeight(2, 2, mc::world::HeightmapType::Solid) == 31);
+        REQUIRE(world.GetHeight(2, 2, mc::world::HeightmapType::NonAir) == 31);
+    }
+
+    SECTION("replacing the top solid block with the flower") {
+        SetBlock(world, mc::Vector3i(2, 31, 2), 0);
+        SetBlock(world, mc::Vector3i(2, 30, 2), Flower);
+
+        REQUIRE(world.GetHeight(2, 2, mc::world::HeightmapType::Solid) == 0);
+        REQUIRE(world.GetHeight(2, 2, mc::world::HeightmapType::NonAir) == 31);
+    }
+}
+
+TEST_CASE("BlockTypeSet holds states of any registry", "[WorldQueries]") {
+    const mc::block::BlockRegistry* registry = mc::block::BlockRegistry::GetInstance(mc::protocol::Version::Minecraft_1_13_2);
+    const u32 last = registry->GetBlock((u32)registry->GetStateCount() - 1)->GetType();
+
+    REQUIRE(last >= (1 << 13));
+
+    mc::world::BlockTypeSet sized(*registry);
+    mc::world::BlockTypeSet grown;
+
+    REQUIRE(sized.IsEmpty());
+
+    sized.AddState(last);
+    grown.AddState(last);
+    grown.AddState(5);
+
+    REQUIRE(sized.Contains(last));
+    REQUIRE(grown.Contains(last));
+    REQUIRE_FALSE(sized.Contains(last - 1));
+    REQUIRE_FALSE(sized.Contains(1 << 20));
+
+    REQUIRE(grown.Contains(sized));
+    REQUIRE_FALSE(sized.Contains(grown));
+    REQUIRE(sized.Intersects(grown));
+    REQUIRE_FALSE(sized.Intersects(mc::world::BlockTypeSet{ 1 }));
+
+    grown.Remove(last);
+    grown.Remove(1 << 20);
+
+    REQUIRE_FALSE(grown.Contains(last));
+    REQUIRE_FALSE(grown.Intersects(sized));
+    REQUIRE(mc::world::BlockTypeSet().Contains(mc::world::BlockTypeSet()));
+
+    SECTION("the world finds flattened states") {
+        mc::protocol::packets::PacketDispatcher dispatcher;
+        mc::world::World world(&dispatcher, registry);
+
+        CreateColumn(world, 0, 0);
+        ChangeBlock(world, mc::Vector3i(3, 70, 3), last);
+
+        REQUIRE(world.FindBlocks(sized, SearchCenter, 20.0) == std::vector<mc::Vector3i>{ mc::Vector3i(3, 70, 3) });
+
+        world.SetIndexedStates(sized);
+        ChangeBlock(world, mc::Vector3i(4, 70, 4), last);
+
+        REQUIRE(world.FindBlocks(sized, SearchCenter, 20.0) == std::vector<mc::Vector3i>{ mc::Vector3i(4, 70, 4), mc::Vector3i(3, 70, 3) });
+    }
+}
+
+TEST_CASE("World finds blocks nearest first", "[WorldQueries]") {
+    mc::protocol::packets::PacketDispatcher dispatcher;
+    mc::world::World world(&dispatcher, GetRegistry());
+    mc::world::BlockTypeSet stone{ 1 };
+
+    CreateSearchArea(world);
+
+    auto search = [&world, &stone]() {
+        SECTION("the blocks exactly at the radius are included") {
+            REQUIRE(world.FindBlocks(stone, SearchCenter, 12.0) == std::vector<mc::Vector3i>{
+                mc::Vector3i(10, 64, 8), mc::Vector3i(8, 68, 8), mc::Vector3i(20, 64, 8)
+            });
+
+            REQUIRE(world.FindBlocks(stone, SearchCenter, 11.99).size() == 2);
+            REQUIRE(world.FindBlocks(stone, SearchCenter, 13.0).back() == mc::Vector3i(-5, 64, 8));
+        }
+
+        SECTION("maxResults keeps the nearest") {
+            REQUIRE(world.FindBlocks(stone, SearchCenter, 100.0, 2) == std::vector<mc::Vector3i>{ mc::Vector3i(10, 64, 8), mc::Vector3i(8, 68, 8) });
+            REQUIRE(world.FindBlocks(stone, SearchCenter, 100.0, 0).empty());
+        }
+
+        SECTION("the visitor can stop early") {
+            std::vector<mc::Vector3i> visited;
+
+            world.ForEachBlockNearest(stone, SearchCenter, 100.0, [&visited](const mc::Vector3i& position, mc::block::BlockPtr block) {
+                REQUIRE(block->GetType() == Stone);
+                visited.push_back(position);
+                return visited.size() < 3;
+            });
+
+            REQUIRE(visited == std::vector<mc::Vector3i>{ mc::Vector3i(10, 64, 8), mc::Vector3i(8, 68, 8), mc::Vector3i(20, 64, 8) });
+        }
+    };
+
+    SECTION("by scanning sections") {
+        search();
+
+        SECTION("sections without the state in their palette have no hits") {
+            const u32 Dirt = 3 << 4;
+
+            SetBlock(world, mc::Vector3i(8, 100, 8), Dirt);
+            REQUIRE(world.FindBlocks(mc::world::BlockTypeSet{ 3 }, SearchCenter, 100.0) == std::vector<mc::Vector3i>{ mc::Vector3i(8, 100, 8) });
+
+            // The palette still has dirt after it's replaced, but the blocks don't.
+            SetBlock(world, mc::Vector3i(8, 100, 8), Stone);
+            REQUIRE(world.FindBlocks(mc::world::BlockTypeSet{ 3 }, SearchCenter, 100.0).empty());
+            REQUIRE(world.FindBlocks(stone, SearchCenter, 100.0).front() == mc::Vector3i(10, 64, 8));
+        }
+    }
+
+    SECTION("through the index") {
+        world.SetIndexedStates(stone);
+        search();
+    }
+}
+
+TEST_CASE("World keeps the block index up to date", "[WorldQueries]") {
+    mc::protocol::packets::PacketDispatcher dispatcher;
+    mc::world::World world(&dispatcher, GetRegistry());
+    mc::world::BlockTypeSet stone{ 1 };
+
+    CreateSearchArea(world);
+    world.SetIndexedStates(stone);
+    RequireIndexMatchesScan(world, 100.0);
+
+    ChangeBlock(world, mc::Vector3i(9, 64, 8), Stone);
+    ChangeBlock(world, mc::Vector3i(10, 64, 8), 0);
+
+    REQUIRE(world.FindBlocks(stone, SearchCenter, 100.0, 1) == std::vector<mc::Vector3i>{ mc::Vector3i(9, 64, 8) });
+    RequireIndexMatchesScan(world, 100.0);
+
+    SetBlock(world, mc::Vector3i(8, 68, 8), 0);
+    SetBlock(world, mc::Vector3i(24, 80, 0), Stone);
+
+    REQUIRE(world.FindBlocks(stone, SearchCenter, 100.0) == std::vector<mc::Vector3i>{
+        mc::Vector3i(9, 64, 8), mc::Vector3i(20, 64, 8), mc::Vector3i(-5, 64, 8), mc::Vector3i(24, 80, 0)
+    });
+    RequireIndexMatchesScan(world, 100.0);
+
+    // Across two columns
+    Explode(world, mc::Vector3d(15.0, 64.0, 8.0), { mc::Vector3i(-6, 0, 0), mc::Vector3i(5, 0, 0), mc::Vector3i(0, 1, 0) });
+
+    REQUIRE(world.FindBlocks(stone, SearchCenter, 100.0) == std::vector<mc::Vector3i>{ mc::Vector3i(-5, 64, 8), mc::Vector3i(24, 80, 0) });
+    RequireIndexMatchesScan(world, 100.0);
+
+    Unload(world, 1, 0);
+
+    REQUIRE(world.FindBlocks(stone, SearchCenter, 100.0) == std::vector<mc::Vector3i>{ mc::Vector3i(-5, 64, 8) });
+    RequireIndexMatchesScan(world, 100.0);
+
+    // A column loaded again starts out empty.
+    CreateColumn(world, 1, 0);
+    RequireIndexMatchesScan(world, 100.0);
+    REQUIRE(world.FindBlocks(stone, SearchCenter, 100.0).size() == 1);
+}
+
+TEST_CASE("World heightmaps find fluids by name", "[WorldQueries]") {
+    const mc::block::BlockRegistry* registry = mc::block::BlockRegistry::GetInstance(mc::protocol::Version::Minecraft_1_13_2);
+    mc::block::BlockPtr water = registry->GetBlock("minecraft:water");
+    mc::block::BlockPtr sapling = registry->GetBlock("minecraft:oak_sapling");
+
+    // Neither is solid, and the flattened ids aren't the 1.12 ones.
+    REQUIRE_FALSE(water->IsSolid());
+    REQUIRE_FALSE(sapling->IsSolid());
+    REQUIRE((water->GetType() >> 4) != 9);
+
+    mc::protocol::packets::PacketDispatcher dispatcher;
+    mc::world::World world(&dispatcher, registry);
+
+    CreateColumn(world, 0, 0);
+    ChangeBlock(world, mc::Vector3i(1, 20, 1), water->GetType());
+    ChangeBlock(world, mc::Vector3i(2, 20, 2), sapling->GetType());
+
+    REQUIRE(world.GetHeight(1, 1, mc::world::HeightmapType::Solid) == 0);
+    REQUIRE(world.GetHeight(1, 1, mc::world::HeightmapType::MotionBlocking) == 21);
+    REQUIRE(world.GetHeight(1, 1, mc::world::HeightmapType::NonAir) == 21);
+
+    REQUIRE(world.GetHeight(2, 2, mc::world::HeightmapType::MotionBlocking) == 0);
+    REQUIRE(world.GetHeight(2, 2, mc::world::HeightmapType::NonAir) == 21);
+
+    // Loading computes them from the sections the same way.
+    mc::world::ChunkColumn column(*world.GetChunk(mc::Vector3i(0, 0, 0)));
+    column.ComputeHeightmaps();
+
+    REQUIRE(column.GetHeight(1, 1, mc::world::HeightmapType::MotionBlocking) == 21);
+    REQUIRE(column.GetHeight(2, 2, mc::world::HeightmapType::MotionBlocking) == 0);
+}
+
+TEST_CASE("World reports the block changes of a packet together", "[WorldQueries]") {
+    const u32 Dirt = 3 << 4;
+
+    mc::protocol::packets::PacketDispatcher dispatcher;
+    mc::world::World world(&dispatcher, GetRegistry());
+    BatchRecorder batches;
+    ChangeRecorder singles;
+    std::size_t events = 0;
+
+    CreateColumn(world, 0, 0);
+    CreateColumn(world, 1, 0);
+    SetBlock(world, mc::Vector3i(1, 10, 1), Stone);
+
+    world.RegisterListener(&batches);
+    world.RegisterListener(&singles);
+
+    auto onChanges = [](void* context, const std::vector<mc::world::BlockChange>&) { ++*static_cast<std::size_t*>(context); };
+    mc::util::EventSubscription subscription = world.GetBlockChangesEvent().Subscribe(onChanges, &events);
+
+    SECTION("a multi block change is one batch") {
+        mc::DataBuffer buffer;
+
+        buffer << (s32)0 << (s32)0 << mc::VarInt(3);
+        buffer << (u8)((1 << 4) | 1) << (u8)10 << mc::VarInt((s32)Dirt);
+        buffer << (u8)((2 << 4) | 1) << (u8)10 << mc::VarInt((s32)Stone);
+        buffer << (u8)((3 << 4) | 1) << (u8)11 << mc::VarInt((s32)Dirt);
+
+        mc::protocol::packets::in::MultiBlockChangePacket packet;
+        packet.Deserialize(buffer, buffer.GetSize());
+        world.HandlePacket(&packet);
+
+        std::vector<Change> expected = {
+            Change(mc::Vector3i(1, 10, 1), Stone, Dirt),
+            Change(mc::Vector3i(2, 10, 1), 0, Stone),
+            Change(mc::Vector3i(3, 11, 1), 0, Dirt)
+        };
+
+        REQUIRE(batches.batches == std::vector<std::vector<Change>>{ expected });
+        // The default OnBlockChanges hands them over one at a time.
+        REQUIRE(singles.changes == expected);
+        REQUIRE(events == 1);
+    }
+
+    SECTION("a block change is a batch of one") {
+        ChangeBlock(world, mc::Vector3i(1, 10, 1), 0);
+        ChangeBlock(world, mc::Vector3i(1, 10, 1), Dirt);
+
+        REQUIRE(batches.batches == std::vector<std::vector<Change>>{
+            { Change(mc::Vector3i(1, 10, 1), Stone, 0) },
+            { Change(mc::Vector3i(1, 10, 1), 0, Dirt) }
+        });
+        REQUIRE(singles.changes.size() == 2);
+        REQUIRE(events == 2);
+    }
+
+    SECTION("an explosion reports every block it affected") {
+        const mc::Vector3d center(15.0, 10.0, 1.0);
+        std::vector<mc::Vector3i> offsets = {
+            mc::Vector3i(-14, 0, 0), mc::Vector3i(2, 0, 0), mc::Vector3i(-13, 0, 0), mc::Vector3i(0, 0, 0), mc::Vector3i(3, 1, 2)
+        };
+
+        SetBlock(world, mc::Vector3i(17, 10, 1), Dirt);
+        SetBlock(world, mc::Vector3i(15, 10, 1), Stone);
+        batches.batches.clear();
+        singles.changes.clear();
+        events = 0;
+
+        // What the explosion did before it was grouped by column: every block in packet order, set to air.
+        std::vector<Change> expected;
+        for (const mc::Vector3i& offset : offsets) {
+            mc::Vector3i position(15 + offset.x, 10 + offset.y, 1 + offset.z);
+            expected.push_back(Change(position, world.GetBlock(position)->GetType(), 0));
+        }
+
+        Explode(world, center, offsets);
+
+        REQUIRE(batches.batches.size() == 1);
+        REQUIRE(events == 1);
+
+        std::vector<Change> batch = batches.batches[0];
+        std::sort(batch.begin(), batch.end());
+        std::sort(expected.begin(), expected.end());
+
+        REQUIRE(batch == expected);
+        REQUIRE(singles.changes.size() == expected.size());
+
+        for (const Change& change : expected)
+            REQUIRE(world.GetBlock(std::get<0>(change))->GetType() == 0);
+    }
+
+    world.GetBlockChangesEvent().Unsubscribe(subscription);
+    world.UnregisterListener(&singles);
+    world.UnregisterListener(&batches);
+}